@@ -354,9 +354,21 @@ int32_t HalCm_DumpCurbeData(PCM_HAL_STATE state)
         sizeToAllocate = numberOfDwords*SIZE_OF_DWORD_PLUS_ONE+2;
         outputBuffer = (char *)MOS_AllocAndZeroMemory(sizeToAllocate);
         curbeData = (uint32_t *)MOS_AllocAndZeroMemory(stateHeap->pCurMediaState->pDynamicState->Curbe.dwSize);
-        stateHeap->pCurMediaState->pDynamicState->memoryBlock.ReadData(curbeData,
-            stateHeap->pCurMediaState->pDynamicState->Curbe.dwOffset,
-            stateHeap->pCurMediaState->pDynamicState->Curbe.dwSize);
+        // CURBE writes to the heap may be deferred, staged copy is up to date
+        if (stateHeap->pCurbeCache &&
+            stateHeap->pCurbeCache->pDynamicState == stateHeap->pCurMediaState->pDynamicState)
+        {
+            MOS_SecureMemcpy(curbeData,
+                stateHeap->pCurMediaState->pDynamicState->Curbe.dwSize,
+                stateHeap->pCurbeCache->pStaging,
+                stateHeap->pCurMediaState->pDynamicState->Curbe.dwSize);
+        }
+        else
+        {
+            stateHeap->pCurMediaState->pDynamicState->memoryBlock.ReadData(curbeData,
+                stateHeap->pCurMediaState->pDynamicState->Curbe.dwOffset,
+                stateHeap->pCurMediaState->pDynamicState->Curbe.dwSize);
+        }
 
         bytesWritten += HalCm_CopyHexDwordLine(outputBuffer,
                           sizeToAllocate - bytesWritten,
@@ -0,0 +1,108 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     codechal_decode_bitstream_chain.h
+//! \brief    Defines the bookkeeping of a bitstream gathered over multiple execute calls.
+//!
+
+#ifndef __CODECHAL_DECODE_BITSTREAM_CHAIN_H__
+#define __CODECHAL_DECODE_BITSTREAM_CHAIN_H__
+
+#include "mos_defs.h"
+
+//!
+//! \class   CodechalDecodeBitstreamChain
+//! \brief   Tracks a bitstream submitted over multiple execute calls
+//! \details Each chunk is placed at the next cache line aligned offset of the copy buffer.
+//!          The chain checks the copy buffer capacity and tells when the expected
+//!          bitstream size has been gathered.
+//!
+class CodechalDecodeBitstreamChain
+{
+public:
+    //!
+    //! \brief    Start a new chain for the next frame
+    //!
+    void Reset()
+    {
+        m_nextOffset   = 0;
+        m_expectedSize = 0;
+    }
+
+    //!
+    //! \brief    Set the size of the copy buffer the chunks are gathered into
+    //!
+    void SetBufferSize(uint32_t bufferSize) { m_bufferSize = bufferSize; }
+
+    //!
+    //! \brief    Set the total bitstream size expected for the frame
+    //!
+    void SetExpectedSize(uint32_t expectedSize) { m_expectedSize = expectedSize; }
+
+    uint32_t GetBufferSize() const { return m_bufferSize; }
+    uint32_t GetExpectedSize() const { return m_expectedSize; }
+
+    //!
+    //! \brief    Get the copy buffer offset the next chunk is placed at
+    //! \details  Also the size of the gathered bitstream so far
+    //!
+    uint32_t GetNextOffset() const { return m_nextOffset; }
+
+    //!
+    //! \brief    Check if a chunk of the given size fits into the copy buffer
+    //!
+    bool Fits(uint32_t size) const { return (uint64_t)m_nextOffset + size <= m_bufferSize; }
+
+    //!
+    //! \brief    Check if all the expected bitstream data has been gathered
+    //!
+    bool IsComplete() const { return m_nextOffset >= m_expectedSize; }
+
+    //!
+    //! \brief    Check if appending a chunk of the given size completes the bitstream
+    //! \details  All chunks but the last one must be cache line aligned
+    //!
+    bool CompletesWith(uint32_t size) const { return (uint64_t)m_nextOffset + size >= m_expectedSize; }
+
+    //!
+    //! \brief    Record a chunk copied to GetNextOffset()
+    //! \param    [in] size
+    //!           Byte size of the chunk
+    //! \return   uint32_t
+    //!           Offset of the chunk in the copy buffer
+    //!
+    uint32_t Append(uint32_t size)
+    {
+        uint32_t offset = m_nextOffset;
+        m_nextOffset += MOS_ALIGN_CEIL(size, m_chunkAlignment);
+        return offset;
+    }
+
+    static const uint32_t m_chunkAlignment = 64;    //!< Chunks start on a cache line
+
+protected:
+    uint32_t    m_bufferSize   = 0;     //!< Size of the copy buffer
+    uint32_t    m_expectedSize = 0;     //!< Expected bitstream size of the frame
+    uint32_t    m_nextOffset   = 0;     //!< Copy buffer offset of the next chunk
+};
+
+#endif  // __CODECHAL_DECODE_BITSTREAM_CHAIN_H__
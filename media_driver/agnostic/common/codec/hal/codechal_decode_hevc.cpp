@@ -930,7 +930,7 @@ MOS_STATUS CodechalDecodeHevc::InitializeBitstreamCat ()
 
     m_incompletePicture = false;
     m_copyDataBufferInUse = false;
-    m_copyDataOffset      = 0;
+    m_bitstreamChain.Reset();
 
     // For multiple execution case, each execution for one frame will increase pDecoderInterface->dwFrameNum in CodecHalDecode_Decode.
     // This will lead to dump index error.
@@ -940,6 +940,7 @@ MOS_STATUS CodechalDecodeHevc::InitializeBitstreamCat ()
     // Estimate Bytes in Bitstream per frame
     PCODEC_HEVC_SLICE_PARAMS hevcLastSliceParamsInFrame = m_hevcSliceParams + (m_numSlices - 1);
     m_estiBytesInBitstream                              = MOS_ALIGN_CEIL(hevcLastSliceParamsInFrame->slice_data_offset + hevcLastSliceParamsInFrame->slice_data_size, 64);
+    m_bitstreamChain.SetExpectedSize(m_estiBytesInBitstream);
     CODECHAL_DECODE_NORMALMESSAGE("Estimate bitstream size in this Frame: %u", m_estiBytesInBitstream);
 
     return eStatus;
@@ -975,11 +976,11 @@ MOS_STATUS CodechalDecodeHevc::CopyDataSurface()
         &cmdBuffer,            // pCmdBuffer
         &m_resDataBuffer,      // presSrc
         &m_resCopyDataBuffer,  // presDst
-        m_dataSize,            // u32CopyLength
-        m_dataOffset,          // u32CopyInputOffset
-        m_copyDataOffset));    // u32CopyOutputOffset
+        m_dataSize,                         // u32CopyLength
+        m_dataOffset,                       // u32CopyInputOffset
+        m_bitstreamChain.GetNextOffset())); // u32CopyOutputOffset
 
-    m_copyDataOffset += MOS_ALIGN_CEIL(m_dataSize, MHW_CACHELINE_SIZE);
+    m_bitstreamChain.Append(m_dataSize);
 
     MHW_MI_FLUSH_DW_PARAMS flushDwParams;
     MOS_ZeroMemory(&flushDwParams, sizeof(flushDwParams));
@@ -1036,7 +1037,7 @@ MOS_STATUS CodechalDecodeHevc::CheckAndCopyBitstream()
         {
             CODECHAL_DECODE_NORMALMESSAGE("Multiple Execution Call for HEVC triggered!");
 
-            if (m_copyDataBufferSize < m_estiBytesInBitstream)  // allocate an appropriate buffer
+            if (m_bitstreamChain.GetBufferSize() < m_estiBytesInBitstream)  // allocate an appropriate buffer
             {
                 if (!Mos_ResourceIsNull(&m_resCopyDataBuffer))
                 {
@@ -1051,8 +1052,8 @@ MOS_STATUS CodechalDecodeHevc::CheckAndCopyBitstream()
                                                               "HevcCopyDataBuffer"),
                     "Failed to allocate Hevc copy data buffer.");
 
-                m_copyDataBufferSize = m_estiBytesInBitstream;
-                CODECHAL_DECODE_NORMALMESSAGE("Create buffersize %d for MEC.", m_copyDataBufferSize);
+                m_bitstreamChain.SetBufferSize(m_estiBytesInBitstream);
+                CODECHAL_DECODE_NORMALMESSAGE("Create buffersize %d for MEC.", m_estiBytesInBitstream);
             }
 
             if (m_dataSize)
@@ -1067,7 +1068,7 @@ MOS_STATUS CodechalDecodeHevc::CheckAndCopyBitstream()
     }
     else
     {
-        if (m_copyDataOffset + m_dataSize > m_copyDataBufferSize)
+        if (!m_bitstreamChain.Fits(m_dataSize))
         {
             CODECHAL_DECODE_ASSERTMESSAGE("Bitstream size exceeds copy data buffer size!");
             return MOS_STATUS_UNKNOWN;
@@ -1079,7 +1080,7 @@ MOS_STATUS CodechalDecodeHevc::CheckAndCopyBitstream()
             m_frameIdx--;  // to keep u32FrameIdx as normal logic meaning.
         }
 
-        if (m_copyDataOffset >= m_estiBytesInBitstream)
+        if (m_bitstreamChain.IsComplete())
         {
             m_incompletePicture = false;
         }
@@ -1507,7 +1508,7 @@ MOS_STATUS CodechalDecodeHevc::AddPictureS2LCmds(
     MHW_VDBOX_IND_OBJ_BASE_ADDR_PARAMS indObjBaseAddrParams;
     MOS_ZeroMemory(&indObjBaseAddrParams, sizeof(indObjBaseAddrParams));
     indObjBaseAddrParams.Mode               = m_mode;
-    indObjBaseAddrParams.dwDataSize         = m_copyDataBufferInUse ? m_copyDataBufferSize : m_dataSize;
+    indObjBaseAddrParams.dwDataSize         = m_copyDataBufferInUse ? m_bitstreamChain.GetBufferSize() : m_dataSize;
     indObjBaseAddrParams.dwDataOffset       = m_copyDataBufferInUse ? 0 : m_dataOffset;
     indObjBaseAddrParams.presDataBuffer     = m_copyDataBufferInUse ? &m_resCopyDataBuffer : &m_resDataBuffer;
 
@@ -1781,7 +1782,7 @@ MOS_STATUS CodechalDecodeHevc::InitPicLongFormatMhwParams()
 #endif
 
     m_picMhwParams.IndObjBaseAddrParams->Mode            = m_mode;
-    m_picMhwParams.IndObjBaseAddrParams->dwDataSize      = m_copyDataBufferInUse ? m_copyDataBufferSize : m_dataSize;
+    m_picMhwParams.IndObjBaseAddrParams->dwDataSize      = m_copyDataBufferInUse ? m_bitstreamChain.GetBufferSize() : m_dataSize;
     m_picMhwParams.IndObjBaseAddrParams->dwDataOffset    = m_copyDataBufferInUse ? 0 : m_dataOffset;
     m_picMhwParams.IndObjBaseAddrParams->presDataBuffer  = m_copyDataBufferInUse ? &m_resCopyDataBuffer : &m_resDataBuffer;
 
@@ -2030,6 +2031,17 @@ MOS_STATUS CodechalDecodeHevc::SendSliceS2L(
     return eStatus;
 }
 
+void CodechalDecodeHevc::SetPictureRefIdxParams()
+{
+    CODECHAL_DECODE_FUNCTION_ENTER;
+
+    CodecHalDecodeHevcSetPicRefIdxParams(
+        m_picRefIdxParams,
+        *m_hevcPicParams,
+        (void**)m_hevcRefList,
+        &m_refIdxMapping[0]);
+}
+
 MOS_STATUS CodechalDecodeHevc::SendSliceLongFormat(
     PMOS_COMMAND_BUFFER             cmdBuffer,
     PMHW_VDBOX_HEVC_SLICE_STATE     hevcSliceState)
@@ -2059,22 +2071,10 @@ MOS_STATUS CodechalDecodeHevc::SendSliceLongFormat(
 
     if (! m_hcpInterface->IsHevcISlice(slc->LongSliceFlags.fields.slice_type))
     {
-        MHW_VDBOX_HEVC_REF_IDX_PARAMS refIdxParams;
-        refIdxParams.CurrPic         = m_hevcPicParams->CurrPic;
-        refIdxParams.ucList = 0;
-        refIdxParams.ucNumRefForList = slc->num_ref_idx_l0_active_minus1 + 1;
-        eStatus = MOS_SecureMemcpy(&refIdxParams.RefPicList, sizeof(refIdxParams.RefPicList), &slc->RefPicList, sizeof(slc->RefPicList));
+        // Picture level fields are set up once by SetPictureRefIdxParams
+        MHW_VDBOX_HEVC_REF_IDX_PARAMS &refIdxParams = m_picRefIdxParams;
+        eStatus = CodecHalDecodeHevcSetSliceRefIdxParams(refIdxParams, *slc);
         CODECHAL_DECODE_CHK_STATUS_MESSAGE_RETURN(eStatus, "Failed to copy memory.");
-        refIdxParams.hevcRefList = (void**)m_hevcRefList;
-        refIdxParams.poc_curr_pic  = m_hevcPicParams->CurrPicOrderCntVal;
-        for (uint8_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
-        {
-            refIdxParams.poc_list[i] = m_hevcPicParams->PicOrderCntValList[i];
-        }
-
-        refIdxParams.pRefIdxMapping = hevcSliceState->pRefIdxMapping;
-        refIdxParams.RefFieldPicFlag    = m_hevcPicParams->RefFieldPicFlag;
-        refIdxParams.RefBottomFieldFlag = m_hevcPicParams->RefBottomFieldFlag;
 
         CODECHAL_DECODE_CHK_STATUS_RETURN(m_hcpInterface->AddHcpRefIdxStateCmd(
             cmdBuffer,
@@ -2252,6 +2252,11 @@ MOS_STATUS CodechalDecodeHevc::DecodePrimitiveLevel()
         hevcSliceState.pHevcPicParams = m_hevcPicParams;
         hevcSliceState.pRefIdxMapping = &m_refIdxMapping[0];
 
+        if (!m_shortFormatInUse)
+        {
+            SetPictureRefIdxParams();
+        }
+
         PCODEC_HEVC_SLICE_PARAMS slc = m_hevcSliceParams;
         for (uint32_t slcCount = 0; slcCount < m_numSlices; slcCount++)
         {
@@ -2704,13 +2709,12 @@ CodechalDecodeHevc::CodechalDecodeHevc(
                                             m_dmemBufferSize(0),
                                             m_dmemTransferSize(0),
                                             m_dmemBufferProgrammed(false),
-                                            m_copyDataBufferSize(0),
-                                            m_copyDataOffset(0),
                                             m_copyDataBufferInUse(false),
                                             m_estiBytesInBitstream(0),
                                             m_curPicIntra(false),
                                             m_mvBufferSize(0),
                                             m_hevcMvBufferIndex(0),
+                                            m_picRefIdxParams(),
                                             m_frameIdx(0),
                                             m_enableSf2DmaSubmits(false),
                                             m_widthLastMaxAlloced(0),
@@ -32,6 +32,7 @@
 #include "codechal_hw.h"
 #include "codechal_decode_sfc_hevc.h"
 #include "codechal_decoder.h"
+#include "codechal_decode_hevc_ref_idx.h"
 
 class CodechalDecodeNV12ToP010;
 
@@ -439,6 +440,15 @@ public:
     //!
     MOS_STATUS          GetAllTileInfo();
 
+    //!
+    //! \brief    Set up picture level reference index parameters
+    //! \details  Fill the HCP_REF_IDX_STATE parameters shared by all slices of the picture,
+    //!           the per list fields are filled for each slice in SendSliceLongFormat
+    //!
+    //! \return   void
+    //!
+    void                SetPictureRefIdxParams();
+
     //!
     //! \brief    Allocate variable sized resources
     //! \details  Allocate variable sized resources in HEVC decode driver
@@ -546,8 +556,7 @@ public:
     uint32_t         m_dmemTransferSize;                                //!< Transfer size of DMEM data
     bool             m_dmemBufferProgrammed;                            //!< Indicate DMEM buffer is programmed
     MOS_RESOURCE     m_resCopyDataBuffer;                               //!< Handle of copied bitstream buffer
-    uint32_t         m_copyDataBufferSize;                              //!< Size of copied bitstream buffer
-    uint32_t         m_copyDataOffset;                                  //!< Offset of copied bitstream
+    CodechalDecodeBitstreamChain m_bitstreamChain;                      //!< Chunks and size of copied bitstream buffer
     bool             m_copyDataBufferInUse;                             //!< Indicate copied bistream is inuse
     uint32_t         m_estiBytesInBitstream;                            //!< Estimated size of bitstream
 
@@ -562,6 +571,7 @@ public:
     CODECHAL_DECODE_HEVC_MV_LIST m_hevcMvList[CODEC_NUM_HEVC_MV_BUFFERS];                //!< Status table of MV buffers
     bool                         m_frameUsedAsCurRef[CODEC_MAX_NUM_REF_FRAME_HEVC];      //!< Indicate frames used as reference of current picture
     int8_t                       m_refIdxMapping[CODEC_MAX_NUM_REF_FRAME_HEVC];          //!< Map table of indices of references
+    MHW_VDBOX_HEVC_REF_IDX_PARAMS m_picRefIdxParams;                                    //!< Picture level ref idx params, list fields are set per slice
     uint32_t                     m_frameIdx;                                             //!< Decode order index of current frame
     bool                         m_enableSf2DmaSubmits;                                  //!< Indicate two DMA submits is enabled on short format
 
@@ -0,0 +1,90 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     codechal_decode_hevc_ref_idx.h
+//! \brief    Fills the HCP_REF_IDX_STATE parameters of HEVC long format slices.
+//! \details  The picture level fields are filled once per picture, the list fields for
+//!           each P/B slice. Templated on the MHW parameter struct so gen specific
+//!           derived structs are filled the same way.
+//!
+
+#ifndef __CODECHAL_DECODE_HEVC_REF_IDX_H__
+#define __CODECHAL_DECODE_HEVC_REF_IDX_H__
+
+#include "codec_def_decode_hevc.h"
+
+//!
+//! \brief    Fill the picture level reference index parameters
+//! \details  Current picture, POC list, field flags, ref list and ref index mapping
+//!           are the same for all slices of the picture
+//! \param    [out] params
+//!           Reference index parameters
+//! \param    [in] picParams
+//!           HEVC picture parameters
+//! \param    [in] hevcRefList
+//!           Reference list of the decoder
+//! \param    [in] refIdxMapping
+//!           Map table of indices of references
+//! \return   void
+//!
+template <class RefIdxParams>
+void CodecHalDecodeHevcSetPicRefIdxParams(
+    RefIdxParams                &params,
+    const CODEC_HEVC_PIC_PARAMS &picParams,
+    void                        **hevcRefList,
+    int8_t                      *refIdxMapping)
+{
+    params.CurrPic      = picParams.CurrPic;
+    params.hevcRefList  = hevcRefList;
+    params.poc_curr_pic = picParams.CurrPicOrderCntVal;
+    for (uint8_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+    {
+        params.poc_list[i] = picParams.PicOrderCntValList[i];
+    }
+    params.pRefIdxMapping     = refIdxMapping;
+    params.RefFieldPicFlag    = picParams.RefFieldPicFlag;
+    params.RefBottomFieldFlag = picParams.RefBottomFieldFlag;
+}
+
+//!
+//! \brief    Fill the list 0 reference index parameters of a P/B slice
+//! \details  The picture level fields must have been filled by
+//!           CodecHalDecodeHevcSetPicRefIdxParams; list 1 only differs in
+//!           ucList and ucNumRefForList
+//! \param    [in,out] params
+//!           Reference index parameters
+//! \param    [in] slc
+//!           HEVC slice parameters
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+template <class RefIdxParams>
+MOS_STATUS CodecHalDecodeHevcSetSliceRefIdxParams(
+    RefIdxParams                  &params,
+    const CODEC_HEVC_SLICE_PARAMS &slc)
+{
+    params.ucList          = 0;
+    params.ucNumRefForList = slc.num_ref_idx_l0_active_minus1 + 1;
+    return MOS_SecureMemcpy(&params.RefPicList, sizeof(params.RefPicList), &slc.RefPicList, sizeof(slc.RefPicList));
+}
+
+#endif  // __CODECHAL_DECODE_HEVC_REF_IDX_H__
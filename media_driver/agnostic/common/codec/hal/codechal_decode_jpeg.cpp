@@ -70,9 +70,6 @@ CodechalDecodeJpeg::CodechalDecodeJpeg(
     PCODECHAL_STANDARD_INFO standardInfo) : CodechalDecode(hwInterface, debugInterface, standardInfo),
                                             m_dataSize(0),
                                             m_dataOffset(0),
-                                            m_copiedDataBufferSize(0),
-                                            m_nextCopiedDataOffset(0),
-                                            m_totalDataLength(0),
                                             m_preNumScans(0),
                                             m_copiedDataBufferInUse(false)
 
@@ -97,8 +94,7 @@ MOS_STATUS CodechalDecodeJpeg::InitializeBeginFrame()
     m_incompletePicture = false;
     m_incompleteJpegScan = false;
     m_copiedDataBufferInUse = false;
-    m_nextCopiedDataOffset  = 0;
-    m_totalDataLength       = 0;
+    m_bitstreamChain.Reset();
     m_preNumScans           = 0;
 
     return MOS_STATUS_SUCCESS;
@@ -120,17 +116,17 @@ MOS_STATUS CodechalDecodeJpeg::CopyDataSurface()
         dataCopyParams.srcOffset = 0;
         dataCopyParams.dstResource = &m_resCopiedDataBuffer;
         dataCopyParams.dstSize = alignedSize;
-        dataCopyParams.dstOffset   = m_nextCopiedDataOffset;
+        dataCopyParams.dstOffset   = m_bitstreamChain.GetNextOffset();
 
         CODECHAL_DECODE_CHK_STATUS_RETURN(m_hwInterface->CopyDataSourceWithDrv(
             &dataCopyParams));
 
-        m_nextCopiedDataOffset += MOS_ALIGN_CEIL(m_dataSize, MHW_CACHELINE_SIZE);  // 64-byte aligned
+        m_bitstreamChain.Append(m_dataSize);  // 64-byte aligned
         return MOS_STATUS_SUCCESS;
     }
 
     CODECHAL_DECODE_CHK_COND_RETURN(
-        ((m_nextCopiedDataOffset + m_dataSize) > m_copiedDataBufferSize),
+        !m_bitstreamChain.Fits(m_dataSize),
         "Copied data buffer is not large enough.");
 
     CODECHAL_DECODE_CHK_STATUS_RETURN(m_osInterface->pfnSetGpuContext(
@@ -159,11 +155,11 @@ MOS_STATUS CodechalDecodeJpeg::CopyDataSurface()
         &cmdBuffer,                // pCmdBuffer
         &m_resDataBuffer,          // presSrc
         &m_resCopiedDataBuffer,    // presDst
-        m_dataSize,                // u32CopyLength
-        0,                         // u32CopyInputOffset
-        m_nextCopiedDataOffset));  // u32CopyOutputOffset
+        m_dataSize,                         // u32CopyLength
+        0,                                  // u32CopyInputOffset
+        m_bitstreamChain.GetNextOffset())); // u32CopyOutputOffset
 
-    m_nextCopiedDataOffset += MOS_ALIGN_CEIL(m_dataSize, MHW_CACHELINE_SIZE);
+    m_bitstreamChain.Append(m_dataSize);
 
     MHW_MI_FLUSH_DW_PARAMS flushDwParams;
     MOS_ZeroMemory(&flushDwParams, sizeof(flushDwParams));
@@ -220,13 +216,13 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
     {
         if (!m_incompleteJpegScan) // The first bitstream buffer
         {
-            m_totalDataLength =
-                m_jpegScanParams->ScanHeader[0].DataOffset + m_jpegScanParams->ScanHeader[0].DataLength;
+            m_bitstreamChain.SetExpectedSize(
+                m_jpegScanParams->ScanHeader[0].DataOffset + m_jpegScanParams->ScanHeader[0].DataLength);
 
-            if (m_dataSize < m_totalDataLength)  // if the bitstream data is incomplete
+            if (m_dataSize < m_bitstreamChain.GetExpectedSize())  // if the bitstream data is incomplete
             {
                 CODECHAL_DECODE_CHK_COND_RETURN(
-                    m_totalDataLength > maxBufferSize,
+                    m_bitstreamChain.GetExpectedSize() > maxBufferSize,
                     "The bitstream size exceeds the copied data buffer size.");
 
                 CODECHAL_DECODE_CHK_COND_RETURN(
@@ -242,7 +238,7 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
                                                                   "CopiedDataBuffer"),
                         "Failed to allocate copied data Buffer.");
                 }
-                m_copiedDataBufferSize = maxBufferSize;
+                m_bitstreamChain.SetBufferSize(maxBufferSize);
 
                 // copy the bitstream buffer
                 if (m_dataSize)
@@ -263,11 +259,11 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
         else // the next bitstream buffers
         {
             CODECHAL_DECODE_CHK_COND_RETURN(
-                m_nextCopiedDataOffset + m_dataSize > m_copiedDataBufferSize,
+                !m_bitstreamChain.Fits(m_dataSize),
                 "The bitstream size exceeds the copied data buffer size.")
 
             CODECHAL_DECODE_CHK_COND_RETURN(
-                (m_nextCopiedDataOffset + m_dataSize < m_totalDataLength) && (m_dataSize & 0x3f),
+                !m_bitstreamChain.CompletesWith(m_dataSize) && (m_dataSize & 0x3f),
                 "The data size of the incomplete bitstream is not aligned with 64.");
 
             // copy the bitstream
@@ -276,7 +272,7 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
                 CODECHAL_DECODE_CHK_STATUS_RETURN(CopyDataSurface());
             }
 
-            if (m_nextCopiedDataOffset >= m_totalDataLength)
+            if (m_bitstreamChain.IsComplete())
             {
                 m_incompleteJpegScan = false;
                 m_incompletePicture = false;
@@ -290,9 +286,9 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
         {
             for (uint32_t idxScan = m_preNumScans; idxScan < m_jpegScanParams->NumScans; idxScan++)
             {
-                m_jpegScanParams->ScanHeader[idxScan].DataOffset += m_nextCopiedDataOffset;  // modify the data offset for the new incoming scan data
+                m_jpegScanParams->ScanHeader[idxScan].DataOffset += m_bitstreamChain.GetNextOffset();  // modify the data offset for the new incoming scan data
             }
-            m_totalDataLength = m_jpegScanParams->ScanHeader[m_jpegScanParams->NumScans - 1].DataOffset + m_jpegScanParams->ScanHeader[m_jpegScanParams->NumScans - 1].DataLength;
+            m_bitstreamChain.SetExpectedSize(m_jpegScanParams->ScanHeader[m_jpegScanParams->NumScans - 1].DataOffset + m_jpegScanParams->ScanHeader[m_jpegScanParams->NumScans - 1].DataLength);
             m_preNumScans     = m_jpegScanParams->NumScans;
 
             // judge whether the bitstream is complete in the first execute() call
@@ -300,7 +296,7 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
                 m_dataSize <= m_jpegScanParams->ScanHeader[0].DataOffset + m_jpegScanParams->ScanHeader[0].DataLength)
             {
                 CODECHAL_DECODE_CHK_COND_RETURN(
-                    (m_nextCopiedDataOffset + m_dataSize < m_totalDataLength) && (m_dataSize & 0x3f),
+                    !m_bitstreamChain.CompletesWith(m_dataSize) && (m_dataSize & 0x3f),
                     "The buffer size of the incomplete bitstream is not aligned with 64.");
 
                 // Allocate the copy data buffer.
@@ -312,7 +308,7 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
                                                                   "CopiedDataBuffer"),
                         "Failed to allocate copied data Buffer.");
                 }
-                m_copiedDataBufferSize = maxBufferSize;
+                m_bitstreamChain.SetBufferSize(maxBufferSize);
 
                 // copy the bitstream buffer
                 if (m_dataSize)
@@ -321,7 +317,7 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
                     m_copiedDataBufferInUse = true;
                 }
 
-                m_incompleteJpegScan = m_nextCopiedDataOffset < m_totalDataLength;
+                m_incompleteJpegScan = !m_bitstreamChain.IsComplete();
                 m_incompletePicture  = m_incompleteJpegScan || m_jpegScanParams->NumScans < m_jpegPicParams->m_totalScans;
             }
             else // the bitstream is complete
@@ -340,11 +336,11 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
         else //The next bitstream buffer of each scan
         {
             CODECHAL_DECODE_CHK_COND_RETURN(
-                m_nextCopiedDataOffset + m_dataSize > m_copiedDataBufferSize,
+                !m_bitstreamChain.Fits(m_dataSize),
                 "The bitstream size exceeds the copied data buffer size.")
 
             CODECHAL_DECODE_CHK_COND_RETURN(
-                (m_nextCopiedDataOffset + m_dataSize < m_totalDataLength) && (m_dataSize & 0x3f),
+                !m_bitstreamChain.CompletesWith(m_dataSize) && (m_dataSize & 0x3f),
                 "The data size of the incomplete bitstream is not aligned with 64.");
 
             // copy the bitstream buffer
@@ -353,7 +349,7 @@ MOS_STATUS CodechalDecodeJpeg::CheckAndCopyIncompleteBitStream()
                 CODECHAL_DECODE_CHK_STATUS_RETURN(CopyDataSurface());
             }
 
-            if (m_nextCopiedDataOffset >= m_totalDataLength)
+            if (m_bitstreamChain.IsComplete())
             {
                 m_incompleteJpegScan = false;
                 if (m_jpegScanParams->NumScans >= m_jpegPicParams->m_totalScans)
@@ -549,7 +545,7 @@ MOS_STATUS CodechalDecodeJpeg::SetFrameStates()
                 &m_resDataBuffer,
                 CodechalDbgAttr::attrBitstream,
                 "_DEC",
-                (m_copiedDataBufferInUse ? m_nextCopiedDataOffset : m_dataSize),
+                (m_copiedDataBufferInUse ? m_bitstreamChain.GetNextOffset() : m_dataSize),
                 0,
                 CODECHAL_NUM_MEDIA_STATES));
         })
@@ -698,7 +694,7 @@ MOS_STATUS CodechalDecodeJpeg::DecodeStateLevel()
     MHW_VDBOX_IND_OBJ_BASE_ADDR_PARAMS indObjBaseAddrParams;
     MOS_ZeroMemory(&indObjBaseAddrParams, sizeof(indObjBaseAddrParams));
     indObjBaseAddrParams.Mode = CODECHAL_DECODE_MODE_JPEG;
-    indObjBaseAddrParams.dwDataSize     = m_copiedDataBufferInUse ? m_nextCopiedDataOffset : m_dataSize;
+    indObjBaseAddrParams.dwDataSize     = m_copiedDataBufferInUse ? m_bitstreamChain.GetNextOffset() : m_dataSize;
     indObjBaseAddrParams.presDataBuffer = &m_resDataBuffer;
 
     // Set MFX_JPEG_PIC_STATE_CMD
@@ -230,9 +230,7 @@ protected:
 
     MOS_RESOURCE m_resDataBuffer;          //!< Handle of bitstream buffer
     MOS_RESOURCE m_resCopiedDataBuffer;    //!< The internal buffer to store copied data
-    uint32_t     m_copiedDataBufferSize;   //!< The max size of the internal copied buffer
-    uint32_t     m_nextCopiedDataOffset;   //!< The offset of the next bitstream data used for copying
-    uint32_t     m_totalDataLength;        //!< The total data length
+    CodechalDecodeBitstreamChain m_bitstreamChain;  //!< Chunks copied into the internal copied buffer
     uint32_t     m_preNumScans;            //!< Record the previous scan number before the new scan comes
     bool         m_copiedDataBufferInUse;  //!< Flag to indicate whether the copy data buffer is used
 
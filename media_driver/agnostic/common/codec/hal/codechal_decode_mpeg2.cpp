@@ -55,7 +55,7 @@ bool CodechalDecodeMpeg2::DetectSliceError(
     bool                            firstValidSlice)
 {
     bool                        result         = false;
-    CODECHAL_VLD_SLICE_RECORD   currSliceRecord = m_vldSliceRecord[slcNum];
+    const CODECHAL_VLD_SLICE_RECORD &currSliceRecord = m_vldSliceRecord[slcNum];
 
     if (currSliceRecord.dwLength == 0 || currSliceRecord.dwLength > (uint32_t)(1 << (sizeof(uint32_t) * 8 - 1)))
     {
@@ -160,20 +160,26 @@ MOS_STATUS CodechalDecodeMpeg2::InsertDummySlices(
     bool isLastSlice                   = false;
     uint16_t expectedEndMB                 = m_picWidthInMb * m_picHeightInMb;
 
+    // The dummy bitstream holds a single intra MB, so the gap is covered by a run of
+    // one-MB slices. Only the MB position changes within the run.
     CodecDecodeMpeg2SliceParams slc;
     MOS_ZeroMemory(&slc, sizeof(CodecDecodeMpeg2SliceParams));
+    slc.m_macroblockOffset              = 6;
+    slc.m_quantiserScaleCode            = 10;
+    slc.m_numMbsForSlice                = 1;
+    mpeg2SliceState.pMpeg2SliceParams   = &slc;
+    mpeg2SliceState.bLastSlice          = false;
+
+    uint16_t horizontalPosition = startMB % m_picWidthInMb;
+    uint16_t verticalPosition   = startMB / m_picWidthInMb;
 
     while (startMB < endMB)
     {
-        slc.m_macroblockOffset           = 6;
-        slc.m_sliceHorizontalPosition     = startMB % m_picWidthInMb;
-        slc.m_sliceVerticalPosition       = startMB / m_picWidthInMb;
-        slc.m_quantiserScaleCode        = 10;
-        slc.m_numMbsForSlice              = 1;
+        slc.m_sliceHorizontalPosition     = horizontalPosition;
+        slc.m_sliceVerticalPosition       = verticalPosition;
 
         isLastSlice = ((startMB + 1) == expectedEndMB);
 
-        mpeg2SliceState.pMpeg2SliceParams       = &slc;
         mpeg2SliceState.dwSliceStartMbOffset    = startMB;
         mpeg2SliceState.bLastSlice              = isLastSlice;
 
@@ -183,6 +189,11 @@ MOS_STATUS CodechalDecodeMpeg2::InsertDummySlices(
             &mpeg2SliceState));
 
         startMB++;
+        if (++horizontalPosition == m_picWidthInMb)
+        {
+            horizontalPosition = 0;
+            verticalPosition++;
+        }
     }
 
     // restore Cp state
@@ -1220,98 +1231,14 @@ void CodechalDecodeMpeg2::PackMotionVectors(
 {
     CodecDecodeMpeg2MbParmas *mbParams = mpeg2MbState->pMBParams;
 
-    uint16_t motionType     = mbParams->MBType.m_motionType;
-    uint16_t intelMotionType = CODECHAL_MPEG2_IMT_NONE;
-
-    //convert to Intel Motion Type
-    if (pic_flag == PICTURE_FRAME)
-    {
-        switch(motionType)
-        {
-        case CodechalDecodeMcFrame:
-            intelMotionType = CODECHAL_MPEG2_IMT_FRAME_FRAME;
-            break;
-        case CodechalDecodeMcField:
-            intelMotionType = CODECHAL_MPEG2_IMT_FRAME_FIELD;
-            break;
-        case CodechalDecodeMcDmv:
-            intelMotionType = CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME;
-            break;
-        default:
-            break;
-        }
-    }
-    else // must be field picture...
-    {
-        switch(motionType)
-        {
-        case CodechalDecodeMcField:
-            intelMotionType = CODECHAL_MPEG2_IMT_FIELD_FIELD;
-            break;
-        case CodechalDecodeMcDmv:
-            intelMotionType = CODECHAL_MPEG2_IMT_FIELD_DUAL_PRIME;
-            break;
-        case CodechalDecodeMc16x8:
-            intelMotionType = CODECHAL_MPEG2_IMT_16X8;
-            break;
-        default:
-            break;
-        }
-    }
-
-    int16_t *mv = mbParams->m_motionVectors;
-
-    switch (intelMotionType)
-    {
-    case CODECHAL_MPEG2_IMT_16X8:
-    case CODECHAL_MPEG2_IMT_FIELD_FIELD:
-    case CODECHAL_MPEG2_IMT_FRAME_FRAME:
-    case CODECHAL_MPEG2_IMT_FIELD_DUAL_PRIME:
-        mpeg2MbState->sPackedMVs0[0] = (short)mv[CodechalDecodeRstFirstForwHorz];
-        mpeg2MbState->sPackedMVs0[1] = (short)mv[CodechalDecodeRstFirstForwVert];
-        mpeg2MbState->sPackedMVs0[2] = (short)mv[CodechalDecodeRstFirstBackHorz];
-        mpeg2MbState->sPackedMVs0[3] = (short)mv[CodechalDecodeRstFirstBackVert];
-        break;
-
-    case CODECHAL_MPEG2_IMT_FRAME_FIELD:
-    case CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME:
-        mpeg2MbState->sPackedMVs0[0] = (short)mv[CodechalDecodeRstFirstForwHorz];
-        mpeg2MbState->sPackedMVs0[1] = (short)(mv[CodechalDecodeRstFirstForwVert] >> 1) ;
-        mpeg2MbState->sPackedMVs0[2] = (short)mv[CodechalDecodeRstFirstBackHorz];
-        mpeg2MbState->sPackedMVs0[3] = (short)(mv[CodechalDecodeRstFirstBackVert] >> 1);
-        break;
-
-    default:
-        break;
-    }
-
-    switch (intelMotionType)
-    {
-    case CODECHAL_MPEG2_IMT_16X8:
-        mpeg2MbState->sPackedMVs1[0] = (short)mv[CodechalDecodeRstSecndForwHorz];
-        mpeg2MbState->sPackedMVs1[1] = (short)mv[CodechalDecodeRstSecndForwVert];
-        mpeg2MbState->sPackedMVs1[2] = (short)mv[CodechalDecodeRstSecndBackHorz];
-        mpeg2MbState->sPackedMVs1[3] = (short)mv[CodechalDecodeRstSecndBackVert];
-        break;
-
-    case CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME:
-        mpeg2MbState->sPackedMVs1[0] = (short)mv[CodechalDecodeRstFirstForwHorz];
-        mpeg2MbState->sPackedMVs1[1] = (short)(mv[CodechalDecodeRstFirstForwVert] >> 1);
-        mpeg2MbState->sPackedMVs1[2] = (short)mv[CodechalDecodeRstSecndBackHorz];
-        mpeg2MbState->sPackedMVs1[3] = (short)(mv[CodechalDecodeRstSecndBackVert] >> 1);
-        break;
-
-    case CODECHAL_MPEG2_IMT_FRAME_FIELD:
-        mpeg2MbState->sPackedMVs1[0] = (short)mv[CodechalDecodeRstSecndForwHorz];
-        mpeg2MbState->sPackedMVs1[1] = (short)(mv[CodechalDecodeRstSecndForwVert] >> 1);
-        mpeg2MbState->sPackedMVs1[2] = (short)mv[CodechalDecodeRstSecndBackHorz];
-        mpeg2MbState->sPackedMVs1[3] = (short)(mv[CodechalDecodeRstSecndBackVert] >> 1);
-        break;
-
-    default:
-        break;
-    }
+    CodechalDecodeMpeg2PackMotionVectors(
+        pic_flag == PICTURE_FRAME,
+        mbParams->MBType.m_motionType,
+        mbParams->m_motionVectors,
+        mpeg2MbState->sPackedMVs0,
+        mpeg2MbState->sPackedMVs1);
 }
+
 MOS_STATUS CodechalDecodeMpeg2::InsertSkippedMacroblocks(
     PMHW_BATCH_BUFFER               batchBuffer,
     PMHW_VDBOX_MPEG2_MB_STATE       params,
@@ -1420,6 +1347,8 @@ MOS_STATUS CodechalDecodeMpeg2::MacroblockLevel()
     else
     {
         uint16_t expectedMBAddress = (m_incompletePicture) ? m_lastMbAddress : 0;
+        bool     interPicture      = (mpeg2MbState.wPicCodingType != I_TYPE);
+        CODEC_PICTURE_FLAG picFlag = m_picParams->m_currPic.PicFlags;
 
         for (uint16_t mbcount = 0; mbcount < m_numMacroblocks; mbcount++)
         {
@@ -1441,16 +1370,17 @@ MOS_STATUS CodechalDecodeMpeg2::MacroblockLevel()
 
             //common field for MBs in I picture and PB picture .
             mpeg2MbState.pMBParams   = &m_mbParams[mbcount];
-            mpeg2MbState.dwDCTLength = 0;
+            uint32_t dctLength = 0;
             for (uint32_t i = 0; i < CODEC_NUM_BLOCK_PER_MB; i++)
             {
-                mpeg2MbState.dwDCTLength += m_mbParams[mbcount].m_numCoeff[i];
+                dctLength += m_mbParams[mbcount].m_numCoeff[i];
             }
+            mpeg2MbState.dwDCTLength = dctLength;
 
             mpeg2MbState.dwITCoffDataAddrOffset = m_copiedDataOffset + (m_mbParams[mbcount].m_mbDataLoc << 2);  // byte offset
 
             //only for MB in PB picture.
-            if (mpeg2MbState.wPicCodingType != I_TYPE)
+            if (interPicture)
             {
                 bool intraMB = mpeg2MbState.pMBParams->MBType.m_intraMb? true: false;
 
@@ -1459,7 +1389,7 @@ MOS_STATUS CodechalDecodeMpeg2::MacroblockLevel()
                 if ((!intraMB) && (mpeg2MbState.pMBParams->MBType.m_value &
                     (CODECHAL_DECODE_MPEG2_MB_MOTION_BACKWARD | CODECHAL_DECODE_MPEG2_MB_MOTION_FORWARD)))
                 {
-                    PackMotionVectors(m_picParams->m_currPic.PicFlags, &mpeg2MbState);
+                    PackMotionVectors(picFlag, &mpeg2MbState);
                 }
             }
 
@@ -1469,7 +1399,7 @@ MOS_STATUS CodechalDecodeMpeg2::MacroblockLevel()
                 &batchBuffer,
                 &mpeg2MbState));
 
-            if (mpeg2MbState.wPicCodingType != I_TYPE && m_mbParams[mbcount].m_mbSkipFollowing)
+            if (interPicture && m_mbParams[mbcount].m_mbSkipFollowing)
             {
                 uint16_t skippedMBs    = m_mbParams[mbcount].m_mbSkipFollowing;
                 uint16_t skippedMBSart = m_mbParams[mbcount].m_mbAddr + 1;
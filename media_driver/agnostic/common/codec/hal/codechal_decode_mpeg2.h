@@ -29,6 +29,7 @@
 #define __CODECHAL_DECODER_MPEG2_H__
 
 #include "codechal_decoder.h"
+#include "codechal_decode_mpeg2_mv_pack.h"
 
 //!
 //! \def CODECHAL_DECODE_MPEG2_MAXIMUM_BATCH_BUFFERS
@@ -66,21 +67,6 @@
 //!
 #define CODECHAL_DECODE_MPEG2_MB_MOTION_BACKWARD        4   //!< Bit 2
 
-//!
-//! \enum CODECHAL_MPEG2_IMT_TYPE
-//! \brief Mpeg2 image type
-//!
-typedef enum _CODECHAL_MPEG2_IMT_TYPE
-{
-    CODECHAL_MPEG2_IMT_NONE = 0,         //!< triple GFXBlocks
-    CODECHAL_MPEG2_IMT_FRAME_FRAME,      //!< triple
-    CODECHAL_MPEG2_IMT_FIELD_FIELD,      //!< triple
-    CODECHAL_MPEG2_IMT_FIELD_DUAL_PRIME, //!< triple
-    CODECHAL_MPEG2_IMT_FRAME_FIELD,      //!< hex
-    CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME, //!< hex
-    CODECHAL_MPEG2_IMT_16X8              //!< hex
-} CODECHAL_MPEG2_IMT_TYPE;
-
 typedef class CodechalDecodeMpeg2 *PCODECHAL_DECODE_MPEG2_STATE;
 
 //!
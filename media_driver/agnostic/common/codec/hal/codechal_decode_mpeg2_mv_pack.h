@@ -0,0 +1,124 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     codechal_decode_mpeg2_mv_pack.h
+//! \brief    Defines the motion vector packing of MPEG2 IT mode macroblocks.
+//!
+
+#ifndef __CODECHAL_DECODE_MPEG2_MV_PACK_H__
+#define __CODECHAL_DECODE_MPEG2_MV_PACK_H__
+
+#include "mos_defs.h"
+
+//!
+//! \enum CODECHAL_MPEG2_IMT_TYPE
+//! \brief Mpeg2 image type
+//!
+typedef enum _CODECHAL_MPEG2_IMT_TYPE
+{
+    CODECHAL_MPEG2_IMT_NONE = 0,         //!< triple GFXBlocks
+    CODECHAL_MPEG2_IMT_FRAME_FRAME,      //!< triple
+    CODECHAL_MPEG2_IMT_FIELD_FIELD,      //!< triple
+    CODECHAL_MPEG2_IMT_FIELD_DUAL_PRIME, //!< triple
+    CODECHAL_MPEG2_IMT_FRAME_FIELD,      //!< hex
+    CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME, //!< hex
+    CODECHAL_MPEG2_IMT_16X8              //!< hex
+} CODECHAL_MPEG2_IMT_TYPE;
+
+//!
+//! \struct CODECHAL_DECODE_MPEG2_MV_PACK_LAYOUT
+//! \brief  Describes how motion vectors are packed for one Intel motion type
+//!
+struct CODECHAL_DECODE_MPEG2_MV_PACK_LAYOUT
+{
+    bool        packedMVs0Valid;    //!< sPackedMVs0 is written
+    bool        packedMVs1Valid;    //!< sPackedMVs1 is written
+    uint8_t     packedMVs0Src[4];   //!< Source indexes into m_motionVectors for sPackedMVs0
+    uint8_t     packedMVs1Src[4];   //!< Source indexes into m_motionVectors for sPackedMVs1
+    uint8_t     vertShift;          //!< Right shift applied to vertical components
+};
+
+// Intel motion type indexed by [field picture][MPEG2 motion type]
+static const uint8_t CODECHAL_DECODE_MPEG2_IntelMotionType[2][4] =
+{
+    {CODECHAL_MPEG2_IMT_NONE, CODECHAL_MPEG2_IMT_FRAME_FIELD, CODECHAL_MPEG2_IMT_FRAME_FRAME, CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME},
+    {CODECHAL_MPEG2_IMT_NONE, CODECHAL_MPEG2_IMT_FIELD_FIELD, CODECHAL_MPEG2_IMT_16X8,        CODECHAL_MPEG2_IMT_FIELD_DUAL_PRIME}
+};
+
+// Source motion vector indexes for the two packed MV sets, indexed by Intel motion type.
+// Vertical components are halved for frame pictures using field based prediction.
+static const CODECHAL_DECODE_MPEG2_MV_PACK_LAYOUT CODECHAL_DECODE_MPEG2_MvPackLayouts[] =
+{
+    {false, false, {0, 0, 0, 0}, {0, 0, 0, 0}, 0}, // CODECHAL_MPEG2_IMT_NONE
+    {true,  false, {0, 1, 2, 3}, {0, 0, 0, 0}, 0}, // CODECHAL_MPEG2_IMT_FRAME_FRAME
+    {true,  false, {0, 1, 2, 3}, {0, 0, 0, 0}, 0}, // CODECHAL_MPEG2_IMT_FIELD_FIELD
+    {true,  false, {0, 1, 2, 3}, {0, 0, 0, 0}, 0}, // CODECHAL_MPEG2_IMT_FIELD_DUAL_PRIME
+    {true,  true,  {0, 1, 2, 3}, {4, 5, 6, 7}, 1}, // CODECHAL_MPEG2_IMT_FRAME_FIELD
+    {true,  true,  {0, 1, 2, 3}, {0, 1, 6, 7}, 1}, // CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME
+    {true,  true,  {0, 1, 2, 3}, {4, 5, 6, 7}, 0}  // CODECHAL_MPEG2_IMT_16X8
+};
+
+//!
+//! \brief    Pack motion vectors of one macroblock for MFD_IT_OBJECT
+//! \param    [in] framePicture
+//!           true for frame picture, false for field picture
+//! \param    [in] motionType
+//!           MPEG2 motion type of macroblock
+//! \param    [in] mv
+//!           Motion vectors of macroblock, [2][2][2] array mapped as [8]
+//! \param    [out] packedMVs0
+//!           First packed MV set, left untouched if not used
+//! \param    [out] packedMVs1
+//!           Second packed MV set, left untouched if not used
+//! \return   void
+//!
+static inline void CodechalDecodeMpeg2PackMotionVectors(
+    bool            framePicture,
+    uint32_t        motionType,
+    const int16_t   *mv,
+    int16_t         *packedMVs0,
+    int16_t         *packedMVs1)
+{
+    //convert to Intel Motion Type
+    uint8_t intelMotionType = CODECHAL_DECODE_MPEG2_IntelMotionType[framePicture ? 0 : 1][motionType & 3];
+
+    const CODECHAL_DECODE_MPEG2_MV_PACK_LAYOUT &layout =
+        CODECHAL_DECODE_MPEG2_MvPackLayouts[intelMotionType];
+
+    if (layout.packedMVs0Valid)
+    {
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            packedMVs0[i] = (short)(mv[layout.packedMVs0Src[i]] >> ((i & 1) ? layout.vertShift : 0));
+        }
+    }
+
+    if (layout.packedMVs1Valid)
+    {
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            packedMVs1[i] = (short)(mv[layout.packedMVs1Src[i]] >> ((i & 1) ? layout.vertShift : 0));
+        }
+    }
+}
+
+#endif  // __CODECHAL_DECODE_MPEG2_MV_PACK_H__
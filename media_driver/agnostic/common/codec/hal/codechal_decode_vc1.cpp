@@ -28,6 +28,7 @@
 
 #include "codechal_decoder.h"
 #include "codechal_decode_vc1.h"
+#include "codechal_decode_vc1_vlc.h"
 #include "codechal_secure_decode_interface.h"
 #include "codechal_mmc_decode_vc1.h"
 #include "hal_oca_interface.h"
@@ -208,101 +209,6 @@ static const uint32_t CODECHAL_DECODE_VC1_VldBitplaneModeTable[] =
     (uint32_t)-1
 };
 
-static const uint32_t CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable[] =
-{
-    13, /* max bits */
-    1,  /* 1-bit codes */
-    1, 0,
-    0,  /* 2-bit codes */
-    0,  /* 3-bit codes */
-    6,  /* 4-bit codes */
-    2, 1,
-    3, 2,
-    4, 4,
-    5, 8,
-
-    6, 16,
-    7, 32,
-    0,  /* 5-bit codes */
-    1,  /* 6-bit codes */
-    (3 << 1) | 1, 63,
-    0,  /* 7-bit codes */
-    15, /* 8-bit codes */
-    0, 3,
-    1, 5,
-    2, 6,
-    3, 9,
-
-    4, 10,
-    5, 12,
-    6, 17,
-    7, 18,
-
-    8, 20,
-    9, 24,
-    10, 33,
-    11, 34,
-
-    12, 36,
-    13, 40,
-    14, 48,
-    6, /* 9-bit codes */
-    (3 << 4) | 7, 31,
-    (3 << 4) | 6, 47,
-    (3 << 4) | 5, 55,
-    (3 << 4) | 4, 59,
-
-    (3 << 4) | 3, 61,
-    (3 << 4) | 2, 62,
-    20, /* 10-bit codes */
-    (1 << 6) | 11, 11,
-    (1 << 6) | 7, 7,
-    (1 << 6) | 13, 13,
-    (1 << 6) | 14, 14,
-
-    (1 << 6) | 19, 19,
-    (1 << 6) | 21, 21,
-    (1 << 6) | 22, 22,
-    (1 << 6) | 25, 25,
-
-    (1 << 6) | 26, 26,
-    (1 << 6) | 28, 28,
-    (1 << 6) | 3, 35,
-    (1 << 6) | 5, 37,
-
-    (1 << 6) | 6, 38,
-    (1 << 6) | 9, 41,
-    (1 << 6) | 10, 42,
-    (1 << 6) | 12, 44,
-
-    (1 << 6) | 17, 49,
-    (1 << 6) | 18, 50,
-    (1 << 6) | 20, 52,
-    (1 << 6) | 24, 56,
-    0,  /* 11-bit codes */
-    0,  /* 12-bit codes */
-    15, /* 13-bit codes */
-    (3 << 8) | 14, 15,
-    (3 << 8) | 13, 23,
-    (3 << 8) | 12, 27,
-    (3 << 8) | 11, 29,
-
-    (3 << 8) | 10, 30,
-    (3 << 8) | 9, 39,
-    (3 << 8) | 8, 43,
-    (3 << 8) | 7, 45,
-
-    (3 << 8) | 6, 46,
-    (3 << 8) | 5, 51,
-    (3 << 8) | 4, 53,
-    (3 << 8) | 3, 54,
-
-    (3 << 8) | 2, 57,
-    (3 << 8) | 1, 58,
-    (3 << 8) | 0, 60,
-    (uint32_t)-1
-};
-
 static const uint32_t CODECHAL_DECODE_VC1_VldPictureTypeTable[] =
 {
     4,  /* max bits */
@@ -1058,9 +964,7 @@ MOS_STATUS CodechalDecodeVc1::FormatUnequalFieldPicture(
 
     CODECHAL_DECODE_FUNCTION_ENTER;
 
-    uint32_t uvblockWidth = 16;
     uint32_t uvblockHeight = 16;
-    uint32_t uvblockSize = uvblockWidth * uvblockHeight;
     uint32_t frameHeight = MOS_ALIGN_CEIL(m_height, 16);
     uint32_t ysize = srcSurface.dwPitch * MOS_ALIGN_CEIL(frameHeight, MOS_YTILE_H_ALIGNMENT);
 
@@ -1099,58 +1003,17 @@ MOS_STATUS CodechalDecodeVc1::FormatUnequalFieldPicture(
     }
 
     // Copy 1 MB row of UV
-    uint32_t srcOffset, dstOffset;
-    for (uint32_t x = 0; x < srcSurface.dwPitch; x += uvblockWidth)
-    {
-        if (pack)
-        {
-            srcOffset = LinearToYTiledAddress(
-                x,
-                frameHeight + MOS_YTILE_H_ALIGNMENT,
-                srcSurface.dwPitch);
-            dstOffset = LinearToYTiledAddress(
-                x,
-                frameHeight,
-                dstSurface.dwPitch);
-        }
-        else
-        {
-            srcOffset = LinearToYTiledAddress(
-                x,
-                frameHeight,
-                srcSurface.dwPitch);
-            dstOffset = LinearToYTiledAddress(
-                x,
-                frameHeight + MOS_YTILE_H_ALIGNMENT,
-                dstSurface.dwPitch);
-        }
-
-        if (m_hwInterface->m_noHuC)
-        {
-            CodechalDataCopyParams dataCopyParams;
-            MOS_ZeroMemory(&dataCopyParams, sizeof(CodechalDataCopyParams));
-            dataCopyParams.srcResource = &srcSurface.OsResource;
-            dataCopyParams.srcSize = uvblockSize;
-            dataCopyParams.srcOffset = srcOffset;
-            dataCopyParams.dstResource = &dstSurface.OsResource;
-            dataCopyParams.dstSize = frameSize;
-            dataCopyParams.dstOffset = dstOffset;
-
-            CODECHAL_DECODE_CHK_STATUS_RETURN(m_hwInterface->CopyDataSourceWithDrv(&dataCopyParams));
-        }
-        else
-        {
-            // Stream object params
-            CODECHAL_DECODE_CHK_STATUS_RETURN(HucCopy(
-                &cmdBuffer,                 // pCmdBuffer
-                &srcSurface.OsResource,    // presSrc
-                &dstSurface.OsResource,    // presDst
-                uvblockSize,             // u32CopyLength
-                srcOffset,               // u32CopyInputOffset
-                dstOffset));             // u32CopyOutputOffset
-        }
-    }
+    CODECHAL_DECODE_CHK_STATUS_RETURN(CopyYTiledRows(
+        &cmdBuffer,
+        &srcSurface,
+        pack ? (frameHeight + MOS_YTILE_H_ALIGNMENT) : frameHeight,
+        &dstSurface,
+        pack ? frameHeight : (frameHeight + MOS_YTILE_H_ALIGNMENT),
+        frameSize,
+        srcSurface.dwPitch,
+        uvblockHeight));
 
+    uint32_t srcOffset, dstOffset;
     uint32_t uvsize = srcSurface.dwPitch * MOS_ALIGN_CEIL(((frameHeight / 2) - uvblockHeight), MOS_YTILE_H_ALIGNMENT);
 
     if (pack)
@@ -1687,6 +1550,28 @@ uint32_t CodechalDecodeVc1::GetVLC(const uint32_t *table)
     return(CODECHAL_DECODE_VC1_EOS);
 }
 
+MOS_STATUS CodechalDecodeVc1::GetTileVLC(uint32_t &value)
+{
+    static uint16_t lut[1 << CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS] = {};
+    static bool     lutBuilt = CodechalDecodeVc1BuildVlcLut(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, lut);
+    MOS_UNUSED(lutBuilt);
+
+    CODECHAL_DECODE_ASSERT(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable[0] == CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS);
+
+    uint16_t entry = lut[PeekBits(CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS)];
+    if (0 == entry)
+    {
+        CODECHAL_DECODE_ASSERTMESSAGE("Code is not in VLC table.");
+        return MOS_STATUS_UNKNOWN;
+    }
+
+    // Same as GetVLC(), end of stream is detected by the following read.
+    SkipBits(entry >> 8);
+    value = entry & 0xFF;
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS CodechalDecodeVc1::InitialiseBitstream(
     uint8_t*                           buffer,
     uint32_t                           length,
@@ -1738,8 +1623,21 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm2Mode()
         count--;
     }
 
-    for (uint32_t i = 0; i < count / 2; i++)
+    uint32_t symbols = count / 2;
+    while (symbols)
     {
+        // Decode symbols within current cache word and consume them in one go. Not
+        // crossing the word keeps end of stream detected as reading bit by bit.
+        uint32_t used = CodechalDecodeVc1Norm2ScanWord(
+            *m_bitstream.pu32Cache, m_bitstream.iBitOffset, symbols);
+
+        if (used > 0)
+        {
+            CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBits(used, value));
+            continue;
+        }
+
+        // Symbol crossing cache words
         CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
         if (value)
         {
@@ -1749,6 +1647,7 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm2Mode()
                 CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
             }
         }
+        symbols--;
     }
 
     return eStatus;
@@ -1779,7 +1678,7 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm6Mode()
         {
             for (uint32_t i = 0; i < widthInTiles; i++)
             {
-                CODECHAL_DECODE_CHK_STATUS_RETURN(GetVLC(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, value));
+                CODECHAL_DECODE_CHK_STATUS_RETURN(GetTileVLC(value));
             }
         }
 
@@ -1795,7 +1694,7 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm6Mode()
         {
             for (uint32_t i = 0; i < widthInTiles; i++)
             {
-                CODECHAL_DECODE_CHK_STATUS_RETURN(GetVLC(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, value));
+                CODECHAL_DECODE_CHK_STATUS_RETURN(GetTileVLC(value));
             }
         }
 
@@ -849,6 +849,17 @@ private:
     //!
     uint32_t GetVLC(const uint32_t *table);
 
+    //!
+    //! \brief    Get VLC of Norm-6 tile from VC1 bitstream by lookup table
+    //! \details  Decode the code in one table access instead of walking
+    //!           the VLC table, with the same bitstream consumption as GetVLC
+    //! \param    [out] value
+    //!           Decoded tile value
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS GetTileVLC(uint32_t &value);
+
     //!
     //! \brief    Read bits from VC1 bitstream and don't update bitstream pointer
     //! \param    [in] bitsRead
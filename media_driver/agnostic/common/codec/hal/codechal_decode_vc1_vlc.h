@@ -0,0 +1,197 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     codechal_decode_vc1_vlc.h
+//! \brief    Defines the Norm-6 tile VLC table and bitplane symbol helpers for VC1 decode.
+//!
+
+#ifndef __CODECHAL_DECODE_VC1_VLC_H__
+#define __CODECHAL_DECODE_VC1_VLC_H__
+
+#include "mos_defs.h"
+
+#define CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS      13
+
+static const uint32_t CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable[] =
+{
+    13, /* max bits */
+    1,  /* 1-bit codes */
+    1, 0,
+    0,  /* 2-bit codes */
+    0,  /* 3-bit codes */
+    6,  /* 4-bit codes */
+    2, 1,
+    3, 2,
+    4, 4,
+    5, 8,
+
+    6, 16,
+    7, 32,
+    0,  /* 5-bit codes */
+    1,  /* 6-bit codes */
+    (3 << 1) | 1, 63,
+    0,  /* 7-bit codes */
+    15, /* 8-bit codes */
+    0, 3,
+    1, 5,
+    2, 6,
+    3, 9,
+
+    4, 10,
+    5, 12,
+    6, 17,
+    7, 18,
+
+    8, 20,
+    9, 24,
+    10, 33,
+    11, 34,
+
+    12, 36,
+    13, 40,
+    14, 48,
+    6, /* 9-bit codes */
+    (3 << 4) | 7, 31,
+    (3 << 4) | 6, 47,
+    (3 << 4) | 5, 55,
+    (3 << 4) | 4, 59,
+
+    (3 << 4) | 3, 61,
+    (3 << 4) | 2, 62,
+    20, /* 10-bit codes */
+    (1 << 6) | 11, 11,
+    (1 << 6) | 7, 7,
+    (1 << 6) | 13, 13,
+    (1 << 6) | 14, 14,
+
+    (1 << 6) | 19, 19,
+    (1 << 6) | 21, 21,
+    (1 << 6) | 22, 22,
+    (1 << 6) | 25, 25,
+
+    (1 << 6) | 26, 26,
+    (1 << 6) | 28, 28,
+    (1 << 6) | 3, 35,
+    (1 << 6) | 5, 37,
+
+    (1 << 6) | 6, 38,
+    (1 << 6) | 9, 41,
+    (1 << 6) | 10, 42,
+    (1 << 6) | 12, 44,
+
+    (1 << 6) | 17, 49,
+    (1 << 6) | 18, 50,
+    (1 << 6) | 20, 52,
+    (1 << 6) | 24, 56,
+    0,  /* 11-bit codes */
+    0,  /* 12-bit codes */
+    15, /* 13-bit codes */
+    (3 << 8) | 14, 15,
+    (3 << 8) | 13, 23,
+    (3 << 8) | 12, 27,
+    (3 << 8) | 11, 29,
+
+    (3 << 8) | 10, 30,
+    (3 << 8) | 9, 39,
+    (3 << 8) | 8, 43,
+    (3 << 8) | 7, 45,
+
+    (3 << 8) | 6, 46,
+    (3 << 8) | 5, 51,
+    (3 << 8) | 4, 53,
+    (3 << 8) | 3, 54,
+
+    (3 << 8) | 2, 57,
+    (3 << 8) | 1, 58,
+    (3 << 8) | 0, 60,
+    (uint32_t)-1
+};
+
+//!
+//! \brief    Build lookup table from VLC table
+//! \details  Lookup table is indexed by the next max bits of bitstream, and
+//!           each entry is (code length << 8) | value, or 0 for invalid code.
+//!           Entries are filled in the order GetVLC() searches the VLC table,
+//!           so lookup result is the same as table walk.
+//! \param    [in] table
+//!           Pointer to VLC Table
+//! \param    [out] lut
+//!           Pointer to lookup table with (1 << max bits) entries
+//! \return   bool
+//!           true if built
+//!
+static inline bool CodechalDecodeVc1BuildVlcLut(const uint32_t *table, uint16_t *lut)
+{
+    uint32_t maxCodeLength = table[0];
+    uint32_t index         = 1;
+
+    for (uint32_t codeLength = 1; codeLength <= maxCodeLength; codeLength++)
+    {
+        uint32_t subtableSize = table[index++];
+        while (subtableSize--)
+        {
+            uint32_t code  = table[index++];
+            uint32_t value = table[index++];
+            uint32_t first = code << (maxCodeLength - codeLength);
+            uint32_t last  = first + (1 << (maxCodeLength - codeLength));
+            for (uint32_t i = first; i < last; i++)
+            {
+                if (0 == lut[i])
+                {
+                    lut[i] = (uint16_t)((codeLength << 8) | value);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+//!
+//! \brief    Scan Norm-2 symbols within one bitstream cache word
+//! \details  Symbols are 0, 100, 101 and 11. Only symbols whose leading 3 bits
+//!           are inside the word are scanned, the caller reads the rest bit by bit.
+//! \param    [in] word
+//!           Current cache word
+//! \param    [in] bitsLeft
+//!           Number of unread bits in the word
+//! \param    [in, out] symbols
+//!           Number of symbols to decode, decreased by the scanned ones
+//! \return   uint32_t
+//!           Number of bits taken by the scanned symbols
+//!
+static inline uint32_t CodechalDecodeVc1Norm2ScanWord(uint32_t word, int32_t bitsLeft, uint32_t &symbols)
+{
+    // Code length of symbol indexed by its leading 3 bits: 0xx, 10x and 11x.
+    static const uint8_t codeLength[8] = {1, 1, 1, 1, 3, 3, 2, 2};
+
+    int32_t used = 0;
+    while (symbols && bitsLeft - used >= 3)
+    {
+        used += codeLength[(word >> (bitsLeft - used - 3)) & 0x7];
+        symbols--;
+    }
+
+    return (uint32_t)used;
+}
+
+#endif  // __CODECHAL_DECODE_VC1_VLC_H__
@@ -36,70 +36,14 @@
 #include "codechal_debug.h"
 #endif
 
-void Vp8EntropyState::DecodeFill()
-{
-    int32_t        shift       = m_bdValueSize - 8 - (m_count + 8);
-    uint32_t       bytesLeft   = (uint32_t)(m_bufferEnd - m_buffer);
-    uint32_t       bitsLeft   = bytesLeft * CHAR_BIT;
-    int32_t        num         = (int32_t)(shift + CHAR_BIT - bitsLeft);
-    int32_t        loopEnd     = 0;
-
-    if (num >= 0)
-    {
-        m_count += m_lotsOfBits;
-        loopEnd = num;
-    }
-
-    if (num < 0 || bitsLeft)
-    {
-        while (shift >= loopEnd)
-        {
-            m_count += CHAR_BIT;
-            m_value |= (uint32_t)*m_buffer << shift;
-            ++m_buffer;
-            shift -= CHAR_BIT;
-        }
-    }
-}
-
 uint32_t Vp8EntropyState::DecodeBool(int32_t probability)
 {
-    uint32_t split     = 1 + (((m_range - 1) * probability) >> 8);
-    uint32_t bigSplit  = (uint32_t)split << (m_bdValueSize - 8);
-    uint32_t origRange = m_range;
-    m_range            = split;
-
-    uint32_t bit = 0;
-    if (m_value >= bigSplit)
-    {
-        m_range = origRange - split;
-        m_value = m_value - bigSplit;
-        bit = 1;
-    }
-
-    int32_t shift = Norm[m_range];
-    m_range <<= shift;
-    m_value <<= shift;
-    m_count -= shift;
-
-    if (m_count < 0)
-    {
-        DecodeFill();
-    }
-
-    return bit;
+    return m_boolDecoder.DecodeBool(probability);
 }
 
 int32_t Vp8EntropyState::DecodeValue(int32_t bits)
 {
-    int32_t retValue = 0;
-
-    for (int32_t iBit = bits - 1; iBit >= 0; iBit--)
-    {
-        retValue |= (DecodeBool(0x80) << iBit);
-    }
-
-    return retValue;
+    return m_boolDecoder.DecodeValue(bits);
 }
 
 void Vp8EntropyState::ParseFrameHeadInit()
@@ -138,20 +82,7 @@ void Vp8EntropyState::ParseFrameHeadInit()
 
 int32_t Vp8EntropyState::StartEntropyDecode()
 {
-    m_bufferEnd = m_dataBufferEnd;
-    m_buffer    = m_dataBuffer;
-    m_value     = 0;
-    m_count     = -8;
-    m_range     = 255;
-
-    if ((m_bufferEnd - m_buffer) > 0 && m_buffer == nullptr)
-    {
-        return 1;
-    }
-
-    DecodeFill();
-
-    return 0;
+    return m_boolDecoder.Start(m_dataBuffer, m_dataBufferEnd);
 }
 
 void Vp8EntropyState::SegmentationEnabled()
@@ -553,18 +484,9 @@ MOS_STATUS Vp8EntropyState::ParseFrameHead(PCODEC_VP8_PIC_PARAMS vp8PicParams)
         m_frameHead->iRefreshLastFrame = false;
     }
 
-    for (int32_t i = 0; i < VP8_BLOCK_TYPES; i++)
-        for (int32_t j = 0; j < VP8_COEF_BANDS; j++)
-            for (int32_t k = 0; k < VP8_PREV_COEF_CONTEXTS; k++)
-                for (int32_t l = 0; l < VP8_ENTROPY_NODES; l++)
-                {
-                    uint8_t *const p = m_frameHead->FrameContext.CoefProbs[i][j][k] + l;
-
-                    if (DecodeBool(CoefUpdateProbs[i][j][k][l]))
-                    {
-                        *p = (uint8_t)DecodeValue(8);
-                    }
-                }
+    static_assert(sizeof(CoefUpdateProbs) == sizeof(m_frameHead->FrameContext.CoefProbs),
+        "Coefficient update probabilities do not match coefficient probabilities");
+    m_boolDecoder.ReadCoefProbs(&m_frameHead->FrameContext.CoefProbs[0][0][0][0]);
 
     m_frameHead->iMbNoCoeffSkip = (int32_t)DecodeBool(m_probHalf);
     m_frameHead->iProbSkipFalse = 0;
@@ -613,9 +535,10 @@ MOS_STATUS Vp8EntropyState::ParseFrameHead(PCODEC_VP8_PIC_PARAMS vp8PicParams)
         ReadMvContexts(MVContext);
     }
 
-    vp8PicParams->ucP0EntropyCount = 8 - (m_count & 0x07);
-    vp8PicParams->ucP0EntropyValue = (uint8_t)(m_value >> 24);
-    vp8PicParams->uiP0EntropyRange = m_range;
+    int32_t count                  = m_boolDecoder.GetCount();
+    vp8PicParams->ucP0EntropyCount = 8 - (count & 0x07);
+    vp8PicParams->ucP0EntropyValue = (uint8_t)(m_boolDecoder.GetValue() >> 24);
+    vp8PicParams->uiP0EntropyRange = m_boolDecoder.GetRange();
 
     uint32_t firstPartitionAndUncompSize;
     if (m_frameHead->iFrameType == m_keyFrame)
@@ -641,9 +564,9 @@ MOS_STATUS Vp8EntropyState::ParseFrameHead(PCODEC_VP8_PIC_PARAMS vp8PicParams)
         }
     }
 
-    uint32_t offsetCounter                      = ((m_count & 0x18) >> 3) + (((m_count & 0x07) != 0) ? 1 : 0);
-    vp8PicParams->uiFirstMbByteOffset           = (uint32_t)(m_buffer - m_bitstreamBuffer) - offsetCounter;
-    vp8PicParams->uiPartitionSize[0]            = firstPartitionAndUncompSize - (uint32_t)(m_buffer - m_bitstreamBuffer) + offsetCounter;
+    uint32_t offsetCounter                      = ((count & 0x18) >> 3) + (((count & 0x07) != 0) ? 1 : 0);
+    vp8PicParams->uiFirstMbByteOffset           = (uint32_t)(m_boolDecoder.GetBuffer() - m_bitstreamBuffer) - offsetCounter;
+    vp8PicParams->uiPartitionSize[0]            = firstPartitionAndUncompSize - (uint32_t)(m_boolDecoder.GetBuffer() - m_bitstreamBuffer) + offsetCounter;
     vp8PicParams->uiPartitionSize[partitionNum] = m_bitstreamBufferSize - firstPartitionAndUncompSize - (partitionNum - 1) * 3 - partitionSizeSum;
 
     return eStatus;
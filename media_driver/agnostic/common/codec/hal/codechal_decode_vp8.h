@@ -31,6 +31,7 @@
 #include "codechal.h"
 #include "codechal_hw.h"
 #include "codechal_decoder.h"
+#include "codechal_decode_vp8_bool_decoder.h"
 
 //*------------------------------------------------------------------------------
 //* Codec Definitions
@@ -274,8 +275,6 @@ class Vp8EntropyState
 public:
     const uint8_t  m_keyFrame    = 0;                                        //!< VP8 Key Frame Flag
     const uint8_t  m_interFrame  = 1;                                        //!< VP8 Inter Frame Flag
-    const uint32_t m_bdValueSize = ((uint32_t)sizeof(uint32_t) * CHAR_BIT);  // VP8 BD Value Size
-    const uint32_t m_lotsOfBits  = 0x40000000;                               //!< Offset for parsing frame head
     const uint8_t  m_probHalf    = 128;                                      //!< VP8 Half Probability
 
     //!
@@ -363,13 +362,6 @@ protected:
     uint8_t *                       m_dataBufferEnd       = nullptr;  //<! Pointer to Data Buffer End
 
 private:
-    //!
-    //! \brief    Update Entropy Decode State Info
-    //! \details  Calculate left bitstream size to update pointer info
-    //! \return   void
-    //!
-    void DecodeFill();
-
     //!
     //! \brief    Update Entropy Decode State according to probability
     //! \param    [in] probability
@@ -494,11 +486,7 @@ private:
     //!
     void QuantSetup();
 
-    const uint8_t *m_bufferEnd = nullptr;  //!< Pointer to Data Buffer End
-    const uint8_t *m_buffer = nullptr;     //!< Pointer to Data Buffer
-    int32_t        m_count = 0;      //!< Bits Count for Bitstream Buffer
-    uint32_t       m_value = 0;      //!< Entropy Value
-    uint32_t       m_range = 0;      //!< Entropy Range
+    Vp8BoolDecoder m_boolDecoder;  //!< Boolean Entropy Decoder
 };
 
 using PVP8_ENTROPY_STATE = Vp8EntropyState*;
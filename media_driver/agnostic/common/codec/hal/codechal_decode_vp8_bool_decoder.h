@@ -0,0 +1,241 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     codechal_decode_vp8_bool_decoder.h
+//! \brief    Defines the boolean entropy decoder used to parse VP8 frame header.
+//!
+
+#ifndef __CODECHAL_DECODE_VP8_BOOL_DECODER_H__
+#define __CODECHAL_DECODE_VP8_BOOL_DECODER_H__
+
+#include <limits.h>
+#include "mos_defs.h"
+#include "codec_def_vp8_probs.h"
+
+//!
+//! \class   Vp8BoolDecoder
+//! \brief   VP8 boolean entropy decoder over a 32-bit value window
+//!
+class Vp8BoolDecoder
+{
+public:
+    const uint32_t m_bdValueSize = ((uint32_t)sizeof(uint32_t) * CHAR_BIT);  //!< VP8 BD Value Size
+    const uint32_t m_lotsOfBits  = 0x40000000;                               //!< Offset for parsing frame head
+    const uint8_t  m_probHalf    = 128;                                      //!< VP8 Half Probability
+
+    //!
+    //! \brief    Start entropy decode on bitstream
+    //! \param    [in] buffer
+    //!           Pointer to data buffer
+    //! \param    [in] bufferEnd
+    //!           Pointer to data buffer end
+    //! \return   int32_t
+    //!           0 if success, 1 if buffer is invalid
+    //!
+    int32_t Start(const uint8_t *buffer, const uint8_t *bufferEnd)
+    {
+        m_bufferEnd = bufferEnd;
+        m_buffer    = buffer;
+        m_value     = 0;
+        m_count     = -8;
+        m_range     = 255;
+
+        if ((m_bufferEnd - m_buffer) > 0 && m_buffer == nullptr)
+        {
+            return 1;
+        }
+
+        Fill();
+
+        return 0;
+    }
+
+    //!
+    //! \brief    Refill value window from data buffer
+    //! \details  Calculate left bitstream size to update pointer info
+    //! \return   void
+    //!
+    void Fill()
+    {
+        int32_t  shift     = m_bdValueSize - 8 - (m_count + 8);
+        uint32_t bytesLeft = (uint32_t)(m_bufferEnd - m_buffer);
+        uint32_t bitsLeft  = bytesLeft * CHAR_BIT;
+        int32_t  num       = (int32_t)(shift + CHAR_BIT - bitsLeft);
+        int32_t  loopEnd   = 0;
+
+        if (num >= 0)
+        {
+            m_count += m_lotsOfBits;
+            loopEnd = num;
+        }
+
+        if (num < 0 || bitsLeft)
+        {
+            while (shift >= loopEnd)
+            {
+                m_count += CHAR_BIT;
+                m_value |= (uint32_t)*m_buffer << shift;
+                ++m_buffer;
+                shift -= CHAR_BIT;
+            }
+        }
+    }
+
+    //!
+    //! \brief    Decode one bool according to probability
+    //! \param    [in] probability
+    //!           Probability of bool being 0, in 1/256 units
+    //! \return   uint32_t
+    //!           Decoded bool
+    //!
+    uint32_t DecodeBool(int32_t probability)
+    {
+        uint32_t split     = 1 + (((m_range - 1) * probability) >> 8);
+        uint32_t bigSplit  = (uint32_t)split << (m_bdValueSize - 8);
+        uint32_t origRange = m_range;
+        m_range            = split;
+
+        uint32_t bit = 0;
+        if (m_value >= bigSplit)
+        {
+            m_range = origRange - split;
+            m_value = m_value - bigSplit;
+            bit = 1;
+        }
+
+        int32_t shift = Norm[m_range];
+        m_range <<= shift;
+        m_value <<= shift;
+        m_count -= shift;
+
+        if (m_count < 0)
+        {
+            Fill();
+        }
+
+        return bit;
+    }
+
+    //!
+    //! \brief    Decode literal with half probability bools
+    //! \param    [in] bits
+    //!           Number of bits of literal
+    //! \return   int32_t
+    //!           Decoded literal, most significant bit first
+    //!
+    int32_t DecodeValue(int32_t bits)
+    {
+        int32_t retValue = 0;
+
+        for (int32_t iBit = bits - 1; iBit >= 0; iBit--)
+        {
+            retValue |= (DecodeBool(0x80) << iBit);
+        }
+
+        return retValue;
+    }
+
+    //!
+    //! \brief    Read coefficient probability updates in frame header
+    //! \details  Specialized DecodeBool loop over all coefficient probabilities,
+    //!           which keeps the decoder state in locals and produces the same
+    //!           state as DecodeBool/DecodeValue
+    //! \param    [in, out] coefProbs
+    //!           Coefficient probabilities laid out as CoefUpdateProbs
+    //! \return   void
+    //!
+    void ReadCoefProbs(uint8_t *coefProbs)
+    {
+        const uint8_t *updateProbs = &CoefUpdateProbs[0][0][0][0];
+        const uint32_t bigShift    = m_bdValueSize - 8;
+
+        uint32_t value = m_value;
+        uint32_t range = m_range;
+        int32_t  count = m_count;
+
+        // Same arithmetic as DecodeBool, the state is written back only for refill.
+        auto decodeBool = [&](uint32_t probability) -> uint32_t
+        {
+            uint32_t split    = 1 + (((range - 1) * probability) >> 8);
+            uint32_t bigSplit = split << bigShift;
+            uint32_t bit      = 0;
+
+            if (value >= bigSplit)
+            {
+                range -= split;
+                value -= bigSplit;
+                bit = 1;
+            }
+            else
+            {
+                range = split;
+            }
+
+            int32_t shift = Norm[range];
+            range <<= shift;
+            value <<= shift;
+            count -= shift;
+
+            if (count < 0)
+            {
+                m_value = value;
+                m_count = count;
+                Fill();
+                value = m_value;
+                count = m_count;
+            }
+
+            return bit;
+        };
+
+        for (uint32_t i = 0; i < sizeof(CoefUpdateProbs); i++)
+        {
+            if (decodeBool(updateProbs[i]))
+            {
+                uint32_t prob = 0;
+                for (int32_t bit = 7; bit >= 0; bit--)
+                {
+                    prob |= decodeBool(m_probHalf) << bit;
+                }
+                coefProbs[i] = (uint8_t)prob;
+            }
+        }
+
+        m_value = value;
+        m_range = range;
+        m_count = count;
+    }
+
+    const uint8_t *GetBuffer() const { return m_buffer; }  //!< Next byte to fill into value window
+    int32_t        GetCount() const { return m_count; }    //!< Bits count of value window
+    uint32_t       GetValue() const { return m_value; }    //!< Entropy value
+    uint32_t       GetRange() const { return m_range; }    //!< Entropy range
+
+protected:
+    const uint8_t *m_bufferEnd = nullptr;  //!< Pointer to Data Buffer End
+    const uint8_t *m_buffer    = nullptr;  //!< Pointer to Data Buffer
+    int32_t        m_count     = 0;        //!< Bits Count for Bitstream Buffer
+    uint32_t       m_value     = 0;        //!< Entropy Value
+    uint32_t       m_range     = 0;        //!< Entropy Range
+};
+
+#endif  // __CODECHAL_DECODE_VP8_BOOL_DECODER_H__
@@ -0,0 +1,103 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     codechal_decode_ytile_copy.h
+//! \brief    Defines the copy spans of row bands within one tile row of Y-tiled surfaces.
+//!
+
+#ifndef __CODECHAL_DECODE_YTILE_COPY_H__
+#define __CODECHAL_DECODE_YTILE_COPY_H__
+
+#include "mos_defs.h"
+
+#define CODECHAL_DECODE_YTILE_W         128                                                             //!< Tile width in bytes
+#define CODECHAL_DECODE_YTILE_H         32                                                              //!< Tile height in rows
+#define CODECHAL_DECODE_YTILE_OWORD_W   16                                                              //!< Width of an OWord column in bytes
+#define CODECHAL_DECODE_YTILE_COLUMN    (CODECHAL_DECODE_YTILE_H * CODECHAL_DECODE_YTILE_OWORD_W)      //!< Bytes of an OWord column of one tile
+
+//!
+//! \brief  Copy spans of a row band, span i starts at offset + i * CODECHAL_DECODE_YTILE_COLUMN
+//!
+struct CODECHAL_DECODE_YTILE_ROW_SPANS
+{
+    uint32_t    srcOffset;
+    uint32_t    dstOffset;
+    uint32_t    spanSize;
+    uint32_t    spanNum;
+};
+
+//!
+//! \brief    Get the copy spans of rows [srcY, srcY + height) to rows from dstY
+//! \details  OWord columns of all tiles in a tile row are consecutive, so rows of full
+//!           tile height are one span, otherwise there is one span for each column.
+//!
+//! \param    [in] srcY
+//!           First row to copy in source surface
+//! \param    [in] srcPitch
+//!           Pitch of source surface, multiple of tile width
+//! \param    [in] dstY
+//!           First row to copy to in destination surface, same row in tile as srcY
+//! \param    [in] dstPitch
+//!           Pitch of destination surface, multiple of tile width
+//! \param    [in] width
+//!           Width in bytes, rounded up to OWord width
+//! \param    [in] height
+//!           Number of rows, not crossing tile row
+//! \param    [out] spans
+//!           Copy spans
+//!
+//! \return   MOS_STATUS
+//!           MOS_STATUS_INVALID_PARAMETER if rows cross tile row or are not in the same row of tile
+//!
+static inline MOS_STATUS CodechalDecodeGetYTiledRowSpans(
+    uint32_t                         srcY,
+    uint32_t                         srcPitch,
+    uint32_t                         dstY,
+    uint32_t                         dstPitch,
+    uint32_t                         width,
+    uint32_t                         height,
+    CODECHAL_DECODE_YTILE_ROW_SPANS &spans)
+{
+    uint32_t yOffWithinTile = srcY % CODECHAL_DECODE_YTILE_H;
+    if (yOffWithinTile != dstY % CODECHAL_DECODE_YTILE_H || yOffWithinTile + height > CODECHAL_DECODE_YTILE_H)
+    {
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    // Same as LinearToYTiledAddress(0, y, pitch)
+    spans.srcOffset = (srcPitch / CODECHAL_DECODE_YTILE_W) * CODECHAL_DECODE_YTILE_W * CODECHAL_DECODE_YTILE_H * (srcY / CODECHAL_DECODE_YTILE_H) +
+                      yOffWithinTile * CODECHAL_DECODE_YTILE_OWORD_W;
+    spans.dstOffset = (dstPitch / CODECHAL_DECODE_YTILE_W) * CODECHAL_DECODE_YTILE_W * CODECHAL_DECODE_YTILE_H * (dstY / CODECHAL_DECODE_YTILE_H) +
+                      yOffWithinTile * CODECHAL_DECODE_YTILE_OWORD_W;
+
+    spans.spanSize = height * CODECHAL_DECODE_YTILE_OWORD_W;
+    spans.spanNum  = (width + CODECHAL_DECODE_YTILE_OWORD_W - 1) / CODECHAL_DECODE_YTILE_OWORD_W;
+    if (CODECHAL_DECODE_YTILE_H == height)
+    {
+        spans.spanSize *= spans.spanNum;
+        spans.spanNum   = 1;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+#endif  // __CODECHAL_DECODE_YTILE_COPY_H__
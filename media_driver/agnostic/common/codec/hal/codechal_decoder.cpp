@@ -30,6 +30,7 @@
 #include "mos_solo_generic.h"
 #include "codechal_debug.h"
 #include "codechal_decode_histogram.h"
+#include "codechal_decode_ytile_copy.h"
 
 #ifdef _HEVC_DECODE_SUPPORTED
 #include "codechal_decode_hevc.h"
@@ -221,6 +222,72 @@ uint32_t CodechalDecode::LinearToYTiledAddress(
     return tileOffset;
 }
 
+MOS_STATUS CodechalDecode::CopyYTiledRows(
+    PMOS_COMMAND_BUFFER cmdBuffer,
+    PMOS_SURFACE        srcSurface,
+    uint32_t            srcY,
+    PMOS_SURFACE        dstSurface,
+    uint32_t            dstY,
+    uint32_t            dstSize,
+    uint32_t            width,
+    uint32_t            height)
+{
+    CODECHAL_DECODE_FUNCTION_ENTER;
+
+    CODECHAL_DECODE_CHK_NULL_RETURN(srcSurface);
+    CODECHAL_DECODE_CHK_NULL_RETURN(dstSurface);
+
+    CODECHAL_DECODE_YTILE_ROW_SPANS spans = {};
+    MOS_STATUS eStatus = CodechalDecodeGetYTiledRowSpans(
+        srcY,
+        srcSurface->dwPitch,
+        dstY,
+        dstSurface->dwPitch,
+        width,
+        height,
+        spans);
+    if (eStatus != MOS_STATUS_SUCCESS)
+    {
+        CODECHAL_DECODE_ASSERTMESSAGE("Rows to copy cross tile row or are not in the same row of tile.");
+        return eStatus;
+    }
+
+    uint32_t srcOffset = spans.srcOffset;
+    uint32_t dstOffset = spans.dstOffset;
+
+    for (uint32_t i = 0; i < spans.spanNum; i++)
+    {
+        if (m_hwInterface->m_noHuC)
+        {
+            CodechalDataCopyParams dataCopyParams;
+            MOS_ZeroMemory(&dataCopyParams, sizeof(CodechalDataCopyParams));
+            dataCopyParams.srcResource = &srcSurface->OsResource;
+            dataCopyParams.srcSize     = spans.spanSize;
+            dataCopyParams.srcOffset   = srcOffset;
+            dataCopyParams.dstResource = &dstSurface->OsResource;
+            dataCopyParams.dstSize     = dstSize;
+            dataCopyParams.dstOffset   = dstOffset;
+
+            CODECHAL_DECODE_CHK_STATUS_RETURN(m_hwInterface->CopyDataSourceWithDrv(&dataCopyParams));
+        }
+        else
+        {
+            CODECHAL_DECODE_CHK_STATUS_RETURN(HucCopy(
+                cmdBuffer,                  // pCmdBuffer
+                &srcSurface->OsResource,    // presSrc
+                &dstSurface->OsResource,    // presDst
+                spans.spanSize,             // u32CopyLength
+                srcOffset,                  // u32CopyInputOffset
+                dstOffset));                // u32CopyOutputOffset
+        }
+
+        srcOffset += CODECHAL_DECODE_YTILE_COLUMN;
+        dstOffset += CODECHAL_DECODE_YTILE_COLUMN;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
 CodechalDecode::CodechalDecode (
     CodechalHwInterface        *hwInterface,
     CodechalDebugInterface      *debugInterface,
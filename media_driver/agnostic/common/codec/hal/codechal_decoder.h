@@ -34,6 +34,7 @@
 #include "codechal_debug.h"
 #include "codechal_decode_downsampling.h"
 #include "codechal_decode_sfc.h"
+#include "codechal_decode_bitstream_chain.h"
 #include "codechal_mmc.h"
 #include "codechal_utilities.h"
 #include "codec_def_decode.h"
@@ -814,6 +815,43 @@ protected:
         uint32_t y,
         uint32_t pitch);
 
+    //!
+    //! \brief  Copy rows of Y tiled surface
+    //! \details Copy rows [srcY, srcY + height) of source surface to rows from dstY
+    //!          of destination surface within one tile row, via HuC or driver copy.
+    //!          OWord columns of all tiles in a tile row are consecutive, so rows
+    //!          of full tile height are copied in one span, otherwise one span for
+    //!          each 16-byte column.
+    //!
+    //! \param  [in] cmdBuffer
+    //!         Pointer to command buffer for HuC copy
+    //! \param  [in] srcSurface
+    //!         Source surface
+    //! \param  [in] srcY
+    //!         First row to copy in source surface
+    //! \param  [in] dstSurface
+    //!         Destination surface
+    //! \param  [in] dstY
+    //!         First row to copy to in destination surface, same row in tile as srcY
+    //! \param  [in] dstSize
+    //!         Size of destination surface for driver copy
+    //! \param  [in] width
+    //!         Width in bytes, rounded up to 16
+    //! \param  [in] height
+    //!         Number of rows, not crossing tile row
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS CopyYTiledRows(
+        PMOS_COMMAND_BUFFER cmdBuffer,
+        PMOS_SURFACE        srcSurface,
+        uint32_t            srcY,
+        PMOS_SURFACE        dstSurface,
+        uint32_t            dstY,
+        uint32_t            dstSize,
+        uint32_t            width,
+        uint32_t            height);
+
 #if USE_CODECHAL_DEBUG_TOOL
     MOS_STATUS DumpProcessingParams(
         DecodeProcessingParams *decProcParams);
@@ -38,6 +38,7 @@
 #include "codechal_vdenc_vp9_base.h"
 #include "codechal_mmc_encode_vp9.h"
 #include "codec_def_vp9_probs.h"
+#include "codechal_vp9_ctx_image.h"
 
 extern const uint8_t Keyframe_Default_Probs[2048] = {
     0x64, 0x42, 0x14, 0x98, 0x0f, 0x65, 0x03, 0x88, 0x25, 0x05, 0x34, 0x0d, 0x00, 0x00, 0x00, 0x00,
@@ -7242,369 +7243,14 @@ MOS_STATUS CodechalVdencVp9State::CtxBufDiffInit(
     uint8_t *ctxBuffer,
     bool setToKey)
 {
-    int32_t i, j;
-    uint32_t byteCnt = CODEC_VP9_INTER_PROB_OFFSET;
-    //inter mode probs. have to be zeros for Key frame
-    for (i = 0; i < CODEC_VP9_INTER_MODE_CONTEXTS; i++)
-    {
-        for (j = 0; j < CODEC_VP9_INTER_MODES - 1; j++)
-        {
-            if (!setToKey)
-            {
-                ctxBuffer[byteCnt++] = DefaultInterModeProbs[i][j];
-            }
-            else
-            {
-                //zeros for key frame
-                byteCnt++;
-            }
-        }
-    }
-    //switchable interprediction probs
-    for (i = 0; i < CODEC_VP9_SWITCHABLE_FILTERS + 1; i++)
-    {
-        for (j = 0; j < CODEC_VP9_SWITCHABLE_FILTERS - 1; j++)
-        {
-            if (!setToKey)
-            {
-                ctxBuffer[byteCnt++] = DefaultSwitchableInterpProb[i][j];
-            }
-            else
-            {
-                //zeros for key frame
-                byteCnt++;
-            }
-        }
-    }
-    //intra inter probs
-    for (i = 0; i < CODEC_VP9_INTRA_INTER_CONTEXTS; i++)
-    {
-        if (!setToKey)
-        {
-            ctxBuffer[byteCnt++] = DefaultIntraInterProb[i];
-        }
-        else
-        {
-            //zeros for key frame
-            byteCnt++;
-        }
-    }
-    //comp inter probs
-    for (i = 0; i < CODEC_VP9_COMP_INTER_CONTEXTS; i++)
-    {
-        if (!setToKey)
-        {
-            ctxBuffer[byteCnt++] = DefaultCompInterProb[i];
-        }
-        else
-        {
-            //zeros for key frame
-            byteCnt++;
-        }
-    }
-    //single ref probs
-    for (i = 0; i < CODEC_VP9_REF_CONTEXTS; i++)
-    {
-        for (j = 0; j < 2; j++)
-        {
-            if (!setToKey)
-            {
-                ctxBuffer[byteCnt++] = DefaultSingleRefProb[i][j];
-            }
-            else
-            {
-                //zeros for key frame
-                byteCnt++;
-            }
-        }
-    }
-    //comp ref probs
-    for (i = 0; i < CODEC_VP9_REF_CONTEXTS; i++)
-    {
-        if (!setToKey)
-        {
-            ctxBuffer[byteCnt++] = DefaultCompRefProb[i];
-        }
-        else
-        {
-            //zeros for key frame
-            byteCnt++;
-        }
-    }
-    //y mode probs
-    for (i = 0; i < CODEC_VP9_BLOCK_SIZE_GROUPS; i++)
-    {
-        for (j = 0; j < CODEC_VP9_INTRA_MODES - 1; j++)
-        {
-            if (!setToKey)
-            {
-                ctxBuffer[byteCnt++] = DefaultIFYProb[i][j];
-            }
-            else
-            {
-                //zeros for key frame, since HW will not use this buffer, but default right buffer.
-                byteCnt++;
-            }
-        }
-    }
-    //partition probs, key & intra-only frames use key type, other inter frames use inter type
-    for (i = 0; i < CODECHAL_VP9_PARTITION_CONTEXTS; i++)
-    {
-        for (j = 0; j < CODEC_VP9_PARTITION_TYPES - 1; j++)
-        {
-            if (setToKey)
-            {
-                ctxBuffer[byteCnt++] = DefaultKFPartitionProb[i][j];
-            }
-            else
-            {
-                ctxBuffer[byteCnt++] = DefaultPartitionProb[i][j];
-            }
-        }
-    }
-    //nmvc joints
-    for (i = 0; i < (CODEC_VP9_MV_JOINTS - 1); i++)
-    {
-        if (!setToKey)
-        {
-            ctxBuffer[byteCnt++] = DefaultNmvContext.joints[i];
-        }
-        else
-        {
-            //zeros for key frame
-            byteCnt++;
-        }
-    }
-    //nmvc comps
-    for (i = 0; i < 2; i++)
-    {
-        if (!setToKey)
-        {
-            ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].sign;
-            for (j = 0; j < (CODEC_VP9_MV_CLASSES - 1); j++)
-            {
-                ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].classes[j];
-            }
-            for (j = 0; j < (CODECHAL_VP9_CLASS0_SIZE - 1); j++)
-            {
-                ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].class0[j];
-            }
-            for (j = 0; j < CODECHAL_VP9_MV_OFFSET_BITS; j++)
-            {
-                ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].bits[j];
-            }
-        }
-        else
-        {
-            byteCnt += 1;
-            byteCnt += (CODEC_VP9_MV_CLASSES - 1);
-            byteCnt += (CODECHAL_VP9_CLASS0_SIZE - 1);
-            byteCnt += (CODECHAL_VP9_MV_OFFSET_BITS);
-        }
-    }
-    for (i = 0; i < 2; i++)
-    {
-        if (!setToKey)
-        {
-            for (j = 0; j < CODECHAL_VP9_CLASS0_SIZE; j++)
-            {
-                for (int32_t k = 0; k < (CODEC_VP9_MV_FP_SIZE - 1); k++)
-                {
-                    ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].class0_fp[j][k];
-                }
-            }
-            for (j = 0; j < (CODEC_VP9_MV_FP_SIZE - 1); j++)
-            {
-                ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].fp[j];
-            }
-        }
-        else
-        {
-            byteCnt += (CODECHAL_VP9_CLASS0_SIZE * (CODEC_VP9_MV_FP_SIZE - 1));
-            byteCnt += (CODEC_VP9_MV_FP_SIZE - 1);
-        }
-    }
-    for (i = 0; i < 2; i++)
-    {
-        if (!setToKey)
-        {
-            ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].class0_hp;
-            ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].hp;
-        }
-        else
-        {
-            byteCnt += 2;
-        }
-    }
-
-    //47 bytes of zeros
-    byteCnt += 47;
-
-    //uv mode probs
-    for (i = 0; i < CODEC_VP9_INTRA_MODES; i++)
-    {
-        for (j = 0; j < CODEC_VP9_INTRA_MODES - 1; j++)
-        {
-            if (setToKey)
-            {
-                ctxBuffer[byteCnt++] = DefaultKFUVModeProb[i][j];
-            }
-            else
-            {
-                ctxBuffer[byteCnt++] = DefaultIFUVProbs[i][j];
-            }
-        }
-    }
-
-    return MOS_STATUS_SUCCESS;
+    return CodecHalVp9CtxBufDiffInit(ctxBuffer, setToKey);
 }
 
 MOS_STATUS CodechalVdencVp9State::ContextBufferInit(
     uint8_t *ctxBuffer,
     bool setToKey)
 {
-
-    MOS_ZeroMemory(ctxBuffer, CODEC_VP9_SEG_PROB_OFFSET);
-
-    int32_t i, j;
-    uint32_t byteCnt = 0;
-    //TX probs
-    for (i = 0; i < CODEC_VP9_TX_SIZE_CONTEXTS; i++)
-    {
-        for (j = 0; j < CODEC_VP9_TX_SIZES - 3; j++)
-        {
-            ctxBuffer[byteCnt++] = DefaultTxProbs.p8x8[i][j];
-        }
-    }
-    for (i = 0; i < CODEC_VP9_TX_SIZE_CONTEXTS; i++)
-    {
-        for (j = 0; j < CODEC_VP9_TX_SIZES - 2; j++)
-        {
-            ctxBuffer[byteCnt++] = DefaultTxProbs.p16x16[i][j];
-        }
-    }
-    for (i = 0; i < CODEC_VP9_TX_SIZE_CONTEXTS; i++)
-    {
-        for (j = 0; j < CODEC_VP9_TX_SIZES - 1; j++)
-        {
-            ctxBuffer[byteCnt++] = DefaultTxProbs.p32x32[i][j];
-        }
-    }
-
-    //52 bytes of zeros
-    byteCnt += 52;
-
-    uint8_t blocktype = 0;
-    uint8_t reftype = 0;
-    uint8_t coeffbands = 0;
-    uint8_t unConstrainedNodes = 0;
-    uint8_t prevCoefCtx = 0;
-    //coeff probs
-    for (blocktype = 0; blocktype < CODEC_VP9_BLOCK_TYPES; blocktype++)
-    {
-        for (reftype = 0; reftype < CODEC_VP9_REF_TYPES; reftype++)
-        {
-            for (coeffbands = 0; coeffbands < CODEC_VP9_COEF_BANDS; coeffbands++)
-            {
-                uint8_t numPrevCoeffCtxts = (coeffbands == 0) ? 3 : CODEC_VP9_PREV_COEF_CONTEXTS;
-                for (prevCoefCtx = 0; prevCoefCtx < numPrevCoeffCtxts; prevCoefCtx++)
-                {
-                    for (unConstrainedNodes = 0; unConstrainedNodes < CODEC_VP9_UNCONSTRAINED_NODES; unConstrainedNodes++)
-                    {
-                        ctxBuffer[byteCnt++] = DefaultCoefProbs4x4[blocktype][reftype][coeffbands][prevCoefCtx][unConstrainedNodes];
-                    }
-                }
-            }
-        }
-    }
-
-    for (blocktype = 0; blocktype < CODEC_VP9_BLOCK_TYPES; blocktype++)
-    {
-        for (reftype = 0; reftype < CODEC_VP9_REF_TYPES; reftype++)
-        {
-            for (coeffbands = 0; coeffbands < CODEC_VP9_COEF_BANDS; coeffbands++)
-            {
-                uint8_t numPrevCoeffCtxts = (coeffbands == 0) ? 3 : CODEC_VP9_PREV_COEF_CONTEXTS;
-                for (prevCoefCtx = 0; prevCoefCtx < numPrevCoeffCtxts; prevCoefCtx++)
-                {
-                    for (unConstrainedNodes = 0; unConstrainedNodes < CODEC_VP9_UNCONSTRAINED_NODES; unConstrainedNodes++)
-                    {
-                        ctxBuffer[byteCnt++] = DefaultCoefPprobs8x8[blocktype][reftype][coeffbands][prevCoefCtx][unConstrainedNodes];
-                    }
-                }
-            }
-        }
-    }
-
-    for (blocktype = 0; blocktype < CODEC_VP9_BLOCK_TYPES; blocktype++)
-    {
-        for (reftype = 0; reftype < CODEC_VP9_REF_TYPES; reftype++)
-        {
-            for (coeffbands = 0; coeffbands < CODEC_VP9_COEF_BANDS; coeffbands++)
-            {
-                uint8_t numPrevCoeffCtxts = (coeffbands == 0) ? 3 : CODEC_VP9_PREV_COEF_CONTEXTS;
-                for (prevCoefCtx = 0; prevCoefCtx < numPrevCoeffCtxts; prevCoefCtx++)
-                {
-                    for (unConstrainedNodes = 0; unConstrainedNodes < CODEC_VP9_UNCONSTRAINED_NODES; unConstrainedNodes++)
-                    {
-                        ctxBuffer[byteCnt++] = DefaultCoefProbs16x16[blocktype][reftype][coeffbands][prevCoefCtx][unConstrainedNodes];
-                    }
-                }
-            }
-        }
-    }
-
-    for (blocktype = 0; blocktype < CODEC_VP9_BLOCK_TYPES; blocktype++)
-    {
-        for (reftype = 0; reftype < CODEC_VP9_REF_TYPES; reftype++)
-        {
-            for (coeffbands = 0; coeffbands < CODEC_VP9_COEF_BANDS; coeffbands++)
-            {
-                uint8_t numPrevCoeffCtxts = (coeffbands == 0) ? 3 : CODEC_VP9_PREV_COEF_CONTEXTS;
-                for (prevCoefCtx = 0; prevCoefCtx < numPrevCoeffCtxts; prevCoefCtx++)
-                {
-                    for (unConstrainedNodes = 0; unConstrainedNodes < CODEC_VP9_UNCONSTRAINED_NODES; unConstrainedNodes++)
-                    {
-                        ctxBuffer[byteCnt++] = DefaultCoefProbs32x32[blocktype][reftype][coeffbands][prevCoefCtx][unConstrainedNodes];
-                    }
-                }
-            }
-        }
-    }
-
-    //16 bytes of zeros
-    byteCnt += 16;
-
-    // mb skip probs
-    for (i = 0; i < CODEC_VP9_MBSKIP_CONTEXTS; i++)
-    {
-        ctxBuffer[byteCnt++] = DefaultMbskipProbs[i];
-    }
-
-    // populate prob values which are different between Key and Non-Key frame
-    CtxBufDiffInit(ctxBuffer, setToKey);
-
-    //skip Seg tree/pred probs, updating not done in this function.
-    byteCnt = CODEC_VP9_SEG_PROB_OFFSET;
-    byteCnt += 7;
-    byteCnt += 3;
-
-    //28 bytes of zeros
-    for (i = 0; i < 28; i++)
-    {
-        ctxBuffer[byteCnt++] = 0;
-    }
-
-    //Just a check.
-    if (byteCnt > CODEC_VP9_PROB_MAX_NUM_ELEM)
-    {
-        CODECHAL_PUBLIC_ASSERTMESSAGE("Error: FrameContext array out-of-bounds, byteCnt = %d!\n", byteCnt);
-        return MOS_STATUS_NO_SPACE;
-    }
-    else
-    {
-        return MOS_STATUS_SUCCESS;
-    }
+    return CodecHalVp9ContextBufferInit(ctxBuffer, setToKey);
 }
 
 #if USE_CODECHAL_DEBUG_TOOL
@@ -0,0 +1,523 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     codechal_vp9_ctx_image.cpp
+//! \brief    Implements the default VP9 probability context images shared by decoder and encoder.
+//! \details  Only depends on MOS memory and debug helpers, so the images can be checked by host side ULT.
+//!
+
+#include "codechal_vp9_ctx_image.h"
+#include "codechal.h"
+#include "codec_def_common_vp9.h"
+#include "codec_def_vp9_probs.h"
+
+#define CODECHAL_VP9_SEG_PROB_SIZE          10  //!< 7 seg tree probs followed by 3 seg pred probs
+#define CODECHAL_VP9_CTX_DIFF_MAX_RUNS      4   //!< Max contiguous byte runs written by the key/non-key diff init
+
+//!
+//! \brief    Prebuilt VP9 default probability context image
+//! \details  Holds the full default context for one frame type, plus the byte runs
+//!           written when only the key/non-key specific probs are reset.
+//!
+struct CODECHAL_VP9_DEFAULT_CTX_IMAGE
+{
+    uint8_t     data[CODEC_VP9_PROB_MAX_NUM_ELEM];
+    uint32_t    diffRunCount;
+    uint32_t    diffRunOffset[CODECHAL_VP9_CTX_DIFF_MAX_RUNS];
+    uint32_t    diffRunSize[CODECHAL_VP9_CTX_DIFF_MAX_RUNS];
+    MOS_STATUS  status;
+};
+
+MOS_STATUS CodecHalVp9BuildCtxBufDiff(
+    uint8_t             *ctxBuffer,
+    bool                 setToKey)
+{
+    int32_t i, j;
+    uint32_t byteCnt = CODEC_VP9_INTER_PROB_OFFSET;
+    //inter mode probs. have to be zeros for Key frame
+    for (i = 0; i < CODEC_VP9_INTER_MODE_CONTEXTS; i++)
+    {
+        for (j = 0; j < CODEC_VP9_INTER_MODES - 1; j++)
+        {
+            if (!setToKey)
+            {
+                ctxBuffer[byteCnt++] = DefaultInterModeProbs[i][j];
+            }
+            else
+            {
+                //zeros for key frame
+                byteCnt++;
+            }
+        }
+    }
+    //switchable interprediction probs
+    for (i = 0; i < CODEC_VP9_SWITCHABLE_FILTERS + 1; i++)
+    {
+        for (j = 0; j < CODEC_VP9_SWITCHABLE_FILTERS - 1; j++)
+        {
+            if (!setToKey)
+            {
+                ctxBuffer[byteCnt++] = DefaultSwitchableInterpProb[i][j];
+            }
+            else
+            {
+                //zeros for key frame
+                byteCnt++;
+            }
+        }
+    }
+    //intra inter probs
+    for (i = 0; i < CODEC_VP9_INTRA_INTER_CONTEXTS; i++)
+    {
+        if (!setToKey)
+        {
+            ctxBuffer[byteCnt++] = DefaultIntraInterProb[i];
+        }
+        else
+        {
+            //zeros for key frame
+            byteCnt++;
+        }
+    }
+    //comp inter probs
+    for (i = 0; i < CODEC_VP9_COMP_INTER_CONTEXTS; i++)
+    {
+        if (!setToKey)
+        {
+            ctxBuffer[byteCnt++] = DefaultCompInterProb[i];
+        }
+        else
+        {
+            //zeros for key frame
+            byteCnt++;
+        }
+    }
+    //single ref probs
+    for (i = 0; i < CODEC_VP9_REF_CONTEXTS; i++)
+    {
+        for (j = 0; j < 2; j++)
+        {
+            if (!setToKey)
+            {
+                ctxBuffer[byteCnt++] = DefaultSingleRefProb[i][j];
+            }
+            else
+            {
+                //zeros for key frame
+                byteCnt++;
+            }
+        }
+    }
+    //comp ref probs
+    for (i = 0; i < CODEC_VP9_REF_CONTEXTS; i++)
+    {
+        if (!setToKey)
+        {
+            ctxBuffer[byteCnt++] = DefaultCompRefProb[i];
+        }
+        else
+        {
+            //zeros for key frame
+            byteCnt++;
+        }
+    }
+    //y mode probs
+    for (i = 0; i < CODEC_VP9_BLOCK_SIZE_GROUPS; i++)
+    {
+        for (j = 0; j < CODEC_VP9_INTRA_MODES - 1; j++)
+        {
+            if (!setToKey)
+            {
+                ctxBuffer[byteCnt++] = DefaultIFYProb[i][j];
+            }
+            else
+            {
+                //zeros for key frame, since HW will not use this buffer, but default right buffer.
+                byteCnt++;
+            }
+        }
+    }
+    //partition probs, key & intra-only frames use key type, other inter frames use inter type
+    for (i = 0; i < CODECHAL_VP9_PARTITION_CONTEXTS; i++)
+    {
+        for (j = 0; j < CODEC_VP9_PARTITION_TYPES - 1; j++)
+        {
+            if (setToKey)
+            {
+                ctxBuffer[byteCnt++] = DefaultKFPartitionProb[i][j];
+            }
+            else
+            {
+                ctxBuffer[byteCnt++] = DefaultPartitionProb[i][j];
+            }
+        }
+    }
+    //nmvc joints
+    for (i = 0; i < (CODEC_VP9_MV_JOINTS - 1); i++)
+    {
+        if (!setToKey)
+        {
+            ctxBuffer[byteCnt++] = DefaultNmvContext.joints[i];
+        }
+        else
+        {
+            //zeros for key frame
+            byteCnt++;
+        }
+    }
+    //nmvc comps
+    for (i = 0; i < 2; i++)
+    {
+        if (!setToKey)
+        {
+            ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].sign;
+            for (j = 0; j < (CODEC_VP9_MV_CLASSES - 1); j++)
+            {
+                ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].classes[j];
+            }
+            for (j = 0; j < (CODECHAL_VP9_CLASS0_SIZE - 1); j++)
+            {
+                ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].class0[j];
+            }
+            for (j = 0; j < CODECHAL_VP9_MV_OFFSET_BITS; j++)
+            {
+                ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].bits[j];
+            }
+        }
+        else
+        {
+            byteCnt += 1;
+            byteCnt += (CODEC_VP9_MV_CLASSES - 1);
+            byteCnt += (CODECHAL_VP9_CLASS0_SIZE - 1);
+            byteCnt += (CODECHAL_VP9_MV_OFFSET_BITS);
+        }
+    }
+    for (i = 0; i < 2; i++)
+    {
+        if (!setToKey)
+        {
+            for (j = 0; j < CODECHAL_VP9_CLASS0_SIZE; j++)
+            {
+                for (int32_t k = 0; k < (CODEC_VP9_MV_FP_SIZE - 1); k++)
+                {
+                    ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].class0_fp[j][k];
+                }
+            }
+            for (j = 0; j < (CODEC_VP9_MV_FP_SIZE - 1); j++)
+            {
+                ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].fp[j];
+            }
+        }
+        else
+        {
+            byteCnt += (CODECHAL_VP9_CLASS0_SIZE * (CODEC_VP9_MV_FP_SIZE - 1));
+            byteCnt += (CODEC_VP9_MV_FP_SIZE - 1);
+        }
+    }
+    for (i = 0; i < 2; i++)
+    {
+        if (!setToKey)
+        {
+            ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].class0_hp;
+            ctxBuffer[byteCnt++] = DefaultNmvContext.comps[i].hp;
+        }
+        else
+        {
+            byteCnt += 2;
+        }
+    }
+
+    //47 bytes of zeros
+    byteCnt += 47;
+
+    //uv mode probs
+    for (i = 0; i < CODEC_VP9_INTRA_MODES; i++)
+    {
+        for (j = 0; j < CODEC_VP9_INTRA_MODES - 1; j++)
+        {
+            if (setToKey)
+            {
+                ctxBuffer[byteCnt++] = DefaultKFUVModeProb[i][j];
+            }
+            else
+            {
+                ctxBuffer[byteCnt++] = DefaultIFUVProbs[i][j];
+            }
+        }
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS CodecHalVp9BuildContextBuffer(
+    uint8_t             *ctxBuffer,
+    bool                 setToKey)
+{
+
+    MOS_ZeroMemory(ctxBuffer, CODEC_VP9_SEG_PROB_OFFSET);
+
+    int32_t i, j;
+    uint32_t byteCnt = 0;
+    //TX probs
+    for (i = 0; i < CODEC_VP9_TX_SIZE_CONTEXTS; i++)
+    {
+        for (j = 0; j < CODEC_VP9_TX_SIZES - 3; j++)
+        {
+            ctxBuffer[byteCnt++] = DefaultTxProbs.p8x8[i][j];
+        }
+    }
+    for (i = 0; i < CODEC_VP9_TX_SIZE_CONTEXTS; i++)
+    {
+        for (j = 0; j < CODEC_VP9_TX_SIZES - 2; j++)
+        {
+            ctxBuffer[byteCnt++] = DefaultTxProbs.p16x16[i][j];
+        }
+    }
+    for (i = 0; i < CODEC_VP9_TX_SIZE_CONTEXTS; i++)
+    {
+        for (j = 0; j < CODEC_VP9_TX_SIZES - 1; j++)
+        {
+            ctxBuffer[byteCnt++] = DefaultTxProbs.p32x32[i][j];
+        }
+    }
+
+    //52 bytes of zeros
+    byteCnt += 52;
+
+    uint8_t blocktype = 0;
+    uint8_t reftype = 0;
+    uint8_t coeffbands = 0;
+    uint8_t unConstrainedNodes = 0;
+    uint8_t prevCoefCtx = 0;
+    //coeff probs
+    for (blocktype = 0; blocktype < CODEC_VP9_BLOCK_TYPES; blocktype++)
+    {
+        for (reftype = 0; reftype < CODEC_VP9_REF_TYPES; reftype++)
+        {
+            for (coeffbands = 0; coeffbands < CODEC_VP9_COEF_BANDS; coeffbands++)
+            {
+                uint8_t numPrevCoeffCtxts = (coeffbands == 0) ? 3 : CODEC_VP9_PREV_COEF_CONTEXTS;
+                for (prevCoefCtx = 0; prevCoefCtx < numPrevCoeffCtxts; prevCoefCtx++)
+                {
+                    for (unConstrainedNodes = 0; unConstrainedNodes < CODEC_VP9_UNCONSTRAINED_NODES; unConstrainedNodes++)
+                    {
+                        ctxBuffer[byteCnt++] = DefaultCoefProbs4x4[blocktype][reftype][coeffbands][prevCoefCtx][unConstrainedNodes];
+                    }
+                }
+            }
+        }
+    }
+
+    for (blocktype = 0; blocktype < CODEC_VP9_BLOCK_TYPES; blocktype++)
+    {
+        for (reftype = 0; reftype < CODEC_VP9_REF_TYPES; reftype++)
+        {
+            for (coeffbands = 0; coeffbands < CODEC_VP9_COEF_BANDS; coeffbands++)
+            {
+                uint8_t numPrevCoeffCtxts = (coeffbands == 0) ? 3 : CODEC_VP9_PREV_COEF_CONTEXTS;
+                for (prevCoefCtx = 0; prevCoefCtx < numPrevCoeffCtxts; prevCoefCtx++)
+                {
+                    for (unConstrainedNodes = 0; unConstrainedNodes < CODEC_VP9_UNCONSTRAINED_NODES; unConstrainedNodes++)
+                    {
+                        ctxBuffer[byteCnt++] = DefaultCoefPprobs8x8[blocktype][reftype][coeffbands][prevCoefCtx][unConstrainedNodes];
+                    }
+                }
+            }
+        }
+    }
+
+    for (blocktype = 0; blocktype < CODEC_VP9_BLOCK_TYPES; blocktype++)
+    {
+        for (reftype = 0; reftype < CODEC_VP9_REF_TYPES; reftype++)
+        {
+            for (coeffbands = 0; coeffbands < CODEC_VP9_COEF_BANDS; coeffbands++)
+            {
+                uint8_t numPrevCoeffCtxts = (coeffbands == 0) ? 3 : CODEC_VP9_PREV_COEF_CONTEXTS;
+                for (prevCoefCtx = 0; prevCoefCtx < numPrevCoeffCtxts; prevCoefCtx++)
+                {
+                    for (unConstrainedNodes = 0; unConstrainedNodes < CODEC_VP9_UNCONSTRAINED_NODES; unConstrainedNodes++)
+                    {
+                        ctxBuffer[byteCnt++] = DefaultCoefProbs16x16[blocktype][reftype][coeffbands][prevCoefCtx][unConstrainedNodes];
+                    }
+                }
+            }
+        }
+    }
+
+    for (blocktype = 0; blocktype < CODEC_VP9_BLOCK_TYPES; blocktype++)
+    {
+        for (reftype = 0; reftype < CODEC_VP9_REF_TYPES; reftype++)
+        {
+            for (coeffbands = 0; coeffbands < CODEC_VP9_COEF_BANDS; coeffbands++)
+            {
+                uint8_t numPrevCoeffCtxts = (coeffbands == 0) ? 3 : CODEC_VP9_PREV_COEF_CONTEXTS;
+                for (prevCoefCtx = 0; prevCoefCtx < numPrevCoeffCtxts; prevCoefCtx++)
+                {
+                    for (unConstrainedNodes = 0; unConstrainedNodes < CODEC_VP9_UNCONSTRAINED_NODES; unConstrainedNodes++)
+                    {
+                        ctxBuffer[byteCnt++] = DefaultCoefProbs32x32[blocktype][reftype][coeffbands][prevCoefCtx][unConstrainedNodes];
+                    }
+                }
+            }
+        }
+    }
+
+    //16 bytes of zeros
+    byteCnt += 16;
+
+    // mb skip probs
+    for (i = 0; i < CODEC_VP9_MBSKIP_CONTEXTS; i++)
+    {
+        ctxBuffer[byteCnt++] = DefaultMbskipProbs[i];
+    }
+
+    // populate prob values which are different between Key and Non-Key frame
+    CodecHalVp9BuildCtxBufDiff(ctxBuffer, setToKey);
+
+    //skip Seg tree/pred probs, updating not done in this function.
+    byteCnt = CODEC_VP9_SEG_PROB_OFFSET;
+    byteCnt += 7;
+    byteCnt += 3;
+
+    //28 bytes of zeros
+    for (i = 0; i < 28; i++)
+    {
+        ctxBuffer[byteCnt++] = 0;
+    }
+
+    //Just a check.
+    if (byteCnt > CODEC_VP9_PROB_MAX_NUM_ELEM)
+    {
+        CODECHAL_PUBLIC_ASSERTMESSAGE("Error: FrameContext array out-of-bounds, byteCnt = %d!\n", byteCnt);
+        return MOS_STATUS_NO_SPACE;
+    }
+    else
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+}
+
+//!
+//! \brief    Build a default context image and locate the runs written by the diff init
+//! \details  The diff init leaves some bytes untouched, so it is run over two buffers with
+//!           different fill patterns; bytes that keep both fills are not written by it.
+//!
+static void CodecHalVp9BuildDefaultCtxImage(
+    CODECHAL_VP9_DEFAULT_CTX_IMAGE  *ctxImage,
+    bool                            setToKey)
+{
+    MOS_ZeroMemory(ctxImage, sizeof(*ctxImage));
+    ctxImage->status = CodecHalVp9BuildContextBuffer(ctxImage->data, setToKey);
+
+    uint8_t zeroFill[CODEC_VP9_PROB_MAX_NUM_ELEM];
+    uint8_t oneFill[CODEC_VP9_PROB_MAX_NUM_ELEM];
+    MOS_FillMemory(zeroFill, sizeof(zeroFill), 0);
+    MOS_FillMemory(oneFill, sizeof(oneFill), 0xff);
+    CodecHalVp9BuildCtxBufDiff(zeroFill, setToKey);
+    CodecHalVp9BuildCtxBufDiff(oneFill, setToKey);
+
+    bool inRun = false;
+    for (uint32_t i = 0; i < CODEC_VP9_SEG_PROB_OFFSET; i++)
+    {
+        bool written = (zeroFill[i] != 0) || (oneFill[i] != 0xff);
+        if (written && !inRun)
+        {
+            if (ctxImage->diffRunCount >= CODECHAL_VP9_CTX_DIFF_MAX_RUNS)
+            {
+                CODECHAL_PUBLIC_ASSERTMESSAGE("Too many VP9 context diff runs.");
+                ctxImage->status = MOS_STATUS_NO_SPACE;
+                return;
+            }
+            ctxImage->diffRunOffset[ctxImage->diffRunCount] = i;
+            ctxImage->diffRunSize[ctxImage->diffRunCount]   = 0;
+            ctxImage->diffRunCount++;
+        }
+        if (written)
+        {
+            ctxImage->diffRunSize[ctxImage->diffRunCount - 1]++;
+        }
+        inRun = written;
+    }
+}
+
+//!
+//! \brief    Get the prebuilt default context image for key or non-key frames
+//! \details  Images are built once on first use and are immutable afterwards
+//!
+static const CODECHAL_VP9_DEFAULT_CTX_IMAGE *CodecHalVp9GetDefaultCtxImage(bool setToKey)
+{
+    struct DefaultCtxImages
+    {
+        DefaultCtxImages()
+        {
+            CodecHalVp9BuildDefaultCtxImage(&images[0], false);
+            CodecHalVp9BuildDefaultCtxImage(&images[1], true);
+        }
+        CODECHAL_VP9_DEFAULT_CTX_IMAGE images[2];
+    };
+    static const DefaultCtxImages defaultCtxImages;
+
+    return &defaultCtxImages.images[setToKey ? 1 : 0];
+}
+
+MOS_STATUS CodecHalVp9ContextBufferInit(
+    uint8_t             *ctxBuffer,
+    bool                 setToKey)
+{
+    CODECHAL_PUBLIC_CHK_NULL_RETURN(ctxBuffer);
+
+    const CODECHAL_VP9_DEFAULT_CTX_IMAGE *ctxImage = CodecHalVp9GetDefaultCtxImage(setToKey);
+    CODECHAL_PUBLIC_CHK_STATUS_RETURN(ctxImage->status);
+
+    // Seg tree/pred probs are not updated here, the rest of the buffer is the default image
+    CODECHAL_PUBLIC_CHK_STATUS_RETURN(MOS_SecureMemcpy(
+        ctxBuffer,
+        CODEC_VP9_SEG_PROB_OFFSET,
+        ctxImage->data,
+        CODEC_VP9_SEG_PROB_OFFSET));
+    MOS_ZeroMemory(
+        ctxBuffer + CODEC_VP9_SEG_PROB_OFFSET + CODECHAL_VP9_SEG_PROB_SIZE,
+        CODEC_VP9_PROB_MAX_NUM_ELEM - CODEC_VP9_SEG_PROB_OFFSET - CODECHAL_VP9_SEG_PROB_SIZE);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS CodecHalVp9CtxBufDiffInit(
+    uint8_t             *ctxBuffer,
+    bool                 setToKey)
+{
+    CODECHAL_PUBLIC_CHK_NULL_RETURN(ctxBuffer);
+
+    const CODECHAL_VP9_DEFAULT_CTX_IMAGE *ctxImage = CodecHalVp9GetDefaultCtxImage(setToKey);
+    CODECHAL_PUBLIC_CHK_STATUS_RETURN(ctxImage->status);
+
+    for (uint32_t i = 0; i < ctxImage->diffRunCount; i++)
+    {
+        CODECHAL_PUBLIC_CHK_STATUS_RETURN(MOS_SecureMemcpy(
+            ctxBuffer + ctxImage->diffRunOffset[i],
+            ctxImage->diffRunSize[i],
+            ctxImage->data + ctxImage->diffRunOffset[i],
+            ctxImage->diffRunSize[i]));
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
@@ -0,0 +1,98 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     codechal_vp9_ctx_image.h
+//! \brief    Defines the default VP9 probability context images shared by decoder and encoder.
+//!
+
+#ifndef __CODECHAL_VP9_CTX_IMAGE_H__
+#define __CODECHAL_VP9_CTX_IMAGE_H__
+
+#include "mos_defs.h"
+
+//!
+//! \brief    Init VP9 probability context buffer with default probs
+//! \details  Copies the prebuilt default context image for key or non-key frames.
+//!           Shared by VP9 decoder and encoder, seg tree/pred probs are left untouched.
+//!
+//! \param    [in,out] ctxBuffer
+//!           Pointer to context buffer of CODEC_VP9_PROB_MAX_NUM_ELEM bytes
+//! \param    [in] setToKey
+//!           Specify if it's key frame
+//!
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS CodecHalVp9ContextBufferInit(
+        uint8_t   *ctxBuffer,
+        bool       setToKey);
+
+//!
+//! \brief    Reset VP9 probs which are different between key and non-key frames
+//! \details  Copies only the runs of the prebuilt default image the diff reset covers,
+//!           other bytes of the context buffer are left untouched.
+//!
+//! \param    [in,out] ctxBuffer
+//!           Pointer to context buffer of CODEC_VP9_PROB_MAX_NUM_ELEM bytes
+//! \param    [in] setToKey
+//!           Specify if it's key frame
+//!
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS CodecHalVp9CtxBufDiffInit(
+        uint8_t   *ctxBuffer,
+        bool       setToKey);
+
+//!
+//! \brief    Build VP9 default probability context byte by byte
+//! \details  Source of the prebuilt image used by CodecHalVp9ContextBufferInit.
+//!
+//! \param    [in,out] ctxBuffer
+//!           Pointer to context buffer of CODEC_VP9_PROB_MAX_NUM_ELEM bytes
+//! \param    [in] setToKey
+//!           Specify if it's key frame
+//!
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS CodecHalVp9BuildContextBuffer(
+        uint8_t   *ctxBuffer,
+        bool       setToKey);
+
+//!
+//! \brief    Build VP9 probs which are different between key and non-key frames byte by byte
+//! \details  Source of the runs copied by CodecHalVp9CtxBufDiffInit.
+//!
+//! \param    [in,out] ctxBuffer
+//!           Pointer to context buffer of CODEC_VP9_PROB_MAX_NUM_ELEM bytes
+//! \param    [in] setToKey
+//!           Specify if it's key frame
+//!
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS CodecHalVp9BuildCtxBufDiff(
+        uint8_t   *ctxBuffer,
+        bool       setToKey);
+
+#endif  // __CODECHAL_VP9_CTX_IMAGE_H__
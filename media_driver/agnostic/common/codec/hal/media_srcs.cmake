@@ -23,6 +23,7 @@ set(TMP_1_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/codechal.cpp
     ${CMAKE_CURRENT_LIST_DIR}/codechal_hw.cpp
     ${CMAKE_CURRENT_LIST_DIR}/codechal_utilities.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/codechal_vp9_ctx_image.cpp
     ${CMAKE_CURRENT_LIST_DIR}/codechal_mmc.cpp
     ${CMAKE_CURRENT_LIST_DIR}/codechal_debug_config_manager.cpp
     ${CMAKE_CURRENT_LIST_DIR}/codechal_debug.cpp
@@ -34,6 +35,7 @@ set(TMP_1_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/codechal.h
     ${CMAKE_CURRENT_LIST_DIR}/codechal_hw.h
     ${CMAKE_CURRENT_LIST_DIR}/codechal_utilities.h
+    ${CMAKE_CURRENT_LIST_DIR}/codechal_vp9_ctx_image.h
     ${CMAKE_CURRENT_LIST_DIR}/codechal_mmc.h
     ${CMAKE_CURRENT_LIST_DIR}/codechal_debug_config_manager.h
     ${CMAKE_CURRENT_LIST_DIR}/codechal_debug.h
@@ -75,6 +77,9 @@ set(TMP_2_SOURCES_
 set(TMP_2_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_nv12top010.h
     ${CMAKE_CURRENT_LIST_DIR}/codechal_decoder.h
+    ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_ytile_copy.h
+    ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_bitstream_chain.h
+    ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_hevc_ref_idx.h
     ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_histogram.h
     ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_histogram_vebox.h
     ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_singlepipe_virtualengine.h
@@ -201,6 +206,7 @@ if(${MPEG2_Decode_Supported} STREQUAL "yes")
     set(TMP_2_HEADERS_
         ${TMP_2_HEADERS_}
         ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_mpeg2.h
+        ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_mpeg2_mv_pack.h
     )
 
     if(${MMC_Supported} STREQUAL "yes")
@@ -223,6 +229,7 @@ if(${VC1_Decode_Supported} STREQUAL "yes")
     set(TMP_2_HEADERS_
         ${TMP_2_HEADERS_}
         ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_vc1.h
+        ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_vc1_vlc.h
     )
 
     if(${MMC_Supported} STREQUAL "yes")
@@ -245,6 +252,7 @@ if(${VP8_Decode_Supported} STREQUAL "yes")
     set(TMP_2_HEADERS_
         ${TMP_2_HEADERS_}
         ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_vp8.h
+        ${CMAKE_CURRENT_LIST_DIR}/codechal_decode_vp8_bool_decoder.h
     )
 
     if(${MMC_Supported} STREQUAL "yes")
@@ -80,6 +80,24 @@ public:
         return m_blockManager.SubmitBlocks(blocks);
     }
 
+    //!
+    //! \brief   Keeps a block from being reclaimed until a later submission completes
+    //! \details Allows clients to reference the contents of an already submitted block
+    //!          from a later submission instead of copying them into a new block.
+    //! \param   [in] block
+    //!          Block to be referenced, must not have been reclaimed yet
+    //! \param   [in] trackerIndex
+    //!          Index of the tracker used by the referencing submission
+    //! \param   [in] trackerId
+    //!          Tracker ID of the referencing submission
+    //! \return  MOS_STATUS
+    //!          MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ExtendBlockLifetime(MemoryBlock &block, uint32_t trackerIndex, uint32_t trackerId)
+    {
+        return m_blockManager.ExtendBlockLifetime(block, trackerIndex, trackerId);
+    }
+
     //!
     //! \brief   Makes a block available in the heap.
     //! \details Expected to be used only when the behavior selected in HeapManager is client
@@ -135,6 +135,45 @@ MOS_STATUS MemoryBlockManager::SubmitBlocks(std::vector<MemoryBlock> &blocks)
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS MemoryBlockManager::ExtendBlockLifetime(
+    MemoryBlock &block,
+    uint32_t trackerIndex,
+    uint32_t trackerId)
+{
+    HEAP_FUNCTION_ENTER_VERBOSE;
+
+    if (!block.IsValid())
+    {
+        HEAP_ASSERTMESSAGE("Block is not valid and may not be referenced");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+    if (!m_useProducer || m_trackerProducer == nullptr)
+    {
+        HEAP_ASSERTMESSAGE("Block lifetime may only be extended when a tracker producer is registered");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+    if (trackerIndex >= MAX_TRACKER_NUMBER || trackerId == MemoryBlockInternal::m_invalidTrackerId)
+    {
+        HEAP_ASSERTMESSAGE("Invalid tracker");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    auto internalBlock = block.GetInternalBlock();
+    HEAP_CHK_NULL(internalBlock);
+    if (internalBlock->GetState() != MemoryBlockInternal::State::allocated &&
+        internalBlock->GetState() != MemoryBlockInternal::State::submitted)
+    {
+        HEAP_ASSERTMESSAGE("Only allocated or submitted blocks may be referenced");
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    FrameTrackerToken *trackerToken = internalBlock->GetTrackerToken();
+    HEAP_CHK_NULL(trackerToken);
+    trackerToken->Merge(trackerIndex, trackerId);
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS MemoryBlockManager::ClearSpace(MemoryBlock &block)
 {
     HEAP_FUNCTION_ENTER;
@@ -102,6 +102,19 @@ protected:
     //!
     MOS_STATUS SubmitBlocks(std::vector<MemoryBlock> &blocks);
 
+    //!
+    //! \brief   Merges a later tracker into the tracker token of an allocated or submitted block
+    //! \param   [in] block
+    //!          Block to be referenced
+    //! \param   [in] trackerIndex
+    //!          Index of the tracker used by the referencing submission
+    //! \param   [in] trackerId
+    //!          Tracker ID of the referencing submission
+    //! \return  MOS_STATUS
+    //!          MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ExtendBlockLifetime(MemoryBlock &block, uint32_t trackerIndex, uint32_t trackerId);
+
     //!
     //! \brief   Either directly adds a block to the free list, or prepares it to be added
     //! \param   [in] block
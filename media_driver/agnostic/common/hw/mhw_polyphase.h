@@ -0,0 +1,240 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mhw_polyphase.h
+//! \brief    Polyphase table calculation and cache shared by the AVS table generators.
+//! \details  Only depends on MOS definitions, the filter kernel and the table calculation
+//!           are passed in by the caller, so cached tables can be checked against
+//!           calculated ones.
+//!
+#ifndef __MHW_POLYPHASE_H__
+#define __MHW_POLYPHASE_H__
+
+#include <math.h>
+#include <mutex>
+#include <string.h>
+#include "mos_defs.h"
+
+#define MHW_POLYPHASE_MAX_Y_ENTRIES     8
+
+//!
+//! \brief    Calculate the Y polyphase table from a filter kernel
+//! \details  Every phase samples kernel(x) around the center pixel, is optionally convolved
+//!           with a 3 tap high pass filter, then normalized and quantized so that the
+//!           coefficients of each phase sum up to coefUnit.
+//! \param    [out] coefs
+//!           Table of hwPhase * numEntries coefficients
+//! \param    [in] scaleFactor
+//!           Scaling factor the kernel positions are multiplied with
+//! \param    [in] numEntries
+//!           Number of coefficients per phase
+//! \param    [in] hwPhase
+//!           Number of phases in HW
+//! \param    [in] phaseCount
+//!           Number of phases used for calculation
+//! \param    [in] coefUnit
+//!           Quantized value of 1.0
+//! \param    [in] convolveHP
+//!           Convolve with the high pass filter. A zero strength one is identity, so callers
+//!           only convolve with non-zero strength.
+//! \param    [in] hpStrength
+//!           High pass strength
+//! \param    [in] kernel
+//!           Filter kernel, kernel(x) is the unnormalized coefficient at position x
+//! \param    [in] sinc
+//!           sinc(x) used for the high pass filter
+//!
+template<class Kernel, class Sinc>
+void Mhw_CalcPolyphaseCoefsY(
+    int32_t     *coefs,
+    float       scaleFactor,
+    uint32_t    numEntries,
+    uint32_t    hwPhase,
+    uint32_t    phaseCount,
+    int32_t     coefUnit,
+    bool        convolveHP,
+    float       hpStrength,
+    Kernel      kernel,
+    Sinc        sinc)
+{
+    float   phaseCoefs[MHW_POLYPHASE_MAX_Y_ENTRIES]     = {};
+    float   phaseCoefsCopy[MHW_POLYPHASE_MAX_Y_ENTRIES] = {};
+    float   hpFilter[3], hpSum, hpHalfPhase;
+    float   base, pos, sumCoefs;
+    int32_t centerPixel = numEntries / 2 - 1;
+    float   startOffset = (float)(-centerPixel);
+    int32_t sumQuantCoefs;
+
+    for (uint32_t i = 0; i < hwPhase; i++)
+    {
+        base     = startOffset - (float)i / (float)phaseCount;
+        sumCoefs = 0.0F;
+
+        for (uint32_t j = 0; j < numEntries; j++)
+        {
+            pos = base + (float)j;
+            phaseCoefs[j] = phaseCoefsCopy[j] = kernel(pos * scaleFactor);
+            sumCoefs += phaseCoefs[j];
+        }
+
+        if (convolveHP)
+        {
+            if (i <= phaseCount / 2)
+            {
+                hpHalfPhase = (float)i / (float)phaseCount;
+            }
+            else
+            {
+                hpHalfPhase = (float)(phaseCount - i) / (float)phaseCount;
+            }
+            hpFilter[0] = hpFilter[2] = -hpStrength * sinc(hpHalfPhase * MOS_PI);
+            hpFilter[1] = 1.0F + 2.0F * hpStrength;
+
+            for (uint32_t j = 0; j < numEntries; j++)
+            {
+                hpSum = 0.0F;
+                for (int32_t k = -1; k <= 1; k++)
+                {
+                    if ((((long)j + k) >= 0) && (j + k < numEntries))
+                    {
+                        hpSum += phaseCoefsCopy[(int32_t)j + k] * hpFilter[k + 1];
+                    }
+                    phaseCoefs[j] = hpSum;
+                }
+            }
+        }
+
+        // Normalize coefs and save
+        sumQuantCoefs = 0;
+        for (uint32_t j = 0; j < numEntries; j++)
+        {
+            coefs[i * numEntries + j] = (int32_t)floor(0.5F + (float)coefUnit * phaseCoefs[j] / sumCoefs);
+            sumQuantCoefs += coefs[i * numEntries + j];
+        }
+
+        // Fix center coef so that filter is balanced
+        if (i <= phaseCount / 2)
+        {
+            coefs[i * numEntries + centerPixel] -= sumQuantCoefs - coefUnit;
+        }
+        else
+        {
+            coefs[i * numEntries + centerPixel + 1] -= sumQuantCoefs - coefUnit;
+        }
+    }
+}
+
+//!
+//! \brief    Polyphase tables of the most recently used keys
+//! \details  A table must only depend on its key, which is compared by Key::operator==.
+//!           Tables of up to MaxCoefs coefficients are cached, entries are replaced in
+//!           least recently used order.
+//!
+template<class Key, uint32_t MaxCoefs, uint32_t Size>
+class MhwPolyphaseCache
+{
+public:
+    //!
+    //! \brief    Get the table of key
+    //! \param    [in] key
+    //!           All parameters the table depends on
+    //! \param    [out] coefs
+    //!           Table of key
+    //! \param    [in] numCoefs
+    //!           Number of coefficients in the table
+    //! \param    [in] calc
+    //!           Calculates the table by calc(coefs) if it is not cached
+    //!
+    template<class Calc>
+    void Get(const Key &key, int32_t *coefs, uint32_t numCoefs, Calc calc)
+    {
+        if (numCoefs > MaxCoefs)
+        {
+            calc(coefs);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto &entry : m_entries)
+            {
+                if (entry.valid && entry.numCoefs == numCoefs && entry.key == key)
+                {
+                    memcpy(coefs, entry.coefs, numCoefs * sizeof(int32_t));
+                    entry.lastUsed = ++m_tick;
+                    return;
+                }
+            }
+        }
+
+        // Calculate without lock, the same table calculated by another thread meanwhile
+        // is just added twice.
+        calc(coefs);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Entry *victim = &m_entries[0];
+        for (auto &entry : m_entries)
+        {
+            if (!entry.valid)
+            {
+                victim = &entry;
+                break;
+            }
+            if (entry.lastUsed < victim->lastUsed)
+            {
+                victim = &entry;
+            }
+        }
+        memcpy(victim->coefs, coefs, numCoefs * sizeof(int32_t));
+        victim->key      = key;
+        victim->numCoefs = numCoefs;
+        victim->valid    = true;
+        victim->lastUsed = ++m_tick;
+        m_calcCount++;
+    }
+
+    //!
+    //! \brief    Number of cached tables calculated since the cache being created
+    //!
+    uint32_t GetCalcCount()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_calcCount;
+    }
+
+private:
+    struct Entry
+    {
+        Key      key;
+        bool     valid;
+        uint32_t lastUsed;
+        uint32_t numCoefs;
+        int32_t  coefs[MaxCoefs];
+    };
+
+    std::mutex m_mutex;
+    Entry      m_entries[Size] = {};
+    uint32_t   m_tick          = 0;
+    uint32_t   m_calcCount     = 0;
+};
+
+#endif // __MHW_POLYPHASE_H__
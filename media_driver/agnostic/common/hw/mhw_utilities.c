@@ -27,6 +27,7 @@
 #include "mhw_render.h"
 #include "mhw_state_heap.h"
 #include "hal_oca_interface.h"
+#include "mhw_polyphase.h"
 
 #define MHW_NS_PER_TICK_RENDER_ENGINE 80  // 80 nano seconds per tick in render engine
 
@@ -486,6 +487,52 @@ finish:
     return eStatus;
 }
 
+//!
+//! \brief    Polyphase table cache
+//! \details  Polyphase tables only depend on their input parameters and are
+//!           recalculated by every AVS user (composition, vebox/SFC, HDR) on
+//!           each scaling ratio change. Keep recently calculated tables in a
+//!           process wide cache, replaced in least recently used order.
+//!
+#define MHW_POLYPHASE_CACHE_SIZE        16
+#define MHW_POLYPHASE_CACHE_MAX_COEFS   (NUM_POLYPHASE_Y_ENTRIES * NUM_HW_POLYPHASE_TABLES)
+
+C_ASSERT(MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT <= MHW_POLYPHASE_CACHE_MAX_COEFS);
+C_ASSERT(NUM_POLYPHASE_Y_ENTRIES <= MHW_POLYPHASE_MAX_Y_ENTRIES);
+
+typedef enum _MHW_POLYPHASE_TABLE_TYPE
+{
+    MHW_POLYPHASE_TABLE_Y = 1,
+    MHW_POLYPHASE_TABLE_UV,
+    MHW_POLYPHASE_TABLE_UV_OFFSET
+} MHW_POLYPHASE_TABLE_TYPE;
+
+typedef struct _MHW_POLYPHASE_CACHE_KEY
+{
+    MHW_POLYPHASE_TABLE_TYPE    Type;
+    float                       fScaleFactor;
+    float                       fParam;             //!< HP strength for Y, Lanczos factor for UV
+    uint32_t                    dwPlane;
+    MOS_FORMAT                  srcFmt;
+    uint32_t                    dwHwPhase;
+    int32_t                     iUvPhaseOffset;
+    bool                        bUse8x8Filter;
+
+    bool operator==(const _MHW_POLYPHASE_CACHE_KEY &Key) const
+    {
+        return Type           == Key.Type           &&
+               fScaleFactor   == Key.fScaleFactor   &&
+               fParam         == Key.fParam         &&
+               dwPlane        == Key.dwPlane        &&
+               srcFmt         == Key.srcFmt         &&
+               dwHwPhase      == Key.dwHwPhase      &&
+               iUvPhaseOffset == Key.iUvPhaseOffset &&
+               bUse8x8Filter  == Key.bUse8x8Filter;
+    }
+} MHW_POLYPHASE_CACHE_KEY;
+
+static MhwPolyphaseCache<MHW_POLYPHASE_CACHE_KEY, MHW_POLYPHASE_CACHE_MAX_COEFS, MHW_POLYPHASE_CACHE_SIZE> g_MhwPolyphaseCache;
+
 //!
 //! \brief      Sets Nearest Mode Table for Gen75/9, across SFC and Render engine to set the sampler states
 //! \details    This function sets Coefficients for Nearest Mode
@@ -577,17 +624,9 @@ MOS_STATUS Mhw_CalcPolyphaseTablesY(
     float           fLanczosT)
 {
     uint32_t                dwNumEntries;
-    uint32_t                dwTableCoefUnit;
-    uint32_t                i, j;
-    int32_t                 k;
+    bool                    bConvolveHP;
     MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
-    float                   fPhaseCoefs[NUM_POLYPHASE_Y_ENTRIES];
-    float                   fPhaseCoefsCopy[NUM_POLYPHASE_Y_ENTRIES];
-    float                   fStartOffset;
-    float                   fHPFilter[3], fHPSum, fHPHalfPhase; // Only used for Y_PLANE
-    float                   fBase, fPos, fSumCoefs;
-    int32_t                 iCenterPixel;
-    int32_t                 iSumQuantCoefs;
+    MHW_POLYPHASE_CACHE_KEY CacheKey;
 
     MHW_FUNCTION_ENTER;
 
@@ -603,13 +642,6 @@ MOS_STATUS Mhw_CalcPolyphaseTablesY(
         dwNumEntries = NUM_POLYPHASE_UV_ENTRIES;
     }
 
-    MOS_ZeroMemory(fPhaseCoefs    , sizeof(fPhaseCoefs));
-    MOS_ZeroMemory(fPhaseCoefsCopy, sizeof(fPhaseCoefsCopy));
-
-    dwTableCoefUnit = 1 << MHW_AVS_TBL_COEF_PREC;
-    iCenterPixel = dwNumEntries / 2 - 1;
-    fStartOffset = (float)(-iCenterPixel);
-
     if ((IS_YUV_FORMAT(srcFmt)    &&
         dwPlane != MHW_U_PLANE    &&
         dwPlane != MHW_V_PLANE)   ||
@@ -632,73 +664,36 @@ MOS_STATUS Mhw_CalcPolyphaseTablesY(
         fLanczosT = 2.0F;
     }
 
-    for (i = 0; i < dwHwPhase; i++)
-    {
-        fBase = fStartOffset - (float)i / (float)NUM_POLYPHASE_TABLES;
-        fSumCoefs = 0.0F;
-
-        for (j = 0; j < dwNumEntries; j++)
-        {
-            fPos = fBase + (float)j;
-
-            if (bUse8x8Filter)
-            {
-                fPhaseCoefs[j] = fPhaseCoefsCopy[j] = MOS_Lanczos(fPos * fScaleFactor, dwNumEntries, fLanczosT);
-            }
-            else
-            {
-                fPhaseCoefs[j] = fPhaseCoefsCopy[j] = MOS_Lanczos_g(fPos * fScaleFactor, NUM_POLYPHASE_5x5_Y_ENTRIES, fLanczosT);
-            }
-
-            fSumCoefs += fPhaseCoefs[j];
-        }
-
-        // Convolve with HP
-        if (dwPlane == MHW_GENERIC_PLANE || dwPlane == MHW_Y_PLANE)
-        {
-            if (i <= NUM_POLYPHASE_TABLES / 2)
-            {
-                fHPHalfPhase = (float)i / (float)NUM_POLYPHASE_TABLES;
-            }
-            else
-            {
-                fHPHalfPhase = (float)(NUM_POLYPHASE_TABLES - i) / (float)NUM_POLYPHASE_TABLES;
-            }
-            fHPFilter[0] = fHPFilter[2] = -fHPStrength * MOS_Sinc(fHPHalfPhase * MOS_PI);
-            fHPFilter[1] = 1.0F + 2.0F * fHPStrength;
-
-            for (j = 0; j < dwNumEntries; j++)
-            {
-                fHPSum = 0.0F;
-                for (k = -1; k <= 1; k++)
-                {
-                    if ((((long)j + k) >= 0) && (j + k < dwNumEntries))
-                    {
-                        fHPSum += fPhaseCoefsCopy[(int32_t)j+k] * fHPFilter[k+1];
-                    }
-                    fPhaseCoefs[j] = fHPSum;
-                }
-            }
-        }
-
-        // Normalize coefs and save
-        iSumQuantCoefs = 0;
-        for (j = 0; j < dwNumEntries; j++)
-        {
-            iCoefs[i * dwNumEntries + j] = (int32_t)floor(0.5F + (float)dwTableCoefUnit * fPhaseCoefs[j] / fSumCoefs);
-            iSumQuantCoefs += iCoefs[i * dwNumEntries + j];
-        }
-
-        // Fix center coef so that filter is balanced
-        if (i <= NUM_POLYPHASE_TABLES / 2)
-        {
-            iCoefs[i * dwNumEntries + iCenterPixel] -= iSumQuantCoefs - dwTableCoefUnit;
-        }
-        else
-        {
-            iCoefs[i * dwNumEntries + iCenterPixel + 1] -= iSumQuantCoefs - dwTableCoefUnit;
-        }
-    }
+    // Convolve with HP, a zero strength HP filter is identity
+    bConvolveHP = (dwPlane == MHW_GENERIC_PLANE || dwPlane == MHW_Y_PLANE) && fHPStrength != 0.0F;
+
+    // fLanczosT is derived from the key fields, so it is not part of the key
+    MOS_ZeroMemory(&CacheKey, sizeof(CacheKey));
+    CacheKey.Type           = MHW_POLYPHASE_TABLE_Y;
+    CacheKey.fScaleFactor   = fScaleFactor;
+    CacheKey.fParam         = fHPStrength;
+    CacheKey.dwPlane        = dwPlane;
+    CacheKey.srcFmt         = srcFmt;
+    CacheKey.dwHwPhase      = dwHwPhase;
+    CacheKey.bUse8x8Filter  = bUse8x8Filter;
+
+    g_MhwPolyphaseCache.Get(CacheKey, iCoefs, dwHwPhase * dwNumEntries, [&](int32_t *piCoefs) {
+        Mhw_CalcPolyphaseCoefsY(
+            piCoefs,
+            fScaleFactor,
+            dwNumEntries,
+            dwHwPhase,
+            NUM_POLYPHASE_TABLES,
+            1 << MHW_AVS_TBL_COEF_PREC,
+            bConvolveHP,
+            fHPStrength,
+            [&](float x) {
+                return bUse8x8Filter ?
+                    MOS_Lanczos(x, dwNumEntries, fLanczosT) :
+                    MOS_Lanczos_g(x, NUM_POLYPHASE_5x5_Y_ENTRIES, fLanczosT);
+            },
+            MOS_Sinc);
+    });
 
 finish:
     return eStatus;
@@ -727,67 +722,75 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUV(
     int32_t     minCoef[MHW_SCALER_UV_WIN_SIZE];
     int32_t     maxCoef[MHW_SCALER_UV_WIN_SIZE];
     int32_t     i, j;
+    MHW_POLYPHASE_CACHE_KEY CacheKey;
     MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
 
     MHW_FUNCTION_ENTER;
 
     MHW_CHK_NULL(piCoefs);
 
-    phaseCount      = MHW_TABLE_PHASE_COUNT;
-    centerPixel     = (MHW_SCALER_UV_WIN_SIZE / 2) - 1;
-    startOffset     = (double)(-centerPixel);
-    tableCoefUnit   = 1 << MHW_TBL_COEF_PREC;
-    sf              = MOS_MIN(1.0, fInverseScaleFactor); // Sf isn't used for upscaling
+    MOS_ZeroMemory(&CacheKey, sizeof(CacheKey));
+    CacheKey.Type           = MHW_POLYPHASE_TABLE_UV;
+    CacheKey.fScaleFactor   = fInverseScaleFactor;
+    CacheKey.fParam         = fLanczosT;
 
-    MOS_ZeroMemory(piCoefs, sizeof(int32_t) * MHW_SCALER_UV_WIN_SIZE * phaseCount);
-    MOS_ZeroMemory(minCoef, sizeof(minCoef));
-    MOS_ZeroMemory(maxCoef, sizeof(maxCoef));
+    g_MhwPolyphaseCache.Get(CacheKey, piCoefs, MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT, [&](int32_t *piTable) {
+        phaseCount      = MHW_TABLE_PHASE_COUNT;
+        centerPixel     = (MHW_SCALER_UV_WIN_SIZE / 2) - 1;
+        startOffset     = (double)(-centerPixel);
+        tableCoefUnit   = 1 << MHW_TBL_COEF_PREC;
+        sf              = MOS_MIN(1.0, fInverseScaleFactor); // Sf isn't used for upscaling
 
-    if (sf < 1.0F)
-    {
-        fLanczosT = 2.0F;
-    }
+        MOS_ZeroMemory(piTable, sizeof(int32_t) * MHW_SCALER_UV_WIN_SIZE * phaseCount);
+        MOS_ZeroMemory(minCoef, sizeof(minCoef));
+        MOS_ZeroMemory(maxCoef, sizeof(maxCoef));
 
-    for(i = 0; i < phaseCount; ++i, piCoefs += MHW_SCALER_UV_WIN_SIZE)
-    {
-        // Write all
-        // Note - to shift by a half you need to a half to each phase.
-        base     = startOffset - (double)(i) / (double)(phaseCount);
-        sumCoefs = 0.0;
-
-        for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+        if (sf < 1.0F)
         {
-            pos             = base + (double) j;
-            phaseCoefs[j]   = MOS_Lanczos((float)(pos * sf), MHW_SCALER_UV_WIN_SIZE, fLanczosT);
-            sumCoefs        += phaseCoefs[j];
+            fLanczosT = 2.0F;
         }
-        // Normalize coefs and save
-        for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+
+        for(i = 0; i < phaseCount; ++i, piTable += MHW_SCALER_UV_WIN_SIZE)
         {
-            piCoefs[j] = (int32_t) floor((0.5 + (double)(tableCoefUnit) * (phaseCoefs[j] / sumCoefs)));
+            // Write all
+            // Note - to shift by a half you need to a half to each phase.
+            base     = startOffset - (double)(i) / (double)(phaseCount);
+            sumCoefs = 0.0;
 
-            //For debug purposes:
-            minCoef[j] = MOS_MIN(minCoef[j], piCoefs[j]);
-            maxCoef[j] = MOS_MAX(maxCoef[j], piCoefs[j]);
-        }
+            for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+            {
+                pos             = base + (double) j;
+                phaseCoefs[j]   = MOS_Lanczos((float)(pos * sf), MHW_SCALER_UV_WIN_SIZE, fLanczosT);
+                sumCoefs        += phaseCoefs[j];
+            }
+            // Normalize coefs and save
+            for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+            {
+                piTable[j] = (int32_t) floor((0.5 + (double)(tableCoefUnit) * (phaseCoefs[j] / sumCoefs)));
 
-        // Recalc center coef
-        sumQuantCoefs = 0;
-        for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
-        {
-            sumQuantCoefs += piCoefs[j];
-        }
+                //For debug purposes:
+                minCoef[j] = MOS_MIN(minCoef[j], piTable[j]);
+                maxCoef[j] = MOS_MAX(maxCoef[j], piTable[j]);
+            }
 
-        // Fix center coef so that filter is balanced
-        if (i <= phaseCount/2)
-        {
-            piCoefs[centerPixel]     -= sumQuantCoefs - tableCoefUnit;
-        }
-        else
-        {
-            piCoefs[centerPixel + 1] -= sumQuantCoefs - tableCoefUnit;
+            // Recalc center coef
+            sumQuantCoefs = 0;
+            for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+            {
+                sumQuantCoefs += piTable[j];
+            }
+
+            // Fix center coef so that filter is balanced
+            if (i <= phaseCount/2)
+            {
+                piTable[centerPixel]     -= sumQuantCoefs - tableCoefUnit;
+            }
+            else
+            {
+                piTable[centerPixel + 1] -= sumQuantCoefs - tableCoefUnit;
+            }
         }
-    }
+    });
 
 finish:
     return eStatus;
@@ -821,69 +824,78 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
     int32_t     maxCoef[MHW_SCALER_UV_WIN_SIZE];
     int32_t     i, j;
     int32_t     adjusted_phase;
+    MHW_POLYPHASE_CACHE_KEY CacheKey;
     MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
 
     MHW_FUNCTION_ENTER;
 
     MHW_CHK_NULL(piCoefs);
 
-    phaseCount = MHW_TABLE_PHASE_COUNT;
-    centerPixel = (MHW_SCALER_UV_WIN_SIZE / 2) - 1;
-    startOffset = (double)(-centerPixel +
-        (double)iUvPhaseOffset / (double)(phaseCount));
-    tableCoefUnit = 1 << MHW_TBL_COEF_PREC;
-
-    MOS_ZeroMemory(minCoef, sizeof(minCoef));
-    MOS_ZeroMemory(maxCoef, sizeof(maxCoef));
-    MOS_ZeroMemory(piCoefs, sizeof(int32_t)* MHW_SCALER_UV_WIN_SIZE * phaseCount);
-
-    sf = MOS_MIN(1.0, fInverseScaleFactor); // Sf isn't used for upscaling
-    if (sf < 1.0)
-    {
-        fLanczosT = 3.0;
-    }
-
-    for (i = 0; i < phaseCount; ++i, piCoefs += MHW_SCALER_UV_WIN_SIZE)
-    {
-        // Write all
-        // Note - to shift by a half you need to a half to each phase.
-        base = startOffset - (double)(i) / (double)(phaseCount);
-        sumCoefs = 0.0;
-
-        for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+    MOS_ZeroMemory(&CacheKey, sizeof(CacheKey));
+    CacheKey.Type           = MHW_POLYPHASE_TABLE_UV_OFFSET;
+    CacheKey.fScaleFactor   = fInverseScaleFactor;
+    CacheKey.fParam         = fLanczosT;
+    CacheKey.iUvPhaseOffset = iUvPhaseOffset;
+
+    g_MhwPolyphaseCache.Get(CacheKey, piCoefs, MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT, [&](int32_t *piTable) {
+        phaseCount = MHW_TABLE_PHASE_COUNT;
+        centerPixel = (MHW_SCALER_UV_WIN_SIZE / 2) - 1;
+        startOffset = (double)(-centerPixel +
+            (double)iUvPhaseOffset / (double)(phaseCount));
+        tableCoefUnit = 1 << MHW_TBL_COEF_PREC;
+
+        MOS_ZeroMemory(minCoef, sizeof(minCoef));
+        MOS_ZeroMemory(maxCoef, sizeof(maxCoef));
+        MOS_ZeroMemory(piTable, sizeof(int32_t)* MHW_SCALER_UV_WIN_SIZE * phaseCount);
+
+        sf = MOS_MIN(1.0, fInverseScaleFactor); // Sf isn't used for upscaling
+        if (sf < 1.0)
         {
-            pos = base + (double)j;
-            phaseCoefs[j] = MOS_Lanczos((float)(pos * sf), 6/*MHW_SCALER_UV_WIN_SIZE*/, fLanczosT);
-            sumCoefs += phaseCoefs[j];
+            fLanczosT = 3.0;
         }
-        // Normalize coefs and save
-        for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+
+        for (i = 0; i < phaseCount; ++i, piTable += MHW_SCALER_UV_WIN_SIZE)
         {
-            piCoefs[j] = (int32_t)floor((0.5 + (double)(tableCoefUnit)* (phaseCoefs[j] / sumCoefs)));
+            // Write all
+            // Note - to shift by a half you need to a half to each phase.
+            base = startOffset - (double)(i) / (double)(phaseCount);
+            sumCoefs = 0.0;
 
-            // For debug purposes:
-            minCoef[j] = MOS_MIN(minCoef[j], piCoefs[j]);
-            maxCoef[j] = MOS_MAX(maxCoef[j], piCoefs[j]);
-        }
+            for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+            {
+                pos = base + (double)j;
+                phaseCoefs[j] = MOS_Lanczos((float)(pos * sf), 6/*MHW_SCALER_UV_WIN_SIZE*/, fLanczosT);
+                sumCoefs += phaseCoefs[j];
+            }
+            // Normalize coefs and save
+            for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+            {
+                piTable[j] = (int32_t)floor((0.5 + (double)(tableCoefUnit)* (phaseCoefs[j] / sumCoefs)));
 
-        // Recalc center coef
-        sumQuantCoefs = 0;
-        for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
-        {
-            sumQuantCoefs += piCoefs[j];
-        }
+                // For debug purposes:
+                minCoef[j] = MOS_MIN(minCoef[j], piTable[j]);
+                maxCoef[j] = MOS_MAX(maxCoef[j], piTable[j]);
+            }
 
-        // Fix center coef so that filter is balanced
-        adjusted_phase = i - iUvPhaseOffset;
-        if (adjusted_phase <= phaseCount / 2)
-        {
-            piCoefs[centerPixel] -= sumQuantCoefs - tableCoefUnit;
-        }
-        else // if(adjusted_phase < phaseCount)
-        {
-            piCoefs[centerPixel + 1] -= sumQuantCoefs - tableCoefUnit;
+            // Recalc center coef
+            sumQuantCoefs = 0;
+            for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+            {
+                sumQuantCoefs += piTable[j];
+            }
+
+            // Fix center coef so that filter is balanced
+            adjusted_phase = i - iUvPhaseOffset;
+            if (adjusted_phase <= phaseCount / 2)
+            {
+                piTable[centerPixel] -= sumQuantCoefs - tableCoefUnit;
+            }
+            else // if(adjusted_phase < phaseCount)
+            {
+                piTable[centerPixel + 1] -= sumQuantCoefs - tableCoefUnit;
+            }
         }
-    }
+    });
 
 finish:
     return eStatus;
@@ -3216,6 +3216,15 @@ static MOS_USER_FEATURE_VALUE MOSUserFeatureDescFields[__MOS_USER_FEATURE_KEY_MA
         MOS_USER_FEATURE_VALUE_TYPE_UINT32,
         "0",
         "VP Surface Dump: Locking Resource"),
+    MOS_DECLARE_UF_KEY(__VPHAL_DBG_SURF_DUMP_ENABLE_ASYNC_DUMP_ID,
+        "enableAsyncDump",
+        __MEDIA_USER_FEATURE_SUBKEY_INTERNAL,
+        __MEDIA_USER_FEATURE_SUBKEY_REPORT,
+        "VP",
+        MOS_USER_FEATURE_TYPE_USER,
+        MOS_USER_FEATURE_VALUE_TYPE_UINT32,
+        "0",
+        "VP Surface dump file writing in background thread"),
     MOS_DECLARE_UF_KEY(__VPHAL_DBG_STATE_DUMP_OUTFILE_KEY_NAME_ID,
         "outfileLocation",
         __MEDIA_USER_FEATURE_VALUE_VP_DBG_STATE_DUMP_LOCATION,
@@ -3444,6 +3453,15 @@ static MOS_USER_FEATURE_VALUE MOSUserFeatureDescFields[__MOS_USER_FEATURE_KEY_MA
         MOS_USER_FEATURE_VALUE_TYPE_UINT32,
         "0",
         "Segmentation output type. 0: default, 1: mask only, 2: blending with default background 3: blending with custom background"),
+    MOS_DECLARE_UF_KEY(__VPHAL_SURFACE_POOL_BUDGET_ID,
+        "VP Surface Pool Budget",
+        __MEDIA_USER_FEATURE_SUBKEY_INTERNAL,
+        __MEDIA_USER_FEATURE_SUBKEY_REPORT,
+        "VP",
+        MOS_USER_FEATURE_TYPE_USER,
+        MOS_USER_FEATURE_VALUE_TYPE_UINT32,
+        "64",
+        "Max size in MB of free intermediate surfaces kept by VP for reuse. 0: disable surface reuse."),
 #if (_DEBUG || _RELEASE_INTERNAL)
     MOS_DECLARE_UF_KEY_DBGONLY(__VPHAL_SEGMENTATION_ENQUEUE_MODE_ID,
         "SegmentationEnqueueMode",
@@ -446,6 +446,7 @@ typedef enum _MOS_USER_FEATURE_VALUE_ID
     __VPHAL_DBG_SURF_DUMPER_ENABLE_PLANE_DUMP,
     __VPHAL_DBG_SURF_DUMP_ENABLE_AUX_DUMP_ID,
     __VPHAL_DBG_SURF_DUMPER_RESOURCE_LOCK_ID,
+    __VPHAL_DBG_SURF_DUMP_ENABLE_ASYNC_DUMP_ID,
     __VPHAL_DBG_STATE_DUMP_OUTFILE_KEY_NAME_ID,
     __VPHAL_DBG_STATE_DUMP_LOCATION_KEY_NAME_ID,
     __VPHAL_DBG_STATE_DUMP_START_FRAME_KEY_NAME_ID,
@@ -475,6 +476,7 @@ typedef enum _MOS_USER_FEATURE_VALUE_ID
     __VPHAL_ENABLE_SEGMENTATION_ID,
     __VPHAL_SEGMENTATION_MODE_ID,
     __VPHAL_SEGMENTATION_OUTPUT_TYPE_ID,
+    __VPHAL_SURFACE_POOL_BUDGET_ID,
 #if (_DEBUG || _RELEASE_INTERNAL)
     __VPHAL_COMP_8TAP_ADAPTIVE_ENABLE_ID,
     __VPHAL_RNDR_FORCE_VP_DECOMPRESSED_OUTPUT_ID,
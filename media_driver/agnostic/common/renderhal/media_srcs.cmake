@@ -27,7 +27,10 @@ set(TMP_SOURCES_
 set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/renderhal.h
     ${CMAKE_CURRENT_LIST_DIR}/renderhal_dsh.h
+    ${CMAKE_CURRENT_LIST_DIR}/renderhal_dsh_curbe_cache.h
     ${CMAKE_CURRENT_LIST_DIR}/renderhal_platform_interface.h
+    ${CMAKE_CURRENT_LIST_DIR}/renderhal_sampler_avs_template.h
+    ${CMAKE_CURRENT_LIST_DIR}/renderhal_surface_state_template.h
     ${CMAKE_CURRENT_LIST_DIR}/vphal_renderhal_common.h
 )
 
@@ -28,6 +28,8 @@
 #include "mos_os.h"
 #include "renderhal.h"
 #include "hal_kerneldll.h"
+#include "renderhal_sampler_avs_template.h"
+#include "renderhal_surface_state_template.h"
 #include "renderhal_platform_interface.h"
 #include "media_interfaces_renderhal.h"
 #include "media_interfaces_mhw.h"
@@ -4230,6 +4232,14 @@ MOS_STATUS RenderHal_Destroy(PRENDERHAL_INTERFACE pRenderHal)
         pRenderHal->pMhwMiInterface = nullptr;
     }
 
+    // Release surface state templates
+    MOS_SafeFreeMemory(pRenderHal->pSurfaceStateTemplates);
+    pRenderHal->pSurfaceStateTemplates = nullptr;
+
+    // Release AVS sampler state templates
+    MOS_SafeFreeMemory(pRenderHal->pSamplerAvsTemplates);
+    pRenderHal->pSamplerAvsTemplates = nullptr;
+
     // Release pBatchBufferMemPool
     if (pRenderHal->pBatchBufferMemPool)
     {
@@ -6249,6 +6259,65 @@ finish:
     return bRet;
 }
 
+//!
+//! \brief    Set AVS Sampler State
+//! \details  Packs an AVS sampler state, or copies a previously packed state
+//!           built from identical AVS params and coefficient tables
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to RenderHal Interface
+//! \param    uint8_t *pSampler
+//!           [in] Pointer to AVS sampler state in GSH
+//! \param    PMHW_SAMPLER_STATE_PARAM pSamplerParams
+//!           [in] Pointer to AVS sampler params
+//! \return   MOS_STATUS
+//!
+static MOS_STATUS RenderHal_SetSamplerStateAvs(
+    PRENDERHAL_INTERFACE        pRenderHal,
+    uint8_t                     *pSampler,
+    PMHW_SAMPLER_STATE_PARAM    pSamplerParams)
+{
+    MHW_SAMPLER_AVS_TABLE_PARAM AvsTable;
+    uint32_t                    dwSize;
+
+    // Size of SAMPLER_STATE_8x8_AVS as packed by MHW
+    dwSize = pRenderHal->pHwSizes->dwSizeSamplerStateTable8x8 + 16 * sizeof(uint32_t);
+
+    if (pSamplerParams->pKernelState != nullptr ||
+        dwSize > RENDERHAL_SAMPLER_AVS_TEMPLATE_SIZE)
+    {
+        return pRenderHal->pMhwStateHeap->SetSamplerState(pSampler, pSamplerParams);
+    }
+
+    if (pRenderHal->pSamplerAvsTemplates == nullptr)
+    {
+        pRenderHal->pSamplerAvsTemplates = (PRENDERHAL_SAMPLER_AVS_TEMPLATE_CACHE)
+            MOS_AllocAndZeroMemory(sizeof(RENDERHAL_SAMPLER_AVS_TEMPLATE_CACHE));
+        if (pRenderHal->pSamplerAvsTemplates == nullptr)
+        {
+            return pRenderHal->pMhwStateHeap->SetSamplerState(pSampler, pSamplerParams);
+        }
+    }
+
+    if (pSamplerParams->Avs.pMhwSamplerAvsTableParam)
+    {
+        AvsTable = *pSamplerParams->Avs.pMhwSamplerAvsTableParam;
+    }
+    else
+    {
+        MOS_ZeroMemory(&AvsTable, sizeof(AvsTable));
+    }
+
+    return RenderHal_SetSamplerStateAvsFromTemplates(
+        pRenderHal->pSamplerAvsTemplates,
+        pSampler,
+        dwSize,
+        pSamplerParams->Avs,
+        AvsTable,
+        [&](uint8_t *pState) {
+            return pRenderHal->pMhwStateHeap->SetSamplerState(pState, pSamplerParams);
+        });
+}
+
 //!
 //! \brief      Sets Sampler States for Gen8
 //! \details    Initialize and set sampler states
@@ -6325,7 +6394,7 @@ MOS_STATUS RenderHal_SetSamplerStates(
                 eStatus = pRenderHal->pMhwStateHeap->SetSamplerState(pPtrSampler, pSamplerStateParams);
                 break;
             case MHW_SAMPLER_TYPE_AVS:
-                eStatus = pRenderHal->pMhwStateHeap->SetSamplerState(pPtrSamplerAvs, pSamplerStateParams);
+                eStatus = RenderHal_SetSamplerStateAvs(pRenderHal, pPtrSamplerAvs, pSamplerStateParams);
                 pPtrSamplerAvs += pRenderHal->dwSamplerAvsIncrement;
                 break;
             default:
@@ -6349,6 +6418,190 @@ finish:
     return eStatus;
 }
 
+//!
+//! \brief    Save Surface State Template
+//! \details  Capture surface state entries, SURFACE_STATE bytes and the surface
+//!           fields written by setup into the least recently used template slot
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to RenderHal Interface
+//! \param    PRENDERHAL_SURFACE_STATE_TEMPLATE_KEY pKey
+//!           [in] Template key
+//! \param    PRENDERHAL_SURFACE pOutSurface
+//!           [in] Surface after surface state setup
+//! \param    int32_t iNumEntries
+//!           [in] Number of Surface State Entries
+//! \param    PRENDERHAL_SURFACE_STATE_ENTRY *ppSurfaceEntries
+//!           [in] Array of Surface State Entries
+//! \return   void
+//!
+static void RenderHal_SaveSurfaceStateTemplate(
+    PRENDERHAL_INTERFACE                  pRenderHal,
+    PRENDERHAL_SURFACE_STATE_TEMPLATE_KEY pKey,
+    PRENDERHAL_SURFACE                    pOutSurface,
+    int32_t                               iNumEntries,
+    PRENDERHAL_SURFACE_STATE_ENTRY        *ppSurfaceEntries)
+{
+    PRENDERHAL_SURFACE_STATE_TEMPLATE_CACHE pCache = pRenderHal->pSurfaceStateTemplates;
+    PRENDERHAL_SURFACE_STATE_TEMPLATE       pTemplate;
+    PRENDERHAL_SURFACE_STATE_ENTRY          pSurfaceEntry;
+    uint32_t                                dwSurfaceSize;
+    int32_t                                 i;
+
+    if (iNumEntries <= 0 || iNumEntries > MHW_MAX_SURFACE_PLANES)
+    {
+        return;
+    }
+
+    pTemplate     = RenderHal_GetSurfaceStateTemplateVictim(pCache);
+    dwSurfaceSize = pRenderHal->pHwSizes->dwSizeSurfaceState;
+
+    pTemplate->Key.pGmmResInfo = nullptr;
+    pTemplate->iNumEntries     = iNumEntries;
+    for (i = 0; i < iNumEntries; i++)
+    {
+        pSurfaceEntry = ppSurfaceEntries[i];
+        if (pSurfaceEntry == nullptr ||
+            pSurfaceEntry->pSurface == nullptr ||
+            pSurfaceEntry->pSurfaceState == nullptr)
+        {
+            return;
+        }
+        pTemplate->Entry[i] = *pSurfaceEntry;
+        MOS_SecureMemcpy(pTemplate->SurfaceState[i],
+                         RENDERHAL_SURFACE_STATE_TEMPLATE_SIZE,
+                         pSurfaceEntry->pSurfaceState,
+                         dwSurfaceSize);
+    }
+    RenderHal_SaveSurfaceStateTemplateOutput(*pOutSurface, &pTemplate->Output);
+    pTemplate->Key       = *pKey;
+    pTemplate->dwRefresh = pCache->dwRefresh++;
+    pTemplate->dwHits    = 0;
+}
+
+//!
+//! \brief    Verify Surface State Template
+//! \details  Compare a template hit against the entries and surface just built by
+//!           the uncached path; the template must reproduce them byte for byte
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to RenderHal Interface
+//! \param    PRENDERHAL_SURFACE_STATE_TEMPLATE pTemplate
+//!           [in] Matching template
+//! \param    PRENDERHAL_SURFACE pOutSurface
+//!           [in] Surface after surface state setup
+//! \param    int32_t iNumEntries
+//!           [in] Number of Surface State Entries built
+//! \param    PRENDERHAL_SURFACE_STATE_ENTRY *ppSurfaceEntries
+//!           [in] Array of Surface State Entries built
+//! \return   bool
+//!           true if the template matches the uncached result
+//!
+static bool RenderHal_VerifySurfaceStateTemplate(
+    PRENDERHAL_INTERFACE              pRenderHal,
+    PRENDERHAL_SURFACE_STATE_TEMPLATE pTemplate,
+    PRENDERHAL_SURFACE                pOutSurface,
+    int32_t                           iNumEntries,
+    PRENDERHAL_SURFACE_STATE_ENTRY    *ppSurfaceEntries)
+{
+    PRENDERHAL_SURFACE_STATE_ENTRY pSurfaceEntry;
+    uint32_t                       dwSurfaceSize = pRenderHal->pHwSizes->dwSizeSurfaceState;
+    int32_t                        i;
+
+    if (pTemplate->iNumEntries != iNumEntries ||
+        !RenderHal_IsSameSurfaceStateTemplateOutput(pTemplate->Output, *pOutSurface))
+    {
+        return false;
+    }
+
+    for (i = 0; i < iNumEntries; i++)
+    {
+        pSurfaceEntry = ppSurfaceEntries[i];
+        if (pSurfaceEntry == nullptr ||
+            pSurfaceEntry->pSurfaceState == nullptr ||
+            !RenderHal_IsSameSurfaceStateEntry(*pSurfaceEntry, pTemplate->Entry[i]) ||
+            memcmp(pSurfaceEntry->pSurfaceState, pTemplate->SurfaceState[i], dwSurfaceSize) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//!
+//! \brief    Apply Surface State Template
+//! \details  Assign surface state entries and copy prebuilt SURFACE_STATE bytes,
+//!           then patch the caller's surface address through the OS specific setup.
+//!           Only the surface fields written by setup are updated on the caller's surface.
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to RenderHal Interface
+//! \param    PRENDERHAL_SURFACE_STATE_TEMPLATE pTemplate
+//!           [in] Matching template
+//! \param    PRENDERHAL_SURFACE pRenderHalSurface
+//!           [in/out] Pointer to Render Hal Surface
+//! \param    PRENDERHAL_SURFACE_STATE_PARAMS pParams
+//!           [in] Pointer to Surface State Params
+//! \param    int32_t *piNumEntries
+//!           [out] Pointer to Number of Surface State Entries (Num Planes)
+//! \param    PRENDERHAL_SURFACE_STATE_ENTRY *ppSurfaceEntries
+//!           [out] Array of Surface State Entries
+//! \return   MOS_STATUS
+//!
+static MOS_STATUS RenderHal_ApplySurfaceStateTemplate(
+    PRENDERHAL_INTERFACE              pRenderHal,
+    PRENDERHAL_SURFACE_STATE_TEMPLATE pTemplate,
+    PRENDERHAL_SURFACE                pRenderHalSurface,
+    PRENDERHAL_SURFACE_STATE_PARAMS   pParams,
+    int32_t                           *piNumEntries,
+    PRENDERHAL_SURFACE_STATE_ENTRY    *ppSurfaceEntries)
+{
+    PRENDERHAL_SURFACE_STATE_ENTRY  pSurfaceEntry;
+    PMOS_SURFACE                    pSurface;
+    uint8_t                         *pSurfaceState;
+    int32_t                         iSurfStateID;
+    uint32_t                        dwSurfaceSize;
+    int32_t                         i;
+    MOS_STATUS                      eStatus = MOS_STATUS_SUCCESS;
+
+    MHW_RENDERHAL_CHK_NULL(piNumEntries);
+    MHW_RENDERHAL_CHK_NULL(ppSurfaceEntries);
+    MHW_RENDERHAL_CHK_NULL(pRenderHal->pStateHeap);
+
+    dwSurfaceSize       = pRenderHal->pHwSizes->dwSizeSurfaceState;
+    pRenderHal->bIsAVS  = pParams->bAVS;
+    *piNumEntries       = pTemplate->iNumEntries;
+
+    RenderHal_ApplySurfaceStateTemplateOutput(pTemplate->Output, pRenderHalSurface);
+
+    for (i = 0; i < pTemplate->iNumEntries; i++)
+    {
+        MHW_RENDERHAL_CHK_STATUS(pRenderHal->pfnAssignSurfaceState(pRenderHal,
+                                                                   pParams->Type,
+                                                                   &pSurfaceEntry));
+        ppSurfaceEntries[i] = pSurfaceEntry;
+
+        // Restore plane entry, keep the newly assigned state slot
+        pSurface       = pSurfaceEntry->pSurface;
+        pSurfaceState  = pSurfaceEntry->pSurfaceState;
+        iSurfStateID   = pSurfaceEntry->iSurfStateID;
+        *pSurfaceEntry = pTemplate->Entry[i];
+        *pSurface      = pRenderHalSurface->OsSurface;
+
+        pSurfaceEntry->pSurface          = pSurface;
+        pSurfaceEntry->pSurfaceState     = pSurfaceState;
+        pSurfaceEntry->iSurfStateID      = iSurfStateID;
+        pSurfaceEntry->dwSurfStateOffset = pRenderHal->pStateHeap->iSurfaceStateOffset +
+                                           iSurfStateID * dwSurfaceSize;
+
+        MOS_SecureMemcpy(pSurfaceState, dwSurfaceSize, pTemplate->SurfaceState[i], dwSurfaceSize);
+
+        // Patch surface address
+        MHW_RENDERHAL_CHK_STATUS(pRenderHal->pfnSetupSurfaceStatesOs(pRenderHal, pParams, pSurfaceEntry));
+    }
+
+finish:
+    return eStatus;
+}
+
 //!
 //! \brief    Setup Surface State
 //! \details  Setup Surface States
@@ -6377,13 +6630,91 @@ MOS_STATUS RenderHal_SetupSurfaceState(
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
     
+    PRENDERHAL_SURFACE_STATE_TEMPLATE_CACHE pCache    = nullptr;
+    PRENDERHAL_SURFACE_STATE_TEMPLATE       pTemplate = nullptr;
+    GMM_RESOURCE_INFO                       *pGmmResInfo;
+    RENDERHAL_SURFACE_STATE_TEMPLATE_KEY    Key;
+    bool                                    bTemplate = false;
+
     //-----------------------------------------------
     MHW_RENDERHAL_CHK_NULL(pRenderHal);
     MHW_RENDERHAL_CHK_NULL(pRenderHal->pRenderHalPltInterface);
+    MHW_RENDERHAL_CHK_NULL(pRenderHal->pHwSizes);
+    MHW_RENDERHAL_CHK_NULL(pRenderHalSurface);
+    MHW_RENDERHAL_CHK_NULL(pParams);
     //-----------------------------------------------
 
+    // Offset overrides modify the surface in place - always build those states.
+    // Resources without a GMM descriptor (wrapped VAs) are always built too.
+    pGmmResInfo = pRenderHalSurface->OsSurface.OsResource.pGmmResInfo;
+    bTemplate   = (pOffsetOverride == nullptr) &&
+                  (pRenderHal->pHwSizes->dwSizeSurfaceState <= RENDERHAL_SURFACE_STATE_TEMPLATE_SIZE) &&
+                  (pGmmResInfo != nullptr);
+
+    if (bTemplate)
+    {
+        if (pRenderHal->pSurfaceStateTemplates == nullptr)
+        {
+            pRenderHal->pSurfaceStateTemplates = (PRENDERHAL_SURFACE_STATE_TEMPLATE_CACHE)
+                MOS_AllocAndZeroMemory(sizeof(RENDERHAL_SURFACE_STATE_TEMPLATE_CACHE));
+            MHW_RENDERHAL_CHK_NULL(pRenderHal->pSurfaceStateTemplates);
+#if (_DEBUG || _RELEASE_INTERNAL)
+            // Build every state and check template hits against it
+            pRenderHal->pSurfaceStateTemplates->dwVerifyInterval = 1;
+#else
+            pRenderHal->pSurfaceStateTemplates->dwVerifyInterval = RENDERHAL_SURFACE_STATE_TEMPLATE_VERIFY;
+#endif
+        }
+        pCache    = pRenderHal->pSurfaceStateTemplates;
+        bTemplate = !pCache->bDisabled;
+    }
+
+    if (bTemplate)
+    {
+        RenderHal_GetSurfaceStateTemplateKey(*pRenderHalSurface,
+                                             *pParams,
+                                             (uint64_t)pGmmResInfo->GetSizeSurface(),
+                                             pRenderHal->bEnableYV12SinglePass,
+                                             pRenderHal->bEnableP010SinglePass,
+                                             &Key);
+
+        pTemplate = RenderHal_FindSurfaceStateTemplate(pCache, Key);
+        if (pTemplate)
+        {
+            pCache->dwHits++;
+            if (!RenderHal_IsSurfaceStateTemplateVerifyHit(pCache, pTemplate))
+            {
+                MHW_RENDERHAL_CHK_STATUS(RenderHal_ApplySurfaceStateTemplate(
+                    pRenderHal, pTemplate, pRenderHalSurface, pParams, piNumEntries, ppSurfaceEntries));
+                goto finish;
+            }
+            pCache->dwVerified++;
+        }
+        else
+        {
+            pCache->dwMisses++;
+        }
+    }
+
     MHW_RENDERHAL_CHK_STATUS(pRenderHal->pRenderHalPltInterface->SetupSurfaceState(
         pRenderHal, pRenderHalSurface, pParams, piNumEntries, ppSurfaceEntries, pOffsetOverride));
+
+    if (bTemplate)
+    {
+        if (pTemplate == nullptr)
+        {
+            RenderHal_SaveSurfaceStateTemplate(
+                pRenderHal, &Key, pRenderHalSurface, *piNumEntries, ppSurfaceEntries);
+        }
+        else if (!RenderHal_VerifySurfaceStateTemplate(
+                     pRenderHal, pTemplate, pRenderHalSurface, *piNumEntries, ppSurfaceEntries))
+        {
+            // The key missed an input - stop using templates for this RenderHal
+            MHW_RENDERHAL_ASSERTMESSAGE("Surface state template differs from uncached surface state, templates disabled.");
+            pCache->bDisabled = true;
+        }
+    }
+
 finish:
     return eStatus;
 }
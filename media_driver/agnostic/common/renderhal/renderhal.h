@@ -223,6 +223,19 @@ class XRenderHal_Platform_Interface;
 #define RENDERHAL_PALETTE_ENTRIES           256
 #define RENDERHAL_PALETTE_ENTRIES_MAX       256
 
+//!
+//! \brief  Surface state template cache
+//!
+#define RENDERHAL_SURFACE_STATE_TEMPLATES       32      // Templates kept per RenderHal (LRU)
+#define RENDERHAL_SURFACE_STATE_TEMPLATE_SIZE   64      // Max SURFACE_STATE size in bytes
+#define RENDERHAL_SURFACE_STATE_TEMPLATE_VERIFY 64      // Release builds compare every Nth hit of a template
+
+//!
+//! \brief  AVS sampler state template cache
+//!
+#define RENDERHAL_SAMPLER_AVS_TEMPLATES         8       // Templates kept per RenderHal (LRU)
+#define RENDERHAL_SAMPLER_AVS_TEMPLATE_SIZE     1280    // Max SAMPLER_STATE_8x8_AVS size in bytes
+
 //!
 //! \brief  SIP Size
 //!
@@ -918,6 +931,7 @@ typedef struct _RENDERHAL_STATE_HEAP
     RENDERHAL_MEDIA_STATE_LIST  FreeStates;                                     // Free media state objects (pool)
     RENDERHAL_MEDIA_STATE_LIST  ReservedStates;                                 // Reserved media states
     RENDERHAL_MEDIA_STATE_LIST  SubmittedStates;                                // Submitted media states
+    PRENDERHAL_DSH_CURBE_CACHE  pCurbeCache;                                    // CURBE reuse across media states
 
     //---------------------------
     // Surface State Heap
@@ -1067,6 +1081,146 @@ typedef struct _RENDERHAL_SURFACE_STATE_ENTRY
     uint16_t                        wVYOffset;                                      //
 } RENDERHAL_SURFACE_STATE_ENTRY, *PRENDERHAL_SURFACE_STATE_ENTRY;
 
+//!
+//! Structure RENDERHAL_SURFACE_STATE_TEMPLATE_KEY
+//! \brief Every input of surface state setup. Built zero initialized, field by
+//!        field, so padding and per-call pointers never take part in the match.
+//!        The resource is identified by its GMM descriptor and allocation size;
+//!        a GMM descriptor seen again with a different size is a reallocation.
+//!
+typedef struct _RENDERHAL_SURFACE_STATE_TEMPLATE_KEY
+{
+    // Resource identity
+    GMM_RESOURCE_INFO               *pGmmResInfo;                                   // GMM descriptor (nullptr = unused)
+    uint64_t                        ui64AllocSize;                                  // GMM surface size
+
+    // OS surface
+    uint32_t                        dwArraySlice;
+    uint32_t                        dwMipSlice;
+    MOS_S3D_CHANNEL                 S3dChannel;
+    MOS_GFXRES_TYPE                 Type;
+    int32_t                         bOverlay;
+    int32_t                         bFlipChain;
+    uint32_t                        dwWidth;
+    uint32_t                        dwHeight;
+    uint32_t                        dwSize;
+    uint32_t                        dwDepth;
+    uint32_t                        dwArraySize;
+    uint32_t                        dwLockPitch;
+    uint32_t                        dwPitch;
+    uint32_t                        dwSlicePitch;
+    uint32_t                        dwQPitch;
+    MOS_TILE_TYPE                   TileType;
+    MOS_FORMAT                      Format;
+    int32_t                         bArraySpacing;
+    int32_t                         bCompressible;
+    uint32_t                        dwOffset;
+    MOS_PLANE_OFFSET                YPlaneOffset;
+    MOS_PLANE_OFFSET                UPlaneOffset;
+    MOS_PLANE_OFFSET                VPlaneOffset;
+    MOS_RESOURCE_OFFSETS            RenderOffset[3];                                // Y/U/V (RGB in [0])
+    uint32_t                        LockOffset[3];                                  // Y/U/V (RGB in [0])
+    int32_t                         bIsCompressed;
+    MOS_RESOURCE_MMC_MODE           CompressionMode;
+    uint32_t                        CompressionFormat;
+    MOS_MEMCOMP_STATE               MmcState;
+    MOS_TILE_MODE_GMM               TileModeGMM;
+    uint32_t                        bGMMTileEnabled;
+    uint32_t                        YoffsetForUplane;
+    uint32_t                        YoffsetForVplane;
+
+    // RenderHal surface
+    RENDERHAL_SURFACE_TYPE          SurfType;
+    RENDERHAL_SCALING_MODE          ScalingMode;
+    MHW_ROTATION                    Rotation;
+    uint32_t                        ChromaSiting;
+    RECT                            rcSrc;
+    RECT                            rcDst;
+    RECT                            rcMaxSrc;
+    uint32_t                        bDeinterlaceEnable;
+    uint32_t                        bQueryVariance;
+    uint32_t                        bInterlacedScaling;
+    uint32_t                        bDeinterlaceParams;                             // pDeinterlaceParams != nullptr
+    RENDERHAL_SAMPLE_TYPE           SampleType;
+    int32_t                         iPaletteID;
+    uint32_t                        dwWidthInUse;
+    uint32_t                        dwHeightInUse;
+
+    // RenderHal settings read by the plane selection
+    uint32_t                        bEnableYV12SinglePass;
+    uint32_t                        bEnableP010SinglePass;
+
+    // Surface state params (named bitfields only)
+    RENDERHAL_SURFACE_STATE_PARAMS  Params;
+} RENDERHAL_SURFACE_STATE_TEMPLATE_KEY, *PRENDERHAL_SURFACE_STATE_TEMPLATE_KEY;
+
+//!
+//! Structure RENDERHAL_SURFACE_STATE_TEMPLATE_OUTPUT
+//! \brief Render Hal Surface fields written by surface state setup
+//!
+typedef struct _RENDERHAL_SURFACE_STATE_TEMPLATE_OUTPUT
+{
+    uint32_t                        dwWidth;                                        // OsSurface.dwWidth
+    uint32_t                        dwHeight;                                       // OsSurface.dwHeight
+    RECT                            rcSrc;
+    RECT                            rcDst;
+    RENDERHAL_SCALING_MODE          ScalingMode;
+} RENDERHAL_SURFACE_STATE_TEMPLATE_OUTPUT, *PRENDERHAL_SURFACE_STATE_TEMPLATE_OUTPUT;
+
+//!
+//! Structure RENDERHAL_SURFACE_STATE_TEMPLATE
+//! \brief Prebuilt surface state entries and SURFACE_STATE bytes for a surface layout.
+//!        Surface address is not part of the template - the caller's resource is
+//!        patched through pfnSetupSurfaceStatesOs on every use.
+//!
+typedef struct _RENDERHAL_SURFACE_STATE_TEMPLATE
+{
+    RENDERHAL_SURFACE_STATE_TEMPLATE_KEY    Key;                                    // Template key
+    uint32_t                                dwRefresh;                              // LRU stamp
+    uint32_t                                dwHits;                                 // Hits since saved
+    int32_t                                 iNumEntries;                            // Number of planes
+    RENDERHAL_SURFACE_STATE_TEMPLATE_OUTPUT Output;                                 // Surface fields written by setup
+    RENDERHAL_SURFACE_STATE_ENTRY           Entry[MHW_MAX_SURFACE_PLANES];          // Plane entries
+    uint8_t                                 SurfaceState[MHW_MAX_SURFACE_PLANES][RENDERHAL_SURFACE_STATE_TEMPLATE_SIZE];
+} RENDERHAL_SURFACE_STATE_TEMPLATE, *PRENDERHAL_SURFACE_STATE_TEMPLATE;
+
+typedef struct _RENDERHAL_SURFACE_STATE_TEMPLATE_CACHE
+{
+    uint32_t                         dwRefresh;                                     // LRU counter
+    uint32_t                         dwHits;                                        // Statistics
+    uint32_t                         dwMisses;
+    uint32_t                         dwInvalidated;                                 // Templates dropped on reallocation
+    uint32_t                         dwVerified;                                    // Hits built uncached and compared
+    uint32_t                         dwVerifyInterval;                              // Compare every Nth hit of a template (<= 1: every hit)
+    bool                             bDisabled;                                     // Set when a verified hit differs
+    RENDERHAL_SURFACE_STATE_TEMPLATE Template[RENDERHAL_SURFACE_STATE_TEMPLATES];
+} RENDERHAL_SURFACE_STATE_TEMPLATE_CACHE, *PRENDERHAL_SURFACE_STATE_TEMPLATE_CACHE;
+
+//!
+//! Structure RENDERHAL_SAMPLER_AVS_TEMPLATE
+//! \brief Packed SAMPLER_STATE_8x8_AVS (including coefficient tables) keyed by the
+//!        AVS sampler params and the contents of the AVS table they point to.
+//!        Layers sharing scaling parameters, within a phase or across frames,
+//!        copy the packed state instead of packing the tables again.
+//!
+typedef struct _RENDERHAL_SAMPLER_AVS_TEMPLATE
+{
+    uint64_t                        ui64Key;                                        // Hash of Params + Table (0 = unused)
+    uint32_t                        dwRefresh;                                      // LRU stamp
+    MHW_SAMPLER_STATE_AVS_PARAM     Params;                                         // AVS params (table pointer and placement not keyed)
+    MHW_SAMPLER_AVS_TABLE_PARAM     Table;                                          // AVS coefficient table params
+    uint8_t                         SamplerState[RENDERHAL_SAMPLER_AVS_TEMPLATE_SIZE];
+} RENDERHAL_SAMPLER_AVS_TEMPLATE, *PRENDERHAL_SAMPLER_AVS_TEMPLATE;
+
+typedef struct _RENDERHAL_SAMPLER_AVS_TEMPLATE_CACHE
+{
+    uint32_t                        dwRefresh;                                      // LRU counter
+    uint32_t                        dwHits;                                         // Statistics
+    uint32_t                        dwMisses;
+    uint64_t                        ui64BytesReused;                                // Packed bytes copied from templates
+    RENDERHAL_SAMPLER_AVS_TEMPLATE  Template[RENDERHAL_SAMPLER_AVS_TEMPLATES];
+} RENDERHAL_SAMPLER_AVS_TEMPLATE_CACHE, *PRENDERHAL_SAMPLER_AVS_TEMPLATE_CACHE;
+
 //!
 // \brief   Helper parameters used by Mhw_SendGenericPrologCmd and to initiate command buffer attributes
 //!
@@ -1152,6 +1306,10 @@ typedef struct _RENDERHAL_INTERFACE
     PMHW_BATCH_BUFFER_LIST       BatchBufferPool;                               // Pool of BB objects   (no GFX buffer)
     PMHW_BATCH_BUFFER_LIST       BatchBuffersAllocated;                         // List of BB allocated (not executing, backed by GFX buffer)
 
+    // Prebuilt surface states
+    PRENDERHAL_SURFACE_STATE_TEMPLATE_CACHE pSurfaceStateTemplates;             // Surface state templates (allocated on first use)
+    PRENDERHAL_SAMPLER_AVS_TEMPLATE_CACHE   pSamplerAvsTemplates;               // AVS sampler state templates (allocated on first use)
+
     // Auxiliary
     PLATFORM                     Platform;
     MEDIA_FEATURE_TABLE          *pSkuTable;
@@ -25,6 +25,7 @@
 //!
 #include "renderhal.h"
 #include "renderhal_platform_interface.h"
+#include "renderhal_dsh_curbe_cache.h"
 
 // Defined in renderhal.c
 extern const RENDERHAL_SURFACE_STATE_ENTRY g_cInitSurfaceStateEntry;
@@ -543,6 +544,193 @@ finish:
     return eStatus;
 }
 
+//!
+//! \brief    Free CURBE cache
+//! \details  Frees the host copies of CURBE data and the CURBE cache object
+//! \param    PRENDERHAL_STATE_HEAP pStateHeap
+//!           [in] Pointer to state heap
+//! \return   void
+//!
+static void RenderHal_DSH_FreeCurbeCache(PRENDERHAL_STATE_HEAP pStateHeap)
+{
+    PRENDERHAL_DSH_CURBE_CACHE pCache;
+
+    if (pStateHeap == nullptr || pStateHeap->pCurbeCache == nullptr)
+    {
+        return;
+    }
+
+    pCache = pStateHeap->pCurbeCache;
+    MOS_SafeFreeMemory(pCache->pData);
+    MOS_SafeFreeMemory(pCache->pStaging);
+    MOS_Delete(pCache);
+    pStateHeap->pCurbeCache = nullptr;
+}
+
+//!
+//! \brief    Write CURBE data
+//! \details  Writes staged CURBE data to the CURBE region of the media state being staged
+//! \param    PRENDERHAL_DSH_CURBE_CACHE pCache
+//!           [in] Pointer to CURBE cache
+//! \param    const uint8_t *pData
+//!           [in] Pointer to CURBE data
+//! \param    uint32_t dwOffset
+//!           [in] Offset in the CURBE region
+//! \param    uint32_t dwSize
+//!           [in] Number of bytes to write
+//! \return   MOS_STATUS
+//!
+static MOS_STATUS RenderHal_DSH_WriteCurbe(
+    PRENDERHAL_DSH_CURBE_CACHE pCache,
+    const uint8_t              *pData,
+    uint32_t                   dwOffset,
+    uint32_t                   dwSize)
+{
+    PRENDERHAL_DYNAMIC_STATE pDynamicState;
+    MOS_STATUS               eStatus = MOS_STATUS_SUCCESS;
+
+    MHW_RENDERHAL_CHK_NULL(pCache);
+    MHW_RENDERHAL_CHK_NULL(pCache->pDynamicState);
+
+    pDynamicState = pCache->pDynamicState;
+    MHW_RENDERHAL_CHK_STATUS(pDynamicState->memoryBlock.AddData(
+        (void *)pData,
+        pDynamicState->Curbe.dwOffset + dwOffset,
+        dwSize));
+
+finish:
+    return eStatus;
+}
+
+//!
+//! \brief    Begin CURBE staging for a new media state
+//! \details  CURBE data is staged in host memory. While the staged data
+//!           matches the CURBE of the last media state, GSH writes are
+//!           deferred so that the CURBE load may reference the previous
+//!           block instead. A CURBE still deferred for the previous media
+//!           state is written out first, it is not submitted yet.
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to renderhal interface
+//! \param    PRENDERHAL_MEDIA_STATE pMediaState
+//!           [in] Pointer to media state with a valid memory block
+//! \return   MOS_STATUS
+//!
+static MOS_STATUS RenderHal_DSH_BeginCurbe(
+    PRENDERHAL_INTERFACE   pRenderHal,
+    PRENDERHAL_MEDIA_STATE pMediaState)
+{
+    PRENDERHAL_DSH_CURBE_CACHE pCache;
+    PRENDERHAL_DYNAMIC_STATE   pDynamicState;
+    uint8_t                    *pData    = nullptr;
+    uint8_t                    *pStaging = nullptr;
+    uint32_t                   dwSize;
+    bool                       bReferenceAlive;
+    MOS_STATUS                 eStatus   = MOS_STATUS_SUCCESS;
+
+    MHW_RENDERHAL_CHK_NULL(pRenderHal);
+    MHW_RENDERHAL_CHK_NULL(pRenderHal->pStateHeap);
+    MHW_RENDERHAL_CHK_NULL(pRenderHal->pStateHeap->pCurbeCache);
+    MHW_RENDERHAL_CHK_NULL(pMediaState);
+    MHW_RENDERHAL_CHK_NULL(pMediaState->pDynamicState);
+
+    pCache        = pRenderHal->pStateHeap->pCurbeCache;
+    pDynamicState = pMediaState->pDynamicState;
+    dwSize        = pDynamicState->Curbe.dwSize;
+
+    // Previous media state still references its own block for CURBE_LOAD
+    MHW_RENDERHAL_CHK_STATUS(RenderHal_DSH_FlushStagedCurbe(
+        pCache,
+        [pCache](const uint8_t *pSrc, uint32_t dwOffset, uint32_t dwBytes) {
+            return RenderHal_DSH_WriteCurbe(pCache, pSrc, dwOffset, dwBytes);
+        }));
+    pCache->pDynamicState = nullptr;
+
+    // Grow host copies, preserving the last CURBE
+    if (dwSize > pCache->dwAllocSize)
+    {
+        pData    = (uint8_t*)MOS_AllocAndZeroMemory(dwSize);
+        pStaging = (uint8_t*)MOS_AllocAndZeroMemory(dwSize);
+        if (pData == nullptr || pStaging == nullptr)
+        {
+            MOS_SafeFreeMemory(pData);
+            MOS_SafeFreeMemory(pStaging);
+            eStatus = MOS_STATUS_NO_SPACE;
+            goto finish;
+        }
+
+        if (pCache->pData && pCache->dwSize > 0)
+        {
+            MOS_SecureMemcpy(pData, dwSize, pCache->pData, pCache->dwSize);
+        }
+        MOS_SafeFreeMemory(pCache->pData);
+        MOS_SafeFreeMemory(pCache->pStaging);
+        pCache->pData       = pData;
+        pCache->pStaging    = pStaging;
+        pCache->dwAllocSize = dwSize;
+    }
+
+    if (dwSize > 0)
+    {
+        pCache->pDynamicState = pDynamicState;
+    }
+
+    // Last CURBE may only be referenced while it is alive in the same heap.
+    // Its lifetime is extended when a CURBE load actually references it.
+    bReferenceAlive = pCache->memoryBlock.IsValid()                         &&
+                      !FrameTrackerTokenFlat_IsExpired(&pCache->trackerToken) &&
+                      pCache->memoryBlock.GetResource() == pDynamicState->memoryBlock.GetResource();
+
+    if (!RenderHal_DSH_BeginCurbeStaging(pCache, dwSize, bReferenceAlive) && dwSize > 0)
+    {
+        pCache->memoryBlock = MemoryBlock();
+    }
+
+finish:
+    return eStatus;
+}
+
+//!
+//! \brief    Reference the last CURBE block
+//! \details  Merges the sync tag of the media state being built into the
+//!           tracker token of the block holding the last CURBE, so the block
+//!           is only reclaimed after the referencing submission completes
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to renderhal interface
+//! \param    PRENDERHAL_DSH_CURBE_CACHE pCache
+//!           [in] Pointer to CURBE cache
+//! \return   bool
+//!           true if the block may be referenced by the CURBE load
+//!
+static bool RenderHal_DSH_ReferenceCurbe(
+    PRENDERHAL_INTERFACE       pRenderHal,
+    PRENDERHAL_DSH_CURBE_CACHE pCache)
+{
+    uint32_t dwTracker;
+
+    // Block may have been reclaimed since staging began
+    if (!pCache->memoryBlock.IsValid() ||
+        FrameTrackerTokenFlat_IsExpired(&pCache->trackerToken))
+    {
+        pCache->memoryBlock = MemoryBlock();
+        pCache->dwSize      = 0;
+        return false;
+    }
+
+    dwTracker = pRenderHal->trackerProducer.GetNextTracker(pRenderHal->currentTrackerIndex);
+    if (pRenderHal->dgsheapManager->ExtendBlockLifetime(
+            pCache->memoryBlock,
+            pRenderHal->currentTrackerIndex,
+            dwTracker) != MOS_STATUS_SUCCESS)
+    {
+        pCache->memoryBlock = MemoryBlock();
+        pCache->dwSize      = 0;
+        return false;
+    }
+    FrameTrackerTokenFlat_Merge(&pCache->trackerToken, pRenderHal->currentTrackerIndex, dwTracker);
+
+    return true;
+}
+
 //!
 //! \brief    Allocate GSH, SSH, ISH control structures and heaps
 //! \details  Allocates State Heap control structure (system memory)
@@ -604,6 +792,7 @@ MOS_STATUS RenderHal_DSH_AllocateStateHeaps(
     MOS_ZeroMemory(&pStateHeap->KernelsAllocated     , sizeof(RENDERHAL_KRN_ALLOC_LIST));
     MOS_ZeroMemory(&pStateHeap->KernelsSubmitted     , sizeof(RENDERHAL_KRN_ALLOC_LIST));
     MOS_ZeroMemory(&pStateHeap->KernelAllocationPool , sizeof(RENDERHAL_KRN_ALLOC_LIST));
+    pStateHeap->pCurbeCache = nullptr;
 
     // Create pool of media state objects
     iSize = sizeof(RENDERHAL_MEDIA_STATE) + sizeof(RENDERHAL_DYNAMIC_STATE) + 16; // Media state object + Dynamic states object (co-located)
@@ -613,6 +802,10 @@ MOS_STATUS RenderHal_DSH_AllocateStateHeaps(
 
     MHW_RENDERHAL_CHK_STATUS(RenderHal_DSH_ExtendMediaStatePool(pStateHeap));
 
+    // CURBE reuse across media states
+    pStateHeap->pCurbeCache = MOS_New(RENDERHAL_DSH_CURBE_CACHE);
+    MHW_RENDERHAL_CHK_NULL(pStateHeap->pCurbeCache);
+
     //-------------------------------------------------------------------------
     // Calculate offsets/sizes in GSH
     //-------------------------------------------------------------------------
@@ -716,6 +909,8 @@ finish:
             {
                 MOS_FreeMemory(pStateHeap->pSshBuffer);
             }
+
+            RenderHal_DSH_FreeCurbeCache(pStateHeap);
         }
     }
 
@@ -779,6 +974,8 @@ MOS_STATUS RenderHal_DSH_FreeStateHeaps(PRENDERHAL_INTERFACE pRenderHal)
         pStateHeap->pKernelAllocMemPool = nullptr;
     }
 
+    RenderHal_DSH_FreeCurbeCache(pStateHeap);
+
     // Free kernel hash table
     pRenderHal->pStateHeap->kernelHashTable.Free();
 
@@ -2072,6 +2269,9 @@ PRENDERHAL_MEDIA_STATE RenderHal_DSH_AssignDynamicState(
                                 pRenderHal->currentTrackerIndex,
                                 pRenderHal->trackerProducer.GetNextTracker(pRenderHal->currentTrackerIndex));
 
+    // Stage CURBE data, referencing the last CURBE while unchanged
+    MHW_RENDERHAL_CHK_STATUS(RenderHal_DSH_BeginCurbe(pRenderHal, pMediaState));
+
     // Reset HW allocations
     pRenderHal->iChromaKeyCount = 0;
     for (int32_t i = 0; i < pRenderHal->iMaxPalettes; i++)
@@ -2143,6 +2343,14 @@ MOS_STATUS RenderHal_DSH_ReleaseDynamicState(
         goto finish;
     }
 
+    // Stop staging CURBE data for the released media state
+    if (pRenderHal->pStateHeap->pCurbeCache &&
+        pRenderHal->pStateHeap->pCurbeCache->pDynamicState == pMediaState->pDynamicState)
+    {
+        pRenderHal->pStateHeap->pCurbeCache->pDynamicState = nullptr;
+        pRenderHal->pStateHeap->pCurbeCache->bDeferred     = false;
+    }
+
     // Return media state to pool for reuse
     RenderHal_DSH_ReturnMediaStateToPool(pRenderHal->pStateHeap, pMediaState);
 
@@ -2165,6 +2373,8 @@ MOS_STATUS RenderHal_DSH_SubmitDynamicState(
     PRENDERHAL_MEDIA_STATE pMediaState)
 {
     PRENDERHAL_MEDIA_STATE_LIST pList;
+    PRENDERHAL_DSH_CURBE_CACHE  pCache;
+    PRENDERHAL_DYNAMIC_STATE    pDynamicState;
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
     std::vector<MemoryBlock> blocks;
 
@@ -2185,6 +2395,23 @@ MOS_STATUS RenderHal_DSH_SubmitDynamicState(
     // Flag as busy (should be already)
     pMediaState->bBusy = true;
 
+    // Finalize CURBE staging. Called after the command buffer is submitted,
+    // so the block is never written here: the CURBE load already resolved it.
+    pCache = pRenderHal->pStateHeap->pCurbeCache;
+    if (pCache && pCache->pDynamicState == pMediaState->pDynamicState)
+    {
+        pDynamicState = pMediaState->pDynamicState;
+
+        // CURBE written by this media state becomes the reference for the next one
+        if (RenderHal_DSH_EndCurbeStaging(pCache, (uint32_t)MOS_MAX(pDynamicState->Curbe.iCurrent, 0)))
+        {
+            pCache->memoryBlock  = pDynamicState->memoryBlock;
+            pCache->dwOffset     = pDynamicState->Curbe.dwOffset;
+            pCache->trackerToken = pMediaState->trackerToken;
+        }
+        pCache->pDynamicState = nullptr;
+    }
+
     blocks.push_back(pMediaState->pDynamicState->memoryBlock);
     pRenderHal->dgsheapManager->SubmitBlocks(blocks);
 
@@ -2233,10 +2460,9 @@ int32_t RenderHal_DSH_LoadCurbeData(
     int32_t                  iOffset;
     int32_t                  iCurbeSize;
     PRENDERHAL_DYNAMIC_STATE pDynamicState;
-    uint8_t*                 pRemainingCurbe;
+    PRENDERHAL_DSH_CURBE_CACHE pCache;
 
     iOffset         = -1;
-    pRemainingCurbe =  nullptr;
 
     if (pRenderHal == nullptr || pMediaState == nullptr || pData == nullptr)
     {
@@ -2260,33 +2486,32 @@ int32_t RenderHal_DSH_LoadCurbeData(
             iOffset = pDynamicState->Curbe.iCurrent;
             pDynamicState->Curbe.iCurrent += iCurbeSize;
 
-            if (pData)
+            pCache = pRenderHal->pStateHeap ? pRenderHal->pStateHeap->pCurbeCache : nullptr;
+            if (pCache && pCache->pDynamicState == pDynamicState)
             {
+                // Stage CURBE data, written once it differs from the last CURBE
+                MHW_RENDERHAL_CHK_STATUS(RenderHal_DSH_StageCurbeData(
+                    pCache,
+                    (uint32_t)iOffset,
+                    pData,
+                    (uint32_t)iSize,
+                    (uint32_t)iCurbeSize,
+                    [pCache](const uint8_t *pSrc, uint32_t dwOffset, uint32_t dwBytes) {
+                        return RenderHal_DSH_WriteCurbe(pCache, pSrc, dwOffset, dwBytes);
+                    }));
+            }
+            else
+            {
+                // Remaining CURBE was zeroed when the block was acquired
                 MHW_RENDERHAL_CHK_STATUS(pDynamicState->memoryBlock.AddData(
                     pData,
                     pDynamicState->Curbe.dwOffset + iOffset,
                     iSize));
-
-                // Zero remaining CURBE (for buffer alignment)
-                iCurbeSize -= iSize;
-                if (iCurbeSize > 0)
-                {
-                    pRemainingCurbe = (uint8_t*)MOS_AllocAndZeroMemory(sizeof(uint8_t)*iCurbeSize);
-                    MHW_RENDERHAL_CHK_STATUS(pDynamicState->memoryBlock.AddData(
-                        pRemainingCurbe,
-                        pDynamicState->Curbe.dwOffset + iOffset + iSize,
-                        iCurbeSize));
-                }
             }
         }
     }
 
 finish:
-    if(pRemainingCurbe)
-    {
-        MOS_SafeFreeMemory(pRemainingCurbe);
-    }
-
     if (eStatus != MOS_STATUS_SUCCESS)
     {
         iOffset = -1;
@@ -2311,6 +2536,7 @@ MOS_STATUS RenderHal_DSH_SendCurbeLoad(
     PRENDERHAL_STATE_HEAP    pStateHeap;
     PRENDERHAL_MEDIA_STATE   pMediaState;
     PRENDERHAL_DYNAMIC_STATE pDynamicState;
+    PRENDERHAL_DSH_CURBE_CACHE pCache;
     MOS_STATUS               eStatus = MOS_STATUS_SUCCESS;
 
     //-----------------------------------------
@@ -2337,6 +2563,27 @@ MOS_STATUS RenderHal_DSH_SendCurbeLoad(
         CurbeLoadParams.dwCURBEDataStartAddress = pDynamicState->memoryBlock.GetOffset() +   // media state offset from GSH base
                                                   pDynamicState->Curbe.dwOffset;                // curbe data offset in media state
 
+        pCache = pStateHeap->pCurbeCache;
+        if (pCache && pCache->pDynamicState == pDynamicState)
+        {
+            // Reference the last CURBE if the whole CURBE is unchanged, otherwise
+            // write the staged CURBE before the command buffer is submitted
+            MHW_RENDERHAL_CHK_STATUS(RenderHal_DSH_ResolveCurbeLoad(
+                pCache,
+                (uint32_t)pDynamicState->Curbe.iCurrent,
+                [pRenderHal, pCache]() {
+                    return RenderHal_DSH_ReferenceCurbe(pRenderHal, pCache);
+                },
+                [pCache](const uint8_t *pSrc, uint32_t dwOffset, uint32_t dwBytes) {
+                    return RenderHal_DSH_WriteCurbe(pCache, pSrc, dwOffset, dwBytes);
+                }));
+
+            if (pCache->bReused)
+            {
+                CurbeLoadParams.dwCURBEDataStartAddress = pCache->memoryBlock.GetOffset() + pCache->dwOffset;
+            }
+        }
+
         MHW_RENDERHAL_CHK_STATUS(pRenderHal->pMhwRenderInterface->AddMediaCurbeLoadCmd(pCmdBuffer, &CurbeLoadParams));
     }
 
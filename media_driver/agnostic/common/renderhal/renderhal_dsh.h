@@ -78,6 +78,31 @@ typedef struct _RENDERHAL_DYNAMIC_STATE
     PRENDERHAL_KRN_ALLOCATION   pKrnAllocations[RENDERHAL_DSH_MAX_MEDIA_IDs];   // Media Kernel Allocations (1:1 mapping with Media IDs)
 } RENDERHAL_DYNAMIC_STATE, *PRENDERHAL_DYNAMIC_STATE;
 
+//---------------------------
+// CURBE reuse across media states
+//---------------------------
+typedef struct _RENDERHAL_DSH_CURBE_CACHE
+{
+    // Last CURBE uploaded to the dynamic GSH
+    MemoryBlock                 memoryBlock;                                    // Block holding the CURBE data
+    uint32_t                    dwOffset;                                       // CURBE data offset in memoryBlock
+    uint32_t                    dwSize;                                         // CURBE data size (0 if none)
+    uint8_t                     *pData;                                         // Host copy of the CURBE data
+    FrameTrackerTokenFlat       trackerToken;                                   // Submissions referencing memoryBlock
+
+    // CURBE of the media state being built
+    PRENDERHAL_DYNAMIC_STATE    pDynamicState;                                  // Dynamic state being staged
+    uint8_t                     *pStaging;                                      // Host copy of the CURBE being built
+    uint32_t                    dwAllocSize;                                    // Size of pData and pStaging
+    uint32_t                    dwStagedSize;                                   // Staged bytes not yet written to GSH
+    bool                        bDeferred;                                      // GSH writes deferred, CURBE matches pData so far
+    bool                        bReused;                                        // CURBE load references memoryBlock
+
+    // Statistics
+    uint64_t                    ui64BytesWritten;                               // CURBE bytes written to GSH
+    uint64_t                    ui64BytesReused;                                // CURBE bytes referenced instead of written
+} RENDERHAL_DSH_CURBE_CACHE, *PRENDERHAL_DSH_CURBE_CACHE;
+
 //---------------------------
 // Dynamic State Heap Objects
 //---------------------------
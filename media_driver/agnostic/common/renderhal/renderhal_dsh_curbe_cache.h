@@ -0,0 +1,237 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     renderhal_dsh_curbe_cache.h
+//! \brief    Staging of DSH CURBE data so an unchanged CURBE references the last uploaded block.
+//! \details  Templated on RENDERHAL_DSH_CURBE_CACHE. GSH writes and the lifetime of the
+//!           referenced block are left to the caller, so the stage, compare, reuse and
+//!           flush logic only depend on MOS definitions.
+//!
+
+#ifndef __RENDERHAL_DSH_CURBE_CACHE_H__
+#define __RENDERHAL_DSH_CURBE_CACHE_H__
+
+#include <string.h>
+#include "mos_defs.h"
+
+//!
+//! \brief    Begin CURBE staging for a new media state
+//! \details  Clears the staging copy. Writes are deferred while the last CURBE may still
+//!           be referenced, i.e. it exists, fits the new CURBE region and its block is alive.
+//! \param    pCache
+//!           [in] CURBE cache, host copies already sized for dwSize
+//! \param    dwSize
+//!           [in] Size of the CURBE region of the new media state
+//! \param    bReferenceAlive
+//!           [in] Block holding the last CURBE is valid, unexpired and in the same heap
+//! \return   bool
+//!           true if writes are deferred
+//!
+template <class Cache>
+bool RenderHal_DSH_BeginCurbeStaging(
+    Cache       *pCache,
+    uint32_t    dwSize,
+    bool        bReferenceAlive)
+{
+    pCache->dwStagedSize = 0;
+    pCache->bDeferred    = false;
+    pCache->bReused      = false;
+
+    if (dwSize == 0)
+    {
+        return false;
+    }
+
+    memset(pCache->pStaging, 0, dwSize);
+
+    if (!bReferenceAlive || pCache->dwSize == 0 || pCache->dwSize > dwSize)
+    {
+        pCache->dwSize = 0;
+        return false;
+    }
+
+    pCache->bDeferred = true;
+    return true;
+}
+
+//!
+//! \brief    Flush deferred CURBE data
+//! \details  Writes everything staged so far and stops deferring writes
+//! \param    pCache
+//!           [in] CURBE cache
+//! \param    write
+//!           [in] Writes (data, CURBE offset, size) to the CURBE of the staged media state
+//! \return   MOS_STATUS
+//!
+template <class Cache, class Write>
+MOS_STATUS RenderHal_DSH_FlushStagedCurbe(
+    Cache       *pCache,
+    Write       write)
+{
+    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
+
+    if (!pCache->bDeferred)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    pCache->bDeferred = false;
+    if (pCache->dwStagedSize > 0)
+    {
+        eStatus = write(pCache->pStaging, 0, pCache->dwStagedSize);
+        if (eStatus == MOS_STATUS_SUCCESS)
+        {
+            pCache->ui64BytesWritten += pCache->dwStagedSize;
+        }
+    }
+    pCache->dwStagedSize = 0;
+
+    return eStatus;
+}
+
+//!
+//! \brief    Stage CURBE data
+//! \details  Copies the data into the staging copy, zero padded to the CURBE block size.
+//!           While deferred, nothing is written as long as the data matches the last
+//!           CURBE; the first difference writes everything staged so far. Otherwise the
+//!           data is written right away.
+//! \param    pCache
+//!           [in] CURBE cache
+//! \param    dwOffset
+//!           [in] Offset of the data in the CURBE region
+//! \param    pData
+//!           [in] CURBE data
+//! \param    dwSize
+//!           [in] Size of pData
+//! \param    dwCurbeSize
+//!           [in] dwSize aligned to the CURBE block size, dwOffset + dwCurbeSize fits the staging copy
+//! \param    write
+//!           [in] Writes (data, CURBE offset, size) to the CURBE of the staged media state
+//! \return   MOS_STATUS
+//!
+template <class Cache, class Write>
+MOS_STATUS RenderHal_DSH_StageCurbeData(
+    Cache       *pCache,
+    uint32_t    dwOffset,
+    const void  *pData,
+    uint32_t    dwSize,
+    uint32_t    dwCurbeSize,
+    Write       write)
+{
+    MOS_STATUS eStatus;
+
+    memcpy(pCache->pStaging + dwOffset, pData, dwSize);
+    memset(pCache->pStaging + dwOffset + dwSize, 0, dwCurbeSize - dwSize);
+
+    if (!pCache->bDeferred)
+    {
+        eStatus = write(pCache->pStaging + dwOffset, dwOffset, dwCurbeSize);
+        if (eStatus == MOS_STATUS_SUCCESS)
+        {
+            pCache->ui64BytesWritten += dwCurbeSize;
+        }
+        return eStatus;
+    }
+
+    pCache->dwStagedSize = MOS_MAX(pCache->dwStagedSize, dwOffset + dwCurbeSize);
+
+    // Still identical to the last CURBE - nothing to write yet
+    if (dwOffset + dwCurbeSize <= pCache->dwSize &&
+        memcmp(pCache->pData + dwOffset, pCache->pStaging + dwOffset, dwCurbeSize) == 0)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    return RenderHal_DSH_FlushStagedCurbe(pCache, write);
+}
+
+//!
+//! \brief    Resolve the CURBE referenced by the CURBE load
+//! \details  Called when the CURBE load command is added, before submission. If the whole
+//!           CURBE still matches the last one and the last block can be kept alive, the load
+//!           references it; otherwise the staged data is written to the current block.
+//! \param    pCache
+//!           [in] CURBE cache
+//! \param    dwCurbeSize
+//!           [in] Size of the CURBE loaded by the media state
+//! \param    reference
+//!           [in] Extends the lifetime of the last CURBE block to the current submission,
+//!           returns false if it can no longer be referenced
+//! \param    write
+//!           [in] Writes (data, CURBE offset, size) to the CURBE of the staged media state
+//! \return   MOS_STATUS
+//!
+template <class Cache, class Reference, class Write>
+MOS_STATUS RenderHal_DSH_ResolveCurbeLoad(
+    Cache       *pCache,
+    uint32_t    dwCurbeSize,
+    Reference   reference,
+    Write       write)
+{
+    if (pCache->bDeferred &&
+        pCache->dwSize == dwCurbeSize &&
+        memcmp(pCache->pData, pCache->pStaging, dwCurbeSize) == 0 &&
+        reference())
+    {
+        pCache->bDeferred        = false;
+        pCache->bReused          = true;
+        pCache->dwStagedSize     = 0;
+        pCache->ui64BytesReused += dwCurbeSize;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    return RenderHal_DSH_FlushStagedCurbe(pCache, write);
+}
+
+//!
+//! \brief    End CURBE staging when the media state is submitted
+//! \details  Nothing is written here, the block may already be in flight. A CURBE still
+//!           deferred was never referenced by a CURBE load and is dropped. A CURBE written
+//!           to the block of this media state becomes the one the next media state compares with.
+//! \param    pCache
+//!           [in] CURBE cache
+//! \param    dwCurbeSize
+//!           [in] Size of the CURBE loaded by the media state
+//! \return   bool
+//!           true if the caller must record the block of this media state as the last CURBE
+//!
+template <class Cache>
+bool RenderHal_DSH_EndCurbeStaging(
+    Cache       *pCache,
+    uint32_t    dwCurbeSize)
+{
+    bool bWritten = !pCache->bDeferred && !pCache->bReused;
+
+    pCache->bDeferred    = false;
+    pCache->dwStagedSize = 0;
+
+    if (!bWritten || dwCurbeSize == 0 || dwCurbeSize > pCache->dwAllocSize)
+    {
+        return false;
+    }
+
+    memcpy(pCache->pData, pCache->pStaging, dwCurbeSize);
+    pCache->dwSize = dwCurbeSize;
+    return true;
+}
+
+#endif  // __RENDERHAL_DSH_CURBE_CACHE_H__
@@ -0,0 +1,237 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     renderhal_sampler_avs_template.h
+//! \brief    Packed AVS sampler state templates shared by layers with identical scaling.
+//! \details  Templated on the MHW AVS param/table structs and the RenderHal template cache,
+//!           so the key, match and LRU logic only depend on MOS definitions.
+//!
+
+#ifndef __RENDERHAL_SAMPLER_AVS_TEMPLATE_H__
+#define __RENDERHAL_SAMPLER_AVS_TEMPLATE_H__
+
+#include <string.h>
+#include "mos_defs.h"
+
+//!
+//! \brief  Fields of MHW_SAMPLER_STATE_AVS_PARAM packed into SAMPLER_STATE_8x8_AVS.
+//!         stateID, the AVS table pointer and the GSH table placement are left out,
+//!         the table contents are keyed through RENDERHAL_SAMPLER_AVS_TABLE_FIELDS.
+//!
+#define RENDERHAL_SAMPLER_AVS_PARAM_FIELDS(FIELD)                               \
+    FIELD(bEnableSTDE)                                                          \
+    FIELD(b8TapAdaptiveEnable)                                                  \
+    FIELD(bSkinDetailFactor)                                                    \
+    FIELD(bHdcDwEnable)                                                         \
+    FIELD(bWritebackStandard)                                                   \
+    FIELD(bEnableIEF)                                                           \
+    FIELD(wIEFFactor)                                                           \
+    FIELD(wR3xCoefficient)                                                      \
+    FIELD(wR3cCoefficient)                                                      \
+    FIELD(wR5xCoefficient)                                                      \
+    FIELD(wR5cxCoefficient)                                                     \
+    FIELD(wR5cCoefficient)                                                      \
+    FIELD(bEnableAVS)                                                           \
+    FIELD(AvsType)                                                              \
+    FIELD(EightTapAFEnable)                                                     \
+    FIELD(BypassIEF)                                                            \
+    FIELD(GainFactor)                                                           \
+    FIELD(GlobalNoiseEstm)                                                      \
+    FIELD(StrongEdgeThr)                                                        \
+    FIELD(WeakEdgeThr)                                                          \
+    FIELD(StrongEdgeWght)                                                       \
+    FIELD(RegularWght)                                                          \
+    FIELD(NonEdgeWght)                                                          \
+    FIELD(b8TapLumaForYUV444)                                                   \
+    FIELD(AdditionalOverridesUsed)                                              \
+    FIELD(YSlope2)                                                              \
+    FIELD(S0L)                                                                  \
+    FIELD(YSlope1)                                                              \
+    FIELD(S2U)                                                                  \
+    FIELD(S1U)
+
+//!
+//! \brief  Fields of MHW_SAMPLER_AVS_TABLE_PARAM. The coefficient tables are int8_t
+//!         arrays without padding, so they are hashed and compared as bytes.
+//!
+#define RENDERHAL_SAMPLER_AVS_TABLE_FIELDS(FIELD)                               \
+    FIELD(paMhwAvsCoeffParam)                                                   \
+    FIELD(byteTransitionArea8Pixels)                                            \
+    FIELD(byteTransitionArea4Pixels)                                            \
+    FIELD(byteMaxDerivative8Pixels)                                             \
+    FIELD(byteMaxDerivative4Pixels)                                             \
+    FIELD(byteDefaultSharpnessLevel)                                            \
+    FIELD(bEnableRGBAdaptive)                                                   \
+    FIELD(bAdaptiveFilterAllChannels)                                           \
+    FIELD(bBypassYAdaptiveFiltering)                                            \
+    FIELD(bBypassXAdaptiveFiltering)                                            \
+    FIELD(b8TapAdaptiveEnable)                                                  \
+    FIELD(b4TapGY)                                                              \
+    FIELD(b4TapRBUV)                                                            \
+    FIELD(bIsCoeffExtraEnabled)                                                 \
+    FIELD(paMhwAvsCoeffParamExtra)
+
+//!
+//! \brief    Hash a field into an AVS sampler template key
+//! \details  FNV-1a on 8 byte words, then on the remaining bytes
+//!
+static inline uint64_t RenderHal_HashSamplerAvsField(
+    uint64_t    hash,
+    const void  *pData,
+    size_t      size)
+{
+    static const uint64_t k = 0x100000001b3ULL;
+    const uint8_t *p = (const uint8_t *)pData;
+    uint64_t word;
+    size_t   i;
+
+    for (i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        memcpy(&word, p + i, sizeof(uint64_t));
+        hash = (hash ^ word) * k;
+    }
+    for (; i < size; i++)
+    {
+        hash = (hash ^ p[i]) * k;
+    }
+
+    return hash;
+}
+
+//!
+//! \brief    Get AVS Sampler Template Key
+//! \details  Hash the AVS sampler params and AVS table params that determine the
+//!           packed SAMPLER_STATE_8x8_AVS contents, field by field so struct padding
+//!           is never read
+//! \return   uint64_t
+//!           Non-zero key
+//!
+template <class AvsParam, class AvsTable>
+uint64_t RenderHal_GetSamplerAvsTemplateKey(
+    const AvsParam  &params,
+    const AvsTable  &table)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+#define RENDERHAL_HASH_AVS_PARAM(field) hash = RenderHal_HashSamplerAvsField(hash, &params.field, sizeof(params.field));
+#define RENDERHAL_HASH_AVS_TABLE(field) hash = RenderHal_HashSamplerAvsField(hash, &table.field, sizeof(table.field));
+    RENDERHAL_SAMPLER_AVS_PARAM_FIELDS(RENDERHAL_HASH_AVS_PARAM)
+    RENDERHAL_SAMPLER_AVS_TABLE_FIELDS(RENDERHAL_HASH_AVS_TABLE)
+#undef RENDERHAL_HASH_AVS_PARAM
+#undef RENDERHAL_HASH_AVS_TABLE
+
+    return hash ? hash : 1;
+}
+
+//!
+//! \brief    Check if two AVS params/table pairs pack to the same sampler state
+//! \details  Compares the keyed fields one by one
+//!
+template <class AvsParam, class AvsTable>
+bool RenderHal_IsSameSamplerAvsTemplate(
+    const AvsParam  &params0,
+    const AvsTable  &table0,
+    const AvsParam  &params1,
+    const AvsTable  &table1)
+{
+#define RENDERHAL_CMP_AVS_PARAM(field) if (memcmp(&params0.field, &params1.field, sizeof(params0.field))) return false;
+#define RENDERHAL_CMP_AVS_TABLE(field) if (memcmp(&table0.field, &table1.field, sizeof(table0.field))) return false;
+    RENDERHAL_SAMPLER_AVS_PARAM_FIELDS(RENDERHAL_CMP_AVS_PARAM)
+    RENDERHAL_SAMPLER_AVS_TABLE_FIELDS(RENDERHAL_CMP_AVS_TABLE)
+#undef RENDERHAL_CMP_AVS_PARAM
+#undef RENDERHAL_CMP_AVS_TABLE
+
+    return true;
+}
+
+//!
+//! \brief    Set AVS Sampler State from the template cache
+//! \details  Copies the packed state of a matching template, otherwise packs into
+//!           the least recently used template and copies that
+//! \param    pCache
+//!           [in] AVS sampler template cache
+//! \param    pSampler
+//!           [out] AVS sampler state in GSH
+//! \param    dwSize
+//!           [in] Packed SAMPLER_STATE_8x8_AVS size, not above the template size
+//! \param    params
+//!           [in] AVS sampler params
+//! \param    table
+//!           [in] AVS table params (zero if the params carry no table)
+//! \param    pack
+//!           [in] Packs the sampler state for params into the buffer passed to it
+//! \return   MOS_STATUS
+//!
+template <class Cache, class AvsParam, class AvsTable, class Pack>
+MOS_STATUS RenderHal_SetSamplerStateAvsFromTemplates(
+    Cache           *pCache,
+    uint8_t         *pSampler,
+    uint32_t        dwSize,
+    const AvsParam  &params,
+    const AvsTable  &table,
+    Pack            pack)
+{
+    const uint32_t templates = sizeof(pCache->Template) / sizeof(pCache->Template[0]);
+    uint64_t       ui64Key   = RenderHal_GetSamplerAvsTemplateKey(params, table);
+    auto           pVictim   = &pCache->Template[0];
+    MOS_STATUS     eStatus;
+
+    for (uint32_t i = 0; i < templates; i++)
+    {
+        auto pTemplate = &pCache->Template[i];
+        if (pTemplate->ui64Key == ui64Key &&
+            RenderHal_IsSameSamplerAvsTemplate(pTemplate->Params, pTemplate->Table, params, table))
+        {
+            pTemplate->dwRefresh = pCache->dwRefresh++;
+            pCache->dwHits++;
+            pCache->ui64BytesReused += dwSize;
+            memcpy(pSampler, pTemplate->SamplerState, dwSize);
+            return MOS_STATUS_SUCCESS;
+        }
+
+        if (pVictim->ui64Key != 0 &&
+            (pTemplate->ui64Key == 0 || pTemplate->dwRefresh < pVictim->dwRefresh))
+        {
+            pVictim = pTemplate;
+        }
+    }
+
+    // Pack into the least recently used template, then copy to GSH
+    pCache->dwMisses++;
+    pVictim->ui64Key = 0;
+    memset(pVictim->SamplerState, 0, dwSize);
+    eStatus = pack(pVictim->SamplerState);
+    if (eStatus != MOS_STATUS_SUCCESS)
+    {
+        return eStatus;
+    }
+
+    pVictim->ui64Key   = ui64Key;
+    pVictim->dwRefresh = pCache->dwRefresh++;
+    pVictim->Params    = params;
+    pVictim->Table     = table;
+    memcpy(pSampler, pVictim->SamplerState, dwSize);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+#endif  // __RENDERHAL_SAMPLER_AVS_TEMPLATE_H__
@@ -0,0 +1,315 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     renderhal_surface_state_template.h
+//! \brief    Surface state template key, lookup and copy back.
+//! \details  Templated on the RenderHal surface, params, entry and cache structs,
+//!           so the logic only depends on MOS definitions.
+//!
+
+#ifndef __RENDERHAL_SURFACE_STATE_TEMPLATE_H__
+#define __RENDERHAL_SURFACE_STATE_TEMPLATE_H__
+
+#include <string.h>
+#include "mos_defs.h"
+
+//!
+//! \brief    Get Surface State Template Key
+//! \details  Collect every surface, params and RenderHal input read by surface
+//!           state setup. The key is zeroed first, so padding never takes part in
+//!           the match. The resource address is not keyed - it is patched on use.
+//! \param    surface
+//!           [in] Render Hal Surface
+//! \param    params
+//!           [in] Surface State Params
+//! \param    ui64AllocSize
+//!           [in] Size of the GMM allocation backing the surface
+//! \param    bEnableYV12SinglePass
+//!           [in] RenderHal YV12 single pass setting
+//! \param    bEnableP010SinglePass
+//!           [in] RenderHal P010 single pass setting
+//! \param    pKey
+//!           [out] Template key
+//! \return   void
+//!
+template <class Key, class Surface, class Params>
+void RenderHal_GetSurfaceStateTemplateKey(
+    const Surface   &surface,
+    const Params    &params,
+    uint64_t        ui64AllocSize,
+    bool            bEnableYV12SinglePass,
+    bool            bEnableP010SinglePass,
+    Key             *pKey)
+{
+    const auto &os = surface.OsSurface;
+
+    memset(pKey, 0, sizeof(*pKey));
+
+    pKey->pGmmResInfo       = os.OsResource.pGmmResInfo;
+    pKey->ui64AllocSize     = ui64AllocSize;
+
+    pKey->dwArraySlice      = os.dwArraySlice;
+    pKey->dwMipSlice        = os.dwMipSlice;
+    pKey->S3dChannel        = os.S3dChannel;
+    pKey->Type              = os.Type;
+    pKey->bOverlay          = os.bOverlay;
+    pKey->bFlipChain        = os.bFlipChain;
+    pKey->dwWidth           = os.dwWidth;
+    pKey->dwHeight          = os.dwHeight;
+    pKey->dwSize            = os.dwSize;
+    pKey->dwDepth           = os.dwDepth;
+    pKey->dwArraySize       = os.dwArraySize;
+    pKey->dwLockPitch       = os.dwLockPitch;
+    pKey->dwPitch           = os.dwPitch;
+    pKey->dwSlicePitch      = os.dwSlicePitch;
+    pKey->dwQPitch          = os.dwQPitch;
+    pKey->TileType          = os.TileType;
+    pKey->Format            = os.Format;
+    pKey->bArraySpacing     = os.bArraySpacing;
+    pKey->bCompressible     = os.bCompressible;
+    pKey->dwOffset          = os.dwOffset;
+    pKey->YPlaneOffset      = os.YPlaneOffset;
+    pKey->UPlaneOffset      = os.UPlaneOffset;
+    pKey->VPlaneOffset      = os.VPlaneOffset;
+    pKey->RenderOffset[0]   = os.RenderOffset.YUV.Y;
+    pKey->RenderOffset[1]   = os.RenderOffset.YUV.U;
+    pKey->RenderOffset[2]   = os.RenderOffset.YUV.V;
+    pKey->LockOffset[0]     = os.LockOffset.YUV.Y;
+    pKey->LockOffset[1]     = os.LockOffset.YUV.U;
+    pKey->LockOffset[2]     = os.LockOffset.YUV.V;
+    pKey->bIsCompressed     = os.bIsCompressed;
+    pKey->CompressionMode   = os.CompressionMode;
+    pKey->CompressionFormat = os.CompressionFormat;
+    pKey->MmcState          = os.MmcState;
+    pKey->TileModeGMM       = os.TileModeGMM;
+    pKey->bGMMTileEnabled   = os.bGMMTileEnabled;
+    pKey->YoffsetForUplane  = os.YoffsetForUplane;
+    pKey->YoffsetForVplane  = os.YoffsetForVplane;
+
+    pKey->SurfType              = surface.SurfType;
+    pKey->ScalingMode           = surface.ScalingMode;
+    pKey->Rotation              = surface.Rotation;
+    pKey->ChromaSiting          = surface.ChromaSiting;
+    pKey->rcSrc                 = surface.rcSrc;
+    pKey->rcDst                 = surface.rcDst;
+    pKey->rcMaxSrc              = surface.rcMaxSrc;
+    pKey->bDeinterlaceEnable    = surface.bDeinterlaceEnable;
+    pKey->bQueryVariance        = surface.bQueryVariance;
+    pKey->bInterlacedScaling    = surface.bInterlacedScaling;
+    pKey->bDeinterlaceParams    = (surface.pDeinterlaceParams != nullptr);
+    pKey->SampleType            = surface.SampleType;
+    pKey->iPaletteID            = surface.iPaletteID;
+    pKey->dwWidthInUse          = surface.dwWidthInUse;
+    pKey->dwHeightInUse         = surface.dwHeightInUse;
+
+    pKey->bEnableYV12SinglePass = bEnableYV12SinglePass;
+    pKey->bEnableP010SinglePass = bEnableP010SinglePass;
+
+    pKey->Params.Type                      = params.Type;
+    pKey->Params.bRenderTarget             = params.bRenderTarget;
+    pKey->Params.bVertStride               = params.bVertStride;
+    pKey->Params.bVertStrideOffs           = params.bVertStrideOffs;
+    pKey->Params.bWidthInDword_Y           = params.bWidthInDword_Y;
+    pKey->Params.bWidthInDword_UV          = params.bWidthInDword_UV;
+    pKey->Params.bAVS                      = params.bAVS;
+    pKey->Params.Boundary                  = params.Boundary;
+    pKey->Params.bWidth16Align             = params.bWidth16Align;
+    pKey->Params.b2PlaneNV12NeededByKernel = params.b2PlaneNV12NeededByKernel;
+    pKey->Params.bForceNV12                = params.bForceNV12;
+    pKey->Params.bUseSinglePlane           = params.bUseSinglePlane;
+    pKey->Params.b32MWColorFillKern        = params.b32MWColorFillKern;
+    pKey->Params.bVASurface                = params.bVASurface;
+    pKey->Params.AddressControl            = params.AddressControl;
+    pKey->Params.bWAUseSrcHeight           = params.bWAUseSrcHeight;
+    pKey->Params.bWAUseSrcWidth            = params.bWAUseSrcWidth;
+    pKey->Params.bForce3DLUTR16G16         = params.bForce3DLUTR16G16;
+    pKey->Params.bChromasiting             = params.bChromasiting;
+    pKey->Params.bVmeUse                   = params.bVmeUse;
+    pKey->Params.bBufferUse                = params.bBufferUse;
+    pKey->Params.MemObjCtl                 = params.MemObjCtl;
+}
+
+//!
+//! \brief    Save Surface State Template Output
+//! \details  Keep the Render Hal Surface fields written by surface state setup
+//!
+template <class Output, class Surface>
+void RenderHal_SaveSurfaceStateTemplateOutput(
+    const Surface   &surface,
+    Output          *pOutput)
+{
+    pOutput->dwWidth     = surface.OsSurface.dwWidth;
+    pOutput->dwHeight    = surface.OsSurface.dwHeight;
+    pOutput->rcSrc       = surface.rcSrc;
+    pOutput->rcDst       = surface.rcDst;
+    pOutput->ScalingMode = surface.ScalingMode;
+}
+
+//!
+//! \brief    Apply Surface State Template Output
+//! \details  Write back only the Render Hal Surface fields written by surface
+//!           state setup, the rest of the caller's surface is left untouched
+//!
+template <class Output, class Surface>
+void RenderHal_ApplySurfaceStateTemplateOutput(
+    const Output    &output,
+    Surface         *pSurface)
+{
+    pSurface->OsSurface.dwWidth  = output.dwWidth;
+    pSurface->OsSurface.dwHeight = output.dwHeight;
+    pSurface->rcSrc              = output.rcSrc;
+    pSurface->rcDst              = output.rcDst;
+    pSurface->ScalingMode        = output.ScalingMode;
+}
+
+//!
+//! \brief    Check if a Render Hal Surface holds the saved output
+//!
+template <class Output, class Surface>
+bool RenderHal_IsSameSurfaceStateTemplateOutput(
+    const Output    &output,
+    const Surface   &surface)
+{
+    return output.dwWidth      == surface.OsSurface.dwWidth  &&
+           output.dwHeight     == surface.OsSurface.dwHeight &&
+           output.rcSrc.left   == surface.rcSrc.left         &&
+           output.rcSrc.top    == surface.rcSrc.top          &&
+           output.rcSrc.right  == surface.rcSrc.right        &&
+           output.rcSrc.bottom == surface.rcSrc.bottom       &&
+           output.rcDst.left   == surface.rcDst.left         &&
+           output.rcDst.top    == surface.rcDst.top          &&
+           output.rcDst.right  == surface.rcDst.right        &&
+           output.rcDst.bottom == surface.rcDst.bottom       &&
+           output.ScalingMode  == surface.ScalingMode;
+}
+
+//!
+//! \brief    Check if two surface state entries describe the same plane
+//! \details  Compares the plane layout fields, not the state slot, surface
+//!           pointer or token, which differ on every use
+//!
+template <class Entry>
+bool RenderHal_IsSameSurfaceStateEntry(
+    const Entry     &entry0,
+    const Entry     &entry1)
+{
+    return entry0.Type              == entry1.Type              &&
+           entry0.dwFormat          == entry1.dwFormat          &&
+           entry0.dwWidth           == entry1.dwWidth           &&
+           entry0.dwHeight          == entry1.dwHeight          &&
+           entry0.dwPitch           == entry1.dwPitch           &&
+           entry0.dwQPitch          == entry1.dwQPitch          &&
+           entry0.YUVPlane          == entry1.YUVPlane          &&
+           entry0.bAVS              == entry1.bAVS              &&
+           entry0.bRenderTarget     == entry1.bRenderTarget     &&
+           entry0.bVertStride       == entry1.bVertStride       &&
+           entry0.bVertStrideOffs   == entry1.bVertStrideOffs   &&
+           entry0.bWidthInDword     == entry1.bWidthInDword     &&
+           entry0.bTiledSurface     == entry1.bTiledSurface     &&
+           entry0.bTileWalk         == entry1.bTileWalk         &&
+           entry0.bHalfPitchChroma  == entry1.bHalfPitchChroma  &&
+           entry0.bInterleaveChroma == entry1.bInterleaveChroma &&
+           entry0.DirectionV        == entry1.DirectionV        &&
+           entry0.DirectionU        == entry1.DirectionU        &&
+           entry0.AddressControl    == entry1.AddressControl    &&
+           entry0.wUXOffset         == entry1.wUXOffset         &&
+           entry0.wUYOffset         == entry1.wUYOffset         &&
+           entry0.wVXOffset         == entry1.wVXOffset         &&
+           entry0.wVYOffset         == entry1.wVYOffset;
+}
+
+//!
+//! \brief    Find Surface State Template
+//! \details  Find a template matching the key. Templates built for the same GMM
+//!           descriptor with a different allocation size belong to a reallocated
+//!           resource and are invalidated.
+//! \return   Matching template, nullptr if not found
+//!
+template <class Cache, class Key>
+auto RenderHal_FindSurfaceStateTemplate(
+    Cache           *pCache,
+    const Key       &key) -> decltype(&pCache->Template[0])
+{
+    const uint32_t templates = sizeof(pCache->Template) / sizeof(pCache->Template[0]);
+    decltype(&pCache->Template[0]) pFound = nullptr;
+
+    for (uint32_t i = 0; i < templates; i++)
+    {
+        auto pTemplate = &pCache->Template[i];
+        if (pTemplate->Key.pGmmResInfo != key.pGmmResInfo)
+        {
+            continue;
+        }
+
+        if (pTemplate->Key.ui64AllocSize != key.ui64AllocSize)
+        {
+            pTemplate->Key.pGmmResInfo = nullptr;
+            pCache->dwInvalidated++;
+        }
+        else if (pFound == nullptr && memcmp(&pTemplate->Key, &key, sizeof(key)) == 0)
+        {
+            pTemplate->dwRefresh = pCache->dwRefresh++;
+            pFound = pTemplate;
+        }
+    }
+
+    return pFound;
+}
+
+//!
+//! \brief    Get the template to overwrite
+//! \return   Empty or least recently used template
+//!
+template <class Cache>
+auto RenderHal_GetSurfaceStateTemplateVictim(
+    Cache           *pCache) -> decltype(&pCache->Template[0])
+{
+    const uint32_t templates = sizeof(pCache->Template) / sizeof(pCache->Template[0]);
+    auto           pVictim   = &pCache->Template[0];
+
+    for (uint32_t i = 1; i < templates && pVictim->Key.pGmmResInfo; i++)
+    {
+        if (pCache->Template[i].Key.pGmmResInfo == nullptr ||
+            pCache->Template[i].dwRefresh < pVictim->dwRefresh)
+        {
+            pVictim = &pCache->Template[i];
+        }
+    }
+
+    return pVictim;
+}
+
+//!
+//! \brief    Check if a template hit must be verified
+//! \details  The first hit of every template is built uncached and compared,
+//!           then every dwVerifyInterval-th hit
+//!
+template <class Cache, class Template>
+bool RenderHal_IsSurfaceStateTemplateVerifyHit(
+    const Cache     *pCache,
+    Template        *pTemplate)
+{
+    uint32_t dwHit = pTemplate->dwHits++;
+    return pCache->dwVerifyInterval <= 1 || (dwHit % pCache->dwVerifyInterval) == 0;
+}
+
+#endif  // __RENDERHAL_SURFACE_STATE_TEMPLATE_H__
@@ -67,6 +67,9 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/vphal_common_hdr.h
     ${CMAKE_CURRENT_LIST_DIR}/vphal_render_vebox_denoise.h
     ${CMAKE_CURRENT_LIST_DIR}/vphal_render_hdr_base.h
+    ${CMAKE_CURRENT_LIST_DIR}/vphal_render_hdr_3dlut_cache.h
+    ${CMAKE_CURRENT_LIST_DIR}/vphal_render_hdr_table_cache.h
+    ${CMAKE_CURRENT_LIST_DIR}/vphal_render_vebox_state_image.h
     ${CMAKE_CURRENT_LIST_DIR}/vphal_render_vebox_memdecomp.h
 )
 
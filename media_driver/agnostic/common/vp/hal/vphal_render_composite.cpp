@@ -5866,7 +5866,7 @@ MOS_STATUS CompositeState::RenderPhase(
     Kdll_Procamp                    *pProcamp               = nullptr;;
     int32_t                         iFilterSize             = 0;
     Kdll_FilterEntry                *pFilter                = nullptr;;
-    uint32_t                        dwKernelHash            = 0;
+    uint64_t                        ui64KernelHash          = 0;
     MOS_STATUS                      eStatus                 = MOS_STATUS_UNKNOWN;
     PVPHAL_SURFACE                  pSource                 = nullptr;
     PVPHAL_SURFACE                  *pSourceArray           = nullptr;
@@ -6105,8 +6105,8 @@ MOS_STATUS CompositeState::RenderPhase(
     //============================
     // KERNEL SEARCH
     //============================
-    dwKernelHash = KernelDll_SimpleHash(pFilter, iFilterSize * sizeof(Kdll_FilterEntry));
-    pKernelEntry = KernelDll_GetCombinedKernel(pKernelDllState, pFilter, iFilterSize, dwKernelHash);
+    ui64KernelHash = KernelDll_SimpleHash64(pFilter, iFilterSize * sizeof(Kdll_FilterEntry));
+    pKernelEntry = KernelDll_GetCombinedKernel(pKernelDllState, pFilter, iFilterSize, ui64KernelHash);
 
     if (pKernelEntry)
     {
@@ -6163,7 +6163,7 @@ MOS_STATUS CompositeState::RenderPhase(
                            pSearchState,
                            pFilter,
                            iFilterSize,
-                           dwKernelHash);
+                           ui64KernelHash);
 
         if (!pKernelEntry)
         {
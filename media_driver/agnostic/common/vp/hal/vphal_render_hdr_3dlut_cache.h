@@ -0,0 +1,161 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     vphal_render_hdr_3dlut_cache.h
+//! \brief    Cache of HDR 3DLuts generated by kernel.
+//! \details  Only depends on MOS definitions, 3DLut generation, surface read back and buffer
+//!           allocation are passed in by the caller, so caching and the upload to the vebox
+//!           3DLut buffer can be tested on their own.
+//!
+#ifndef __VPHAL_RENDER_HDR_3DLUT_CACHE_H__
+#define __VPHAL_RENDER_HDR_3DLUT_CACHE_H__
+
+#include <list>
+#include <string.h>
+#include "mos_defs.h"
+
+//!
+//! \brief  3DLuts of the most recently used keys. A 3DLut must only depend on its key,
+//!         which is compared by Key::operator==. Buffers of evicted entries are reused.
+//!
+template<class Key>
+class VphalHdr3DLutCache
+{
+public:
+    //!
+    //! \param  [in] lutSize
+    //!         Size in bytes of a 3DLut
+    //! \param  [in] maxCount
+    //!         Max number of 3DLuts kept
+    //!
+    VphalHdr3DLutCache(uint32_t lutSize, uint32_t maxCount) : m_lutSize(lutSize), m_maxCount(maxCount)
+    {
+    }
+
+    //!
+    //! \brief  Get the 3DLut of key, which is generated if not cached
+    //! \param  [in] generate
+    //!         Generates the 3DLut of key into the 3DLut surface
+    //! \param  [in] read
+    //!         Reads the 3DLut surface into a buffer of lutSize
+    //! \param  [in] alloc
+    //!         Allocates a buffer of lutSize, returns nullptr on failure
+    //! \return uint8_t*
+    //!         Cached 3DLut, nullptr if the generated 3DLut cannot be cached, in which case
+    //!         it is only in the 3DLut surface
+    //!
+    template<class Generate, class Read, class Alloc>
+    uint8_t *Get(const Key &key, Generate generate, Read read, Alloc alloc)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if (it->key == key)
+            {
+                m_entries.splice(m_entries.begin(), m_entries, it);
+                return m_entries.front().lut;
+            }
+        }
+
+        generate();
+        m_generateCount++;
+
+        Entry entry = {};
+        if (m_entries.size() >= m_maxCount)
+        {
+            // Reuse the buffer of least recently used entry.
+            entry = m_entries.back();
+            m_entries.pop_back();
+        }
+        else
+        {
+            entry.lut = alloc();
+            if (nullptr == entry.lut)
+            {
+                return nullptr;
+            }
+        }
+
+        entry.key = key;
+        read(entry.lut);
+        m_entries.push_front(entry);
+        return entry.lut;
+    }
+
+    //!
+    //! \brief  Write the 3DLut returned by Get to the vebox 3DLut buffer
+    //! \param  [out] dst
+    //!         Vebox 3DLut buffer of lutSize
+    //! \param  [in] lut
+    //!         3DLut returned by Get
+    //! \param  [in] read
+    //!         Reads the 3DLut surface into a buffer of lutSize, used if lut is nullptr
+    //!
+    template<class Read>
+    void Upload(uint8_t *dst, const uint8_t *lut, Read read) const
+    {
+        if (lut)
+        {
+            memcpy(dst, lut, m_lutSize);
+        }
+        else
+        {
+            read(dst);
+        }
+    }
+
+    //!
+    //! \brief  Free all 3DLuts
+    //! \param  [in] free
+    //!         Frees a buffer returned by alloc of Get
+    //!
+    template<class Free>
+    void Clear(Free free)
+    {
+        for (auto &entry : m_entries)
+        {
+            free(entry.lut);
+        }
+        m_entries.clear();
+    }
+
+    //!
+    //! \brief  Number of 3DLuts generated since the cache being created
+    //!
+    uint32_t GetGenerateCount() const
+    {
+        return m_generateCount;
+    }
+
+private:
+    struct Entry
+    {
+        Key     key;
+        uint8_t *lut;
+    };
+
+    std::list<Entry> m_entries;              // Most recently used first.
+    const uint32_t   m_lutSize;
+    const uint32_t   m_maxCount;
+    uint32_t         m_generateCount = 0;
+};
+
+#endif // __VPHAL_RENDER_HDR_3DLUT_CACHE_H__
@@ -0,0 +1,121 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     vphal_render_hdr_table_cache.h
+//! \brief    Process wide cache of HDR tables which only depend on a few parameters.
+//! \details  Only depends on MOS definitions, the table calculation is passed in by the
+//!           caller, so cached tables can be checked against calculated ones.
+//!
+#ifndef __VPHAL_RENDER_HDR_TABLE_CACHE_H__
+#define __VPHAL_RENDER_HDR_TABLE_CACHE_H__
+
+#include <mutex>
+#include <string.h>
+#include <type_traits>
+#include "mos_defs.h"
+
+//!
+//! \brief  Tables of the most recently used keys. A table must only depend on its key,
+//!         which is compared by Key::operator==, and is copied bit by bit in and out
+//!         of the cache. Entries are replaced in least recently used order.
+//!
+template<class Key, class Table, uint32_t Size>
+class VphalHdrTableCache
+{
+    static_assert(std::is_trivially_copyable<Table>::value, "Table is copied by memcpy");
+
+public:
+    //!
+    //! \brief  Get the table of key
+    //! \param  [in] key
+    //!         All parameters the table depends on
+    //! \param  [out] table
+    //!         Table of key
+    //! \param  [in] calc
+    //!         Calculates the table by calc(key, table) if it is not cached
+    //!
+    template<class Calc>
+    void Get(const Key &key, Table &table, Calc calc)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto &entry : m_entries)
+            {
+                if (entry.valid && entry.key == key)
+                {
+                    memcpy(&table, &entry.table, sizeof(Table));
+                    entry.lastUsed = ++m_tick;
+                    return;
+                }
+            }
+        }
+
+        // Calculate without lock, the same table calculated by another thread meanwhile
+        // is just added twice.
+        calc(key, table);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Entry *victim = &m_entries[0];
+        for (auto &entry : m_entries)
+        {
+            if (!entry.valid)
+            {
+                victim = &entry;
+                break;
+            }
+            if (entry.lastUsed < victim->lastUsed)
+            {
+                victim = &entry;
+            }
+        }
+        memcpy(&victim->table, &table, sizeof(Table));
+        victim->key      = key;
+        victim->valid    = true;
+        victim->lastUsed = ++m_tick;
+        m_calcCount++;
+    }
+
+    //!
+    //! \brief  Number of tables calculated since the cache being created
+    //!
+    uint32_t GetCalcCount()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_calcCount;
+    }
+
+private:
+    struct Entry
+    {
+        Key      key;
+        Table    table;
+        bool     valid;
+        uint32_t lastUsed;
+    };
+
+    std::mutex m_mutex;
+    Entry      m_entries[Size] = {};
+    uint32_t   m_tick          = 0;
+    uint32_t   m_calcCount     = 0;
+};
+
+#endif // __VPHAL_RENDER_HDR_TABLE_CACHE_H__
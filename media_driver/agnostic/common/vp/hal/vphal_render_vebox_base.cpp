@@ -1669,15 +1669,164 @@ finish:
 #endif
 }
 
+bool VPHAL_VEBOX_STATE::VeboxBuildStateImageKey(
+    PVPHAL_VEBOX_STATE_IMAGE_KEY    pKey,
+    PMHW_VEBOX_IECP_PARAMS          pIecpParams,
+    PMHW_VEBOX_GAMUT_PARAMS         pHdrGamutParams,
+    PMHW_VEBOX_GAMUT_PARAMS         pBT2020GamutParams)
+{
+    PMHW_VEBOX_DNDI_PARAMS          pDndiParams = nullptr;
+    PVPHAL_VEBOX_RENDER_DATA        pRenderData = GetLastExecRenderData();
+
+    if (pKey == nullptr || pRenderData == nullptr)
+    {
+        return false;
+    }
+
+    // Zero the key so that padding bytes compare equal
+    MOS_ZeroMemory(pKey, sizeof(*pKey));
+
+    pDndiParams = pRenderData->GetVeboxStateParams()->pVphalVeboxDndiParams;
+    if (pDndiParams)
+    {
+        // SlimIPU denoise reads its table from system memory
+        if (pDndiParams->pSystemMem)
+        {
+            return false;
+        }
+        pKey->bDndi = true;
+        MOS_SecureMemcpy(&pKey->DndiParams, sizeof(pKey->DndiParams), pDndiParams, sizeof(*pDndiParams));
+    }
+
+    if (pIecpParams)
+    {
+        // LUT, CCM and vignette tables are not part of the key
+        if (pIecpParams->s3DLutParams.pLUT                                   ||
+            pIecpParams->s1DLutParams.p1DLUT                                 ||
+            pIecpParams->s1DLutParams.pCCM                                   ||
+            pIecpParams->CapPipeParams.VignetteParams.pCorrectionMap         ||
+            pIecpParams->CapPipeParams.ICCColorConversionParams.pLUT)
+        {
+            return false;
+        }
+
+        pKey->bIecp = true;
+        MOS_SecureMemcpy(&pKey->IecpParams, sizeof(pKey->IecpParams), pIecpParams, sizeof(*pIecpParams));
+
+        if (pIecpParams->pfCscCoeff && pIecpParams->pfCscInOffset && pIecpParams->pfCscOutOffset)
+        {
+            pKey->bCsc = true;
+            MOS_SecureMemcpy(pKey->fCscCoeff, sizeof(pKey->fCscCoeff), pIecpParams->pfCscCoeff, sizeof(pKey->fCscCoeff));
+            MOS_SecureMemcpy(pKey->fCscInOffset, sizeof(pKey->fCscInOffset), pIecpParams->pfCscInOffset, sizeof(pKey->fCscInOffset));
+            MOS_SecureMemcpy(pKey->fCscOutOffset, sizeof(pKey->fCscOutOffset), pIecpParams->pfCscOutOffset, sizeof(pKey->fCscOutOffset));
+        }
+        else if (pIecpParams->pfCscCoeff || pIecpParams->pfCscInOffset || pIecpParams->pfCscOutOffset)
+        {
+            return false;
+        }
+
+        if (pIecpParams->pfFeCscCoeff && pIecpParams->pfFeCscInOffset && pIecpParams->pfFeCscOutOffset)
+        {
+            pKey->bFeCsc = true;
+            MOS_SecureMemcpy(pKey->fFeCscCoeff, sizeof(pKey->fFeCscCoeff), pIecpParams->pfFeCscCoeff, sizeof(pKey->fFeCscCoeff));
+            MOS_SecureMemcpy(pKey->fFeCscInOffset, sizeof(pKey->fFeCscInOffset), pIecpParams->pfFeCscInOffset, sizeof(pKey->fFeCscInOffset));
+            MOS_SecureMemcpy(pKey->fFeCscOutOffset, sizeof(pKey->fFeCscOutOffset), pIecpParams->pfFeCscOutOffset, sizeof(pKey->fFeCscOutOffset));
+        }
+        else if (pIecpParams->pfFeCscCoeff || pIecpParams->pfFeCscInOffset || pIecpParams->pfFeCscOutOffset)
+        {
+            return false;
+        }
+
+        pKey->IecpParams.pfCscCoeff       = nullptr;
+        pKey->IecpParams.pfCscInOffset    = nullptr;
+        pKey->IecpParams.pfCscOutOffset   = nullptr;
+        pKey->IecpParams.pfFeCscCoeff     = nullptr;
+        pKey->IecpParams.pfFeCscInOffset  = nullptr;
+        pKey->IecpParams.pfFeCscOutOffset = nullptr;
+    }
+
+    if (pHdrGamutParams)
+    {
+        if (pHdrGamutParams->pFwdGammaBias || pHdrGamutParams->pInvGammaBias)
+        {
+            return false;
+        }
+        pKey->bHdr3DLut = true;
+        MOS_SecureMemcpy(&pKey->HdrGamutParams, sizeof(pKey->HdrGamutParams), pHdrGamutParams, sizeof(*pHdrGamutParams));
+    }
+
+    if (pBT2020GamutParams)
+    {
+        if (pBT2020GamutParams->pFwdGammaBias || pBT2020GamutParams->pInvGammaBias)
+        {
+            return false;
+        }
+        pKey->bBT2020TosRGB = true;
+        MOS_SecureMemcpy(&pKey->BT2020GamutParams, sizeof(pKey->BT2020GamutParams), pBT2020GamutParams, sizeof(*pBT2020GamutParams));
+    }
+
+    return true;
+}
+
+MOS_STATUS VPHAL_VEBOX_STATE::VeboxAddIndirectStates(
+    PMHW_VEBOX_IECP_PARAMS          pIecpParams,
+    bool                            bIecpState,
+    PMHW_VEBOX_GAMUT_PARAMS         pHdrGamutParams,
+    PMHW_VEBOX_GAMUT_PARAMS         pBT2020GamutParams)
+{
+    PMHW_VEBOX_INTERFACE            pVeboxInterface = m_pVeboxInterface;
+    PVPHAL_VEBOX_RENDER_DATA        pRenderData     = GetLastExecRenderData();
+    MOS_STATUS                      eStatus         = MOS_STATUS_SUCCESS;
+
+    VPHAL_RENDER_CHK_NULL(pVeboxInterface);
+    VPHAL_RENDER_CHK_NULL(pRenderData);
+    VPHAL_RENDER_CHK_NULL(pIecpParams);
+
+    if (pRenderData->GetVeboxStateParams()->pVphalVeboxDndiParams)
+    {
+        VPHAL_RENDER_CHK_STATUS(pVeboxInterface->AddVeboxDndiState(
+            pRenderData->GetVeboxStateParams()->pVphalVeboxDndiParams));
+    }
+
+    if (bIecpState)
+    {
+        VPHAL_RENDER_CHK_STATUS(pVeboxInterface->AddVeboxIecpState(
+            pIecpParams));
+    }
+
+    if (pHdrGamutParams)
+    {
+        VPHAL_RENDER_CHK_STATUS(pVeboxInterface->AddVeboxGamutState(
+            pIecpParams,
+            pHdrGamutParams));
+    }
+
+    if (pBT2020GamutParams)
+    {
+        VPHAL_RENDER_CHK_STATUS(pVeboxInterface->AddVeboxGamutState(
+            pIecpParams,
+            pBT2020GamutParams));
+    }
+
+finish:
+    return eStatus;
+}
+
 MOS_STATUS VPHAL_VEBOX_STATE::VeboxSetupIndirectStates(
     PVPHAL_SURFACE              pSrcSurface,
     PVPHAL_SURFACE              pOutSurface)
 {
     PMOS_INTERFACE                  pOsInterface       = nullptr;
     PMHW_VEBOX_INTERFACE            pVeboxInterface    = nullptr;
-    MOS_STATUS                      eStatus;
+    MOS_STATUS                      eStatus            = MOS_STATUS_SUCCESS;
     MHW_VEBOX_IECP_PARAMS           VeboxIecpParams    = {};
     MHW_VEBOX_GAMUT_PARAMS          VeboxGamutParams   = {};
+    MHW_VEBOX_GAMUT_PARAMS          HdrGamutParams     = {};
+    MHW_VEBOX_GAMUT_PARAMS          BT2020GamutParams  = {};
+    VPHAL_VEBOX_STATE_IMAGE_KEY     StateImageKey;
+    const MHW_VEBOX_HEAP            *pVeboxHeap        = nullptr;
+    bool                            bIecpState         = false;
+    bool                            bCacheable         = false;
     PVPHAL_VEBOX_STATE              pVeboxState        = this;
     PVPHAL_VEBOX_RENDER_DATA        pRenderData        = GetLastExecRenderData();
 
@@ -1710,12 +1859,6 @@ MOS_STATUS VPHAL_VEBOX_STATE::VeboxSetupIndirectStates(
         VPHAL_RENDER_CHK_STATUS(VeboxSetDNDIParams(pSrcSurface));
     }
 
-    if (pRenderData->GetVeboxStateParams()->pVphalVeboxDndiParams)
-    {
-        VPHAL_RENDER_CHK_STATUS(pVeboxInterface->AddVeboxDndiState(
-            pRenderData->GetVeboxStateParams()->pVphalVeboxDndiParams));
-    }
-
     // Set IECP State Params
     if (pRenderData->bIECP ||
         IS_VPHAL_OUTPUT_PIPE_SFC(pRenderData) ||
@@ -1730,8 +1873,7 @@ MOS_STATUS VPHAL_VEBOX_STATE::VeboxSetupIndirectStates(
         VPHAL_RENDER_CHK_STATUS(m_IECP->InitParams(
             pSrcSurface->ColorSpace,
             &VeboxIecpParams));
-        VPHAL_RENDER_CHK_STATUS(pVeboxInterface->AddVeboxIecpState(
-            &VeboxIecpParams));
+        bIecpState = true;
     }
 
     // Set Gamma Parameters
@@ -1742,9 +1884,7 @@ MOS_STATUS VPHAL_VEBOX_STATE::VeboxSetupIndirectStates(
         VeboxGamutParams.InputGammaValue    = MHW_GAMMA_1P0;
         VeboxGamutParams.OutputGammaValue   = MHW_GAMMA_1P0;
 
-        VPHAL_RENDER_CHK_STATUS(pVeboxInterface->AddVeboxGamutState(
-            &VeboxIecpParams,
-            &VeboxGamutParams));
+        HdrGamutParams = VeboxGamutParams;
     }
 
     if (pRenderData->bBT2020TosRGB)
@@ -1757,11 +1897,33 @@ MOS_STATUS VPHAL_VEBOX_STATE::VeboxSetupIndirectStates(
         VeboxGamutParams.GExpMode      = MHW_GAMUT_MODE_NONE;
         VeboxGamutParams.bGammaCorr    = false;
 
-        VPHAL_RENDER_CHK_STATUS(pVeboxInterface->AddVeboxGamutState(
-            &VeboxIecpParams,
-            &VeboxGamutParams));
+        BT2020GamutParams = VeboxGamutParams;
     }
 
+    // The indirect states only depend on the params above, so reuse the image
+    // of last frame if none of them changed
+    bCacheable = VeboxBuildStateImageKey(
+        &StateImageKey,
+        bIecpState ? &VeboxIecpParams : nullptr,
+        pRenderData->bHdr3DLut ? &HdrGamutParams : nullptr,
+        pRenderData->bBT2020TosRGB ? &BT2020GamutParams : nullptr);
+
+    VPHAL_RENDER_CHK_STATUS(pVeboxInterface->GetVeboxHeapInfo(&pVeboxHeap));
+    VPHAL_RENDER_CHK_NULL(pVeboxHeap);
+    VPHAL_RENDER_CHK_NULL(pVeboxHeap->pLockedDriverResourceMem);
+
+    eStatus = m_StateImage.Setup(
+        bCacheable ? &StateImageKey : nullptr,
+        pVeboxHeap->pLockedDriverResourceMem + pVeboxHeap->uiCurState * pVeboxHeap->uiInstanceSize,
+        pVeboxHeap->uiInstanceSize,
+        [&]() {
+            return VeboxAddIndirectStates(
+                &VeboxIecpParams,
+                bIecpState,
+                pRenderData->bHdr3DLut ? &HdrGamutParams : nullptr,
+                pRenderData->bBT2020TosRGB ? &BT2020GamutParams : nullptr);
+        });
+
 finish:
     return eStatus;
 }
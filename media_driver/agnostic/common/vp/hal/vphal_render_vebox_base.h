@@ -36,6 +36,7 @@
 #include "vphal_render_vebox_iecp.h"
 #include "vphal_render_sfc_base.h"
 #include "vphal_render_vebox_denoise.h"
+#include "vphal_render_vebox_state_image.h"
 
 #define VPHAL_MAX_NUM_FFDI_SURFACES     4                                       //!< 2 for ADI plus additional 2 for parallel execution on HSW+
 #define VPHAL_NUM_FFDN_SURFACES         2                                       //!< Number of FFDN surfaces
@@ -551,6 +552,31 @@ struct VPHAL_VEBOX_STATE_PARAMS
     PVPHAL_VEBOX_IECP_PARAMS        pVphalVeboxIecpParams;
 };
 
+//!
+//! \brief  Inputs of the VEBOX indirect states built by VeboxSetupIndirectStates
+//! \details Pointer fields of the MHW params are cleared and the CSC matrices
+//!          they refer to are copied by value, so two zeroed keys can be memcmp'd.
+//!
+typedef struct _VPHAL_VEBOX_STATE_IMAGE_KEY
+{
+    bool                            bDndi;
+    bool                            bIecp;
+    bool                            bHdr3DLut;
+    bool                            bBT2020TosRGB;
+    MHW_VEBOX_DNDI_PARAMS           DndiParams;
+    MHW_VEBOX_IECP_PARAMS           IecpParams;
+    bool                            bCsc;
+    bool                            bFeCsc;
+    float                           fCscCoeff[9];
+    float                           fCscInOffset[3];
+    float                           fCscOutOffset[3];
+    float                           fFeCscCoeff[9];
+    float                           fFeCscInOffset[3];
+    float                           fFeCscOutOffset[3];
+    MHW_VEBOX_GAMUT_PARAMS          HdrGamutParams;
+    MHW_VEBOX_GAMUT_PARAMS          BT2020GamutParams;
+} VPHAL_VEBOX_STATE_IMAGE_KEY, *PVPHAL_VEBOX_STATE_IMAGE_KEY;
+
 //!
 //! \brief  Chroma Denoise params
 //!
@@ -940,6 +966,9 @@ public:
     float                           *fFeCscInOffset;                             //!< [3x1] Input Offset matrix for CSC
     float                           *fFeCscOutOffset;                            //!< [3x1] Output Offset matrix for CSC
 
+    // Image of the indirect states of last frame
+    VphalVeboxStateImage<VPHAL_VEBOX_STATE_IMAGE_KEY> m_StateImage;            //!< Copy of the vebox heap instance and its key
+
     // Dynamic linking filter
     Kdll_FilterEntry                SearchFilter[2];
 
@@ -1272,6 +1301,49 @@ protected:
         PVPHAL_SURFACE                  pSrcSurface,
         PVPHAL_SURFACE                  pOutSurface);
 
+    //!
+    //! \brief    Vebox build indirect state image key
+    //! \details  Collect the inputs of the DNDI, IECP and Gamut states into a
+    //!           key which can be compared against the one of the cached image
+    //! \param    [out] pKey
+    //!           Pointer to the key to be built
+    //! \param    [in] pIecpParams
+    //!           Pointer to MHW IECP params, nullptr if IECP state is not set
+    //! \param    [in] pHdrGamutParams
+    //!           Pointer to gamut params for HDR 3DLut, nullptr if not used
+    //! \param    [in] pBT2020GamutParams
+    //!           Pointer to gamut params for BT2020 to sRGB, nullptr if not used
+    //! \return   bool
+    //!           Return true if the states only depend on the key, false if
+    //!           they refer to external tables and must not be cached
+    //!
+    bool VeboxBuildStateImageKey(
+        PVPHAL_VEBOX_STATE_IMAGE_KEY    pKey,
+        PMHW_VEBOX_IECP_PARAMS          pIecpParams,
+        PMHW_VEBOX_GAMUT_PARAMS         pHdrGamutParams,
+        PMHW_VEBOX_GAMUT_PARAMS         pBT2020GamutParams);
+
+    //!
+    //! \brief    Vebox add indirect states
+    //! \details  Build the DNDI, IECP and Gamut states into the current vebox
+    //!           heap instance
+    //! \param    [in] pIecpParams
+    //!           Pointer to MHW IECP params
+    //! \param    [in] bIecpState
+    //!           Add the IECP state
+    //! \param    [in] pHdrGamutParams
+    //!           Pointer to gamut params for HDR 3DLut, nullptr if not used
+    //! \param    [in] pBT2020GamutParams
+    //!           Pointer to gamut params for BT2020 to sRGB, nullptr if not used
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS VeboxAddIndirectStates(
+        PMHW_VEBOX_IECP_PARAMS          pIecpParams,
+        bool                            bIecpState,
+        PMHW_VEBOX_GAMUT_PARAMS         pHdrGamutParams,
+        PMHW_VEBOX_GAMUT_PARAMS         pBT2020GamutParams);
+
     //!
     //! \brief    Vebox Set VEBOX parameter
     //! \details  Set up the VEBOX parameter value
@@ -0,0 +1,102 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     vphal_render_vebox_state_image.h
+//! \brief    Image of the VEBOX indirect states of the last frame.
+//! \details  Only depends on MOS definitions, the state building is passed in by the
+//!           caller, so replayed images can be checked against built ones.
+//!
+#ifndef __VPHAL_RENDER_VEBOX_STATE_IMAGE_H__
+#define __VPHAL_RENDER_VEBOX_STATE_IMAGE_H__
+
+#include <string.h>
+#include <type_traits>
+#include <vector>
+#include "mos_defs.h"
+
+//!
+//! \brief  Copy of the vebox heap instance built from Key. The instance must be zeroed
+//!         before the states are built, so the image holds every byte the states depend
+//!         on. Keys are compared by memcmp and must be zeroed before being filled, a
+//!         difference in padding only costs a rebuild.
+//!
+template<class Key>
+class VphalVeboxStateImage
+{
+    static_assert(std::is_trivially_copyable<Key>::value, "Key is compared by memcmp");
+
+public:
+    //!
+    //! \brief  Set up the indirect states in the vebox heap instance
+    //! \param  [in] key
+    //!         All inputs of the states, nullptr if the states depend on anything else
+    //! \param  [in,out] instance
+    //!         Zeroed vebox heap instance
+    //! \param  [in] size
+    //!         Size of the instance in bytes
+    //! \param  [in] build
+    //!         Builds the states into instance by build() if they can't be replayed
+    //! \return MOS_STATUS
+    //!         Return MOS_STATUS_SUCCESS if the states are set up, otherwise the status
+    //!         of build()
+    //!
+    template<class Build>
+    MOS_STATUS Setup(const Key *key, uint8_t *instance, uint32_t size, Build build)
+    {
+        MOS_STATUS eStatus;
+
+        if (key && m_valid && m_image.size() == size && !memcmp(key, &m_key, sizeof(Key)))
+        {
+            memcpy(instance, m_image.data(), size);
+            m_replayCount++;
+            return MOS_STATUS_SUCCESS;
+        }
+
+        m_valid = false;
+        eStatus = build();
+        if (eStatus != MOS_STATUS_SUCCESS || key == nullptr)
+        {
+            return eStatus;
+        }
+
+        m_image.assign(instance, instance + size);
+        memcpy(&m_key, key, sizeof(Key));
+        m_valid = true;
+        return eStatus;
+    }
+
+    //!
+    //! \brief  Number of frames the image was replayed for
+    //!
+    uint32_t GetReplayCount() const
+    {
+        return m_replayCount;
+    }
+
+private:
+    Key                  m_key         = {};
+    std::vector<uint8_t> m_image;
+    bool                 m_valid       = false;
+    uint32_t             m_replayCount = 0;
+};
+
+#endif // __VPHAL_RENDER_VEBOX_STATE_IMAGE_H__
@@ -252,12 +252,6 @@ const char  *g_cInit_ComponentNames[] =
     IDR_VP_KERNEL_NAMES
 };
 
-#define FOLD_HASH(folded_hash, hash)                                   \
-    {                                                                  \
-        folded_hash = (((hash) >> 8) ^ (hash)) & 0x00ff00ff;           \
-        folded_hash = ((folded_hash >> 16) ^ folded_hash) & 0xff;      \
-    }                                                                  \
-
 #if _DEBUG || EMUL || VPHAL_LIB
 
 #ifndef VPHAL_LIB
@@ -3809,24 +3803,6 @@ bool Kdll_ResolveKernelDependencies(
     return true;
 }
 
-//--------------------------------------------------------------
-// Fowler/Noll/Vo FNV-1a hash algorithm - public domain
-//--------------------------------------------------------------
-uint32_t KernelDll_SimpleHash(void *pData, int32_t iSize)
-{
-   static const uint32_t k = 0x1000193;
-   uint32_t hash = 0x811c9dc5;
-   char *p = (char *)pData;
-
-   for(; iSize > 0; iSize--)
-   {
-      hash ^= (*p++);
-      hash *= k;
-   }
-
-   return hash;
-}
-
 //--------------------------------------------------------------
 // KernelDll_GetCombinedKernel - Search combined kernel
 //--------------------------------------------------------------
@@ -3834,41 +3810,31 @@ Kdll_CacheEntry *KernelDll_GetCombinedKernel(
     Kdll_State          *pState,
     Kdll_FilterEntry    *pFilter,
     int32_t             iFilterSize,
-    uint32_t            dwHash)
+    uint64_t            ui64Hash)
 {
     Kdll_KernelHashTable *pHashTable;
-    Kdll_KernelHashEntry *entries, *curr, *next;
-    uint32_t folded_hash;
+    Kdll_KernelHashEntry *entries, *curr;
+    uint32_t slot;
     uint16_t entry;
 
     VPHAL_RENDER_FUNCTION_ENTER;
 
     // Get hash table
     pHashTable = &pState->KernelHashTable;
+    entries    = (&pHashTable->HashEntry[0]) - 1;  // all indices are 1 based (0 means null)
 
-    // fold hash from 32 to 8 bit :-)
-    FOLD_HASH(folded_hash, dwHash)
-
-    // No entries
-    entry = pHashTable->wHashTable[folded_hash];
-    if (entry == 0 || entry > DL_MAX_COMBINED_KERNELS ) return nullptr;
-
-    entries = (&pHashTable->HashEntry[0]) - 1;  // all indices are 1 based (0 means null)
-    curr    = &entries[entry];
-    for (; (curr != nullptr); curr = next)
+    // match 64-bit hash, then compare filter
+    curr = nullptr;
+    slot = KDLL_HASH_SLOT(ui64Hash);
+    while ((entry = KernelDll_FindHashSlot(pHashTable, ui64Hash, &slot)) != 0)
     {
-        // match 32-bit hash, then compare filter
-        if (curr->dwHash  == dwHash &&
-            curr->iFilter == iFilterSize)
+        curr = &entries[entry];
+        if (curr->iFilter == iFilterSize &&
+            memcmp(curr->pFilter, pFilter, iFilterSize * sizeof(Kdll_FilterEntry)) == 0)
         {
-            if (memcmp(curr->pFilter, pFilter, iFilterSize * sizeof(Kdll_FilterEntry)) == 0)
-            {
-                break;
-            }
+            break;
         }
-
-        // Next entry with the same 8-bit folded hash
-        next = (curr->next) ? (&entries[curr->next]) : nullptr;
+        curr = nullptr;
     }
 
     if (curr)
@@ -3886,11 +3852,10 @@ Kdll_CacheEntry *KernelDll_GetCombinedKernel(
 // KernelDll_AllocateHashEntry - Allocate hash entry
 //--------------------------------------------------------------
 uint16_t KernelDll_AllocateHashEntry(Kdll_KernelHashTable *pHashTable,
-                                 uint32_t              hash)
+                                     uint64_t              ui64Hash)
 {
     Kdll_KernelHashEntry *pHashEntry = &pHashTable->HashEntry[0] - 1;
     Kdll_KernelHashEntry *pNewEntry;
-    uint32_t folded_hash;
     uint16_t entry;
 
     VPHAL_RENDER_FUNCTION_ENTER;
@@ -3910,13 +3875,12 @@ uint16_t KernelDll_AllocateHashEntry(Kdll_KernelHashTable *pHashTable,
     }
 
     // Initialize entry, attach to the hash table
-    FOLD_HASH(folded_hash, hash);
-    pNewEntry->dwHash      = hash;
-    pNewEntry->next        = pHashTable->wHashTable[folded_hash];
+    pNewEntry->ui64Hash    = ui64Hash;
+    pNewEntry->next        = 0;
     pNewEntry->iFilter     = 0;
     pNewEntry->pFilter     = nullptr;
     pNewEntry->pCacheEntry = nullptr;
-    pHashTable->wHashTable[folded_hash] = entry;
+    KernelDll_InsertHashSlot(pHashTable, entry);
     return entry;
 }
 
@@ -3926,41 +3890,21 @@ uint16_t KernelDll_AllocateHashEntry(Kdll_KernelHashTable *pHashTable,
 void KernelDll_ReleaseHashEntry(Kdll_KernelHashTable *pHashTable, uint16_t entry)
 {
     Kdll_KernelHashEntry *pHashEntry = &pHashTable->HashEntry[0] - 1;
-    uint32_t folded_hash;
-    uint16_t next;
 
     VPHAL_RENDER_FUNCTION_ENTER;
 
-    if (entry == 0)
+    if (entry == 0 || entry > DL_MAX_COMBINED_KERNELS)
     {
         return;
     }
 
-    // unlink entry
-    next = pHashEntry[entry].next;
-    pHashEntry[entry].next = 0;
-
-    // remove references to entry from hash table
-    FOLD_HASH(folded_hash, pHashEntry[entry].dwHash);
-    if (pHashTable->wHashTable[folded_hash] == entry)
+    // remove entry from hash table
+    if (!KernelDll_RemoveHashSlot(pHashTable, entry))
     {
-        pHashTable->wHashTable[folded_hash] = next;
-    }
-    else
-    {
-        uint16_t prev = pHashTable->wHashTable[folded_hash];
-
-        while (prev != 0 &&
-               pHashEntry[prev].next != entry)
-        {
-            prev = pHashEntry[prev].next;
-        }
-
-        if (prev)
-        {
-            pHashEntry[prev].next = next;
-        }
+        VPHAL_RENDER_ASSERTMESSAGE("Hash entry %d not found in slot %d.", entry, pHashEntry[entry].wSlot);
+        return;
     }
+    pHashEntry[entry].next = 0;
 
     // return entry to pool
     if (pHashTable->pool == 0)
@@ -4042,7 +3986,8 @@ bool KernelDll_GarbageCollection(Kdll_State *pState, int32_t size)
     pHashEntry += wEntry;
     if (!pOldest ||
         wEntry == 0 ||
-        pHashEntry->pCacheEntry != pOldest)
+        pHashEntry->pCacheEntry != pOldest ||
+        pHashTable->wHashTable[pHashEntry->wSlot] != wEntry)
     {
         VPHAL_RENDER_ASSERT(false);
         return false;
@@ -4214,7 +4159,7 @@ KernelDll_AddKernel(Kdll_State       *pState,           // Kernel Dll state
                     Kdll_SearchState *pSearchState,     // Search state
                     Kdll_FilterEntry *pFilter,          // Original filter
                     int32_t           iFilterSize,      // Original filter size
-                    uint32_t          dwHash)
+                    uint64_t          ui64Hash)
 {
     Kdll_CacheEntry      *pCacheEntry;
     Kdll_KernelHashTable *pHashTable;
@@ -4253,7 +4198,7 @@ KernelDll_AddKernel(Kdll_State       *pState,           // Kernel Dll state
     }
 
     // Get hash entry
-    entry = KernelDll_AllocateHashEntry(pHashTable, dwHash);
+    entry = KernelDll_AllocateHashEntry(pHashTable, ui64Hash);
     if (!entry)
     {
         VPHAL_RENDER_ASSERTMESSAGE("Failed to allocate hash entry for new kernel.");
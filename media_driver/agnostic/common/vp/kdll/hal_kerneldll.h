@@ -27,6 +27,7 @@
 #define __HAL_KERNELDLL_H__
 
 #include "mos_defs.h"
+#include "hal_kerneldll_hash.h"
 #include "cm_fc_ld.h"
 // Kernel IDs and Kernel Names
 #include "vpkrnheader.h" // IDR_VP_TOTAL_NUM_KERNELS
@@ -65,7 +66,6 @@
 #define DL_MAX_COMPONENT_KERNELS        25       // max number of component kernels that can be combined
 #define DL_MAX_EXPORT_COUNT             64       // size of the symbol export table
 #define DL_DEFAULT_COMBINED_KERNELS     4        // Default number of kernels in cache
-#define DL_MAX_COMBINED_KERNELS         64       // Max number of kernels in cache
 #define DL_NEW_COMBINED_KERNELS         4        // The increased number of kernels in cache each time
 #define DL_MAX_SYMBOLS                  100      // max number of import/export symbols in a combined kernels
 #define DL_CACHE_BLOCK_SIZE             (128*1024)   // Kernel allocation block size
@@ -570,26 +570,6 @@ typedef struct tagKdll_KernelCache
     Kdll_LinkData   *pExports;          // Exports table
 } Kdll_KernelCache;
 
-//--------------------------------------------------------------
-// Kernel Hash table
-//--------------------------------------------------------------
-typedef struct tagKdll_KernelHashEntry
-{
-    uint16_t            next;              // Next entry with same 8-bit hash + 1 (0 is null)
-    uint32_t            dwHash;            // 32-bit hash value (FNV-1a hash)
-    int                 iFilter;           // Filter size
-    Kdll_FilterEntry    *pFilter;          // Filter for matching
-    Kdll_CacheEntry     *pCacheEntry;      // Pointer to kernel cache entry
-} Kdll_KernelHashEntry;
-
-typedef struct tagKdll_KernelHashTable
-{
-    uint16_t             wHashTable[256];   // 256 hashes (1 based index)
-    uint16_t             pool;              // first in pool (1 based index)
-    uint16_t             last;              // last in pool (for releasing)
-    Kdll_KernelHashEntry HashEntry[DL_MAX_COMBINED_KERNELS]; // Hash table entries
-} Kdll_KernelHashTable;
-
 //--------------------------------------------------------------
 // Dynamic linking state
 //--------------------------------------------------------------
@@ -783,11 +763,6 @@ bool KernelDll_UpdateState(
     Kdll_State       *pState,
     Kdll_SearchState *pSearchState);
 
-// Simple Hash function
-uint32_t KernelDll_SimpleHash(
-    void            *pData,
-    int             iSize);
-
 //---------------------------------------------------------------------------------------
 // KernelDll_SetupFunctionPointers - Setup Function pointers based on platform
 //
@@ -828,7 +803,7 @@ Kdll_CacheEntry *
 KernelDll_GetCombinedKernel(Kdll_State       *pState,
                             Kdll_FilterEntry *iFilter,
                             int               iFilterSize,
-                            uint32_t          dwHash);
+                            uint64_t          ui64Hash);
 
 // Get component/static kernel
 Kdll_CacheEntry *
@@ -853,7 +828,7 @@ KernelDll_AddKernel(Kdll_State       *pState,
                     Kdll_SearchState *pSearchState,
                     Kdll_FilterEntry *pFilter,
                     int               iFilterSize,
-                    uint32_t          dwHash);
+                    uint64_t          ui64Hash);
 
 // Search kernel, output is in pSearchState
 bool KernelDll_SearchKernel(
@@ -0,0 +1,188 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      hal_kerneldll_hash.h
+//! \brief         Combined kernel hash table of the dynamic kernel linking/loading
+//!
+#ifndef __HAL_KERNELDLL_HASH_H__
+#define __HAL_KERNELDLL_HASH_H__
+
+#include <string.h>
+#include "mos_defs.h"
+
+#define DL_MAX_COMBINED_KERNELS         64       // Max number of kernels in cache
+#define DL_KERNEL_HASH_TABLE_SIZE       (DL_MAX_COMBINED_KERNELS * 4) // Open addressing slots (power of 2, load factor <= 1/4)
+
+// Home slot of a 64-bit hash in the open addressing table
+#define KDLL_HASH_SLOT(hash)                                                    \
+    ((uint32_t)((hash) ^ ((hash) >> 32)) & (DL_KERNEL_HASH_TABLE_SIZE - 1))
+
+#define KDLL_HASH_NEXT_SLOT(slot)                                               \
+    (((slot) + 1) & (DL_KERNEL_HASH_TABLE_SIZE - 1))
+
+struct tagKdll_FilterEntry;
+struct tagKdll_CacheEntry;
+
+//--------------------------------------------------------------
+// Kernel Hash table
+//--------------------------------------------------------------
+typedef struct tagKdll_KernelHashEntry
+{
+    uint16_t                    next;              // Next entry in free pool + 1 (0 is null)
+    uint16_t                    wSlot;             // Slot in open addressing table
+    uint64_t                    ui64Hash;          // 64-bit hash value
+    int                         iFilter;           // Filter size
+    struct tagKdll_FilterEntry  *pFilter;          // Filter for matching
+    struct tagKdll_CacheEntry   *pCacheEntry;      // Pointer to kernel cache entry
+} Kdll_KernelHashEntry;
+
+typedef struct tagKdll_KernelHashTable
+{
+    uint16_t             wHashTable[DL_KERNEL_HASH_TABLE_SIZE];   // Open addressing slots, linear probing (1 based index, 0 is empty)
+    uint16_t             pool;              // first in pool (1 based index)
+    uint16_t             last;              // last in pool (for releasing)
+    Kdll_KernelHashEntry HashEntry[DL_MAX_COMBINED_KERNELS]; // Hash table entries
+} Kdll_KernelHashTable;
+
+//--------------------------------------------------------------
+// 64-bit word-at-a-time hash (multiply/xorshift mixing per 8 bytes,
+// murmur3 finalizer) - used to index the combined kernel cache
+//--------------------------------------------------------------
+static inline uint64_t KernelDll_SimpleHash64(const void *pData, int32_t iSize)
+{
+    static const uint64_t k = 0x9e3779b97f4a7c15ULL;
+    uint64_t hash = 0xcbf29ce484222325ULL ^ (uint64_t)iSize;
+    const uint8_t *p = (const uint8_t *)pData;
+    uint64_t word;
+
+    for (; iSize >= (int32_t)sizeof(uint64_t); iSize -= sizeof(uint64_t), p += sizeof(uint64_t))
+    {
+        memcpy(&word, p, sizeof(uint64_t));
+        hash  = (hash ^ word) * k;
+        hash ^= hash >> 29;
+    }
+
+    if (iSize > 0)
+    {
+        word = 0;
+        memcpy(&word, p, iSize);
+        hash  = (hash ^ word) * k;
+        hash ^= hash >> 29;
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+//--------------------------------------------------------------
+// KernelDll_InsertHashSlot - Attach entry to the first empty slot
+// from the home slot of its hash
+//--------------------------------------------------------------
+static inline void KernelDll_InsertHashSlot(Kdll_KernelHashTable *pHashTable, uint16_t entry)
+{
+    Kdll_KernelHashEntry *pHashEntry = &pHashTable->HashEntry[entry - 1];
+    uint32_t slot;
+
+    // Table is never full (load factor <= 1/4)
+    slot = KDLL_HASH_SLOT(pHashEntry->ui64Hash);
+    while (pHashTable->wHashTable[slot] != 0)
+    {
+        slot = KDLL_HASH_NEXT_SLOT(slot);
+    }
+
+    pHashEntry->wSlot            = (uint16_t)slot;
+    pHashTable->wHashTable[slot] = entry;
+}
+
+//--------------------------------------------------------------
+// KernelDll_FindHashSlot - Next entry with the hash, probing from
+// *pSlot up to the first empty slot; *pSlot is set past the entry.
+// Start with *pSlot = KDLL_HASH_SLOT(ui64Hash). Returns 0 if none.
+//--------------------------------------------------------------
+static inline uint16_t KernelDll_FindHashSlot(const Kdll_KernelHashTable *pHashTable, uint64_t ui64Hash, uint32_t *pSlot)
+{
+    uint32_t slot;
+    uint16_t entry;
+
+    for (slot = *pSlot;
+         (entry = pHashTable->wHashTable[slot]) != 0;
+         slot = KDLL_HASH_NEXT_SLOT(slot))
+    {
+        if (entry > DL_MAX_COMBINED_KERNELS)
+        {
+            return 0;
+        }
+
+        if (pHashTable->HashEntry[entry - 1].ui64Hash == ui64Hash)
+        {
+            *pSlot = KDLL_HASH_NEXT_SLOT(slot);
+            return entry;
+        }
+    }
+
+    *pSlot = slot;
+    return 0;
+}
+
+//--------------------------------------------------------------
+// KernelDll_RemoveHashSlot - Detach entry from its slot (backward
+// shift deletion, no tombstones). Returns false if the entry is not
+// in the slot it recorded.
+//--------------------------------------------------------------
+static inline bool KernelDll_RemoveHashSlot(Kdll_KernelHashTable *pHashTable, uint16_t entry)
+{
+    Kdll_KernelHashEntry *pHashEntry = &pHashTable->HashEntry[0] - 1;
+    uint32_t hole, slot, home;
+    uint16_t moved;
+
+    hole = pHashEntry[entry].wSlot;
+    if (hole >= DL_KERNEL_HASH_TABLE_SIZE ||
+        pHashTable->wHashTable[hole] != entry)
+    {
+        return false;
+    }
+
+    for (slot = KDLL_HASH_NEXT_SLOT(hole);
+         (moved = pHashTable->wHashTable[slot]) != 0;
+         slot = KDLL_HASH_NEXT_SLOT(slot))
+    {
+        // Move entry back into the hole unless its home slot lies in (hole, slot]
+        home = KDLL_HASH_SLOT(pHashEntry[moved].ui64Hash);
+        if (((slot - home) & (DL_KERNEL_HASH_TABLE_SIZE - 1)) >=
+            ((slot - hole) & (DL_KERNEL_HASH_TABLE_SIZE - 1)))
+        {
+            pHashTable->wHashTable[hole] = moved;
+            pHashEntry[moved].wSlot      = (uint16_t)hole;
+            hole                         = slot;
+        }
+    }
+    pHashTable->wHashTable[hole] = 0;
+
+    return true;
+}
+
+#endif // __HAL_KERNELDLL_HASH_H__
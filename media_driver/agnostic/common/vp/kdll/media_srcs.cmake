@@ -24,6 +24,7 @@ set(TMP_SOURCES_
 
 set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/hal_kerneldll.h
+    ${CMAKE_CURRENT_LIST_DIR}/hal_kerneldll_hash.h
 )
 
 
@@ -49,7 +49,7 @@ MOS_STATUS CodechalDecodeHevcG11::AllocateResourcesVariableSizes ()
 
     uint32_t widthMax     = MOS_MAX(m_width, m_widthLastMaxAlloced);
     uint32_t heightMax    = MOS_MAX(m_height, m_heightLastMaxAlloced);
-    uint32_t frameSizeMax = MOS_MAX((m_copyDataBufferInUse ? m_copyDataBufferSize : m_dataSize), m_frameSizeMaxAlloced);
+    uint32_t frameSizeMax = MOS_MAX((m_copyDataBufferInUse ? m_bitstreamChain.GetBufferSize() : m_dataSize), m_frameSizeMaxAlloced);
 
     uint32_t ctbLog2SizeYPic = m_hevcPicParams->log2_diff_max_min_luma_coding_block_size +
                                m_hevcPicParams->log2_min_luma_coding_block_size_minus3 + 3;
@@ -1085,26 +1085,10 @@ MOS_STATUS CodechalDecodeHevcG11::SendSliceLongFormat(
 
     if (! m_hcpInterface->IsHevcISlice(slc->LongSliceFlags.fields.slice_type))
     {
-        MHW_VDBOX_HEVC_REF_IDX_PARAMS refIdxParams;
-        refIdxParams.CurrPic         = m_hevcPicParams->CurrPic;
-        refIdxParams.ucList = 0;
-        refIdxParams.ucNumRefForList = slc->num_ref_idx_l0_active_minus1 + 1;
-        eStatus = MOS_SecureMemcpy(
-            &refIdxParams.RefPicList,
-            sizeof(refIdxParams.RefPicList),
-            &slc->RefPicList,
-            sizeof(slc->RefPicList));
+        // Picture level fields are set up once by SetPictureRefIdxParams
+        MHW_VDBOX_HEVC_REF_IDX_PARAMS &refIdxParams = m_picRefIdxParams;
+        eStatus = CodecHalDecodeHevcSetSliceRefIdxParams(refIdxParams, *slc);
         CODECHAL_DECODE_CHK_STATUS_MESSAGE_RETURN(eStatus, "Failed to copy memory.");
-        refIdxParams.hevcRefList = (void**)m_hevcRefList;
-        refIdxParams.poc_curr_pic  = m_hevcPicParams->CurrPicOrderCntVal;
-        for (uint8_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
-        {
-            refIdxParams.poc_list[i] = m_hevcPicParams->PicOrderCntValList[i];
-        }
-
-        refIdxParams.pRefIdxMapping = hevcSliceState->pRefIdxMapping;
-        refIdxParams.RefFieldPicFlag    = m_hevcPicParams->RefFieldPicFlag;
-        refIdxParams.RefBottomFieldFlag = m_hevcPicParams->RefBottomFieldFlag;
 
         CODECHAL_DECODE_CHK_STATUS_RETURN(m_hcpInterface->AddHcpRefIdxStateCmd(
             cmdBuffer,
@@ -1337,6 +1321,11 @@ MOS_STATUS CodechalDecodeHevcG11::DecodePrimitiveLevel()
         hevcSliceState.pHevcExtPicParam = m_hevcExtPicParams;
         hevcSliceState.pRefIdxMapping   = &m_refIdxMapping[0];
 
+        if (!m_shortFormatInUse)
+        {
+            SetPictureRefIdxParams();
+        }
+
         PCODEC_HEVC_SLICE_PARAMS     slc    = m_hevcSliceParams;
         PCODEC_HEVC_EXT_SLICE_PARAMS slcExt = m_hevcExtSliceParams;
         for (uint32_t slcCount = 0; slcCount < m_numSlices; slcCount++)
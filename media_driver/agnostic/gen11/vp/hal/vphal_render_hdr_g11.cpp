@@ -339,6 +339,7 @@ void Hdr3DLutGenerator::FreeResources()
     MOS_Delete(m_hdrCoefSurface);
     MOS_DeleteArray(m_hdrcoefBuffer);
     MOS_DeleteArray(m_hdr3DLutSysBuffer);
+    m_lutCache.Clear([](uint8_t *lut) { MOS_DeleteArray(lut); });
 }
 
 void Hdr3DLutGenerator::Init3DLutSurface()
@@ -473,20 +474,52 @@ void Hdr3DLutGenerator::Render(const uint32_t maxDLL, const uint32_t maxCLL, con
         m_savedMaxDLL = maxDLL;
         m_savedHdrMode = hdrMode;
 
-        InitCoefSurface(maxDLL, maxCLL, hdrMode);
-        m_hdrCoefSurface->GetCmSurface()->WriteSurface((uint8_t*)m_hdrcoefBuffer, nullptr);
-
-        Hdr3DLutCmRender::Hdr3DLutPayload hdr3DLutPayload = { 0 };
-        hdr3DLutPayload.hdr3DLutSurface = m_hdr3DLutSurface;
-        hdr3DLutPayload.hdrCoefSurface = m_hdrCoefSurface;
-        hdr3DLutPayload.hdr3DLutSurfaceWidth = lutWidth;
-        hdr3DLutPayload.hdr3DLutSurfaceHeight = lutHeight;
+        // 3DLut only depends on maxCLL, maxDLL and hdrMode. Only launch the kernel
+        // for parameters which have not been generated recently.
+        Hdr3DLutKey key           = {maxDLL, maxCLL, hdrMode};
+        uint32_t    generateCount = m_lutCache.GetGenerateCount();
 
         VPHAL_RENDER_CHK_NULL_NO_STATUS(m_cmContext);
-        m_cmContext->ConnectEventListener(m_eventManager);
-        m_hdr3DLutCmRender->Render(&hdr3DLutPayload);
-        m_cmContext->FlushBatchTask(false);
-        m_cmContext->ConnectEventListener(nullptr);
+        uint8_t *p3DLut = m_lutCache.Get(key, [&]() {
+            InitCoefSurface(maxDLL, maxCLL, hdrMode);
+            m_hdrCoefSurface->GetCmSurface()->WriteSurface((uint8_t*)m_hdrcoefBuffer, nullptr);
+
+            Hdr3DLutCmRender::Hdr3DLutPayload hdr3DLutPayload = { 0 };
+            hdr3DLutPayload.hdr3DLutSurface = m_hdr3DLutSurface;
+            hdr3DLutPayload.hdrCoefSurface = m_hdrCoefSurface;
+            hdr3DLutPayload.hdr3DLutSurfaceWidth = lutWidth;
+            hdr3DLutPayload.hdr3DLutSurfaceHeight = lutHeight;
+
+            m_cmContext->ConnectEventListener(m_eventManager);
+            m_hdr3DLutCmRender->Render(&hdr3DLutPayload);
+            m_cmContext->FlushBatchTask(false);
+            m_cmContext->ConnectEventListener(nullptr);
+
+            if (enableDump)
+            {
+                // Dump 3DLut Surface
+                int32_t width = 0, height = 0, depth = 0;
+                m_hdr3DLutSurface->GetSurfaceDimentions(width, height, depth);
+                m_hdr3DLutSurface->DumpSurfaceToFile(OutputDumpDirectory + "3DLutSurface" + std::to_string(width) + "x" + std::to_string(height) + ".dat");
+                // Dump Coefficient Surface(including CCM, Tone Mapping Type etc.)
+                m_hdrCoefSurface->GetSurfaceDimentions(width, height, depth);
+                m_hdrCoefSurface->DumpSurfaceToFile(OutputDumpDirectory + "CoffSurface" + std::to_string(width) + "x" + std::to_string(height) + ".dat");
+            }
+        }, [&](uint8_t *lut) {
+            m_hdr3DLutSurface->GetCmSurface()->ReadSurface(lut, nullptr);
+        }, [&]() {
+            return MOS_NewArray(uint8_t, m_lutSizeInBytes);
+        });
+
+        if (generateCount == m_lutCache.GetGenerateCount())
+        {
+            VPHAL_RENDER_NORMALMESSAGE("Hdr3DLutGenerator reuse cached 3DLut, %d 3DLuts generated in total.", generateCount);
+        }
+        else if (nullptr == p3DLut)
+        {
+            // The generated 3DLut is read straight into the vebox buffer below.
+            VPHAL_RENDER_NORMALMESSAGE("Hdr3DLutGenerator::Render 3DLut Cache Allocate Failed!");
+        }
 
         {
             MOS_LOCK_PARAMS         LockFlags;
@@ -496,8 +529,10 @@ void Hdr3DLutGenerator::Render(const uint32_t maxDLL, const uint32_t maxCLL, con
                 &p3DLutSurface->OsResource,
                 &LockFlags);
             if (pVebox3DLutBuffer)
-            {                
-                m_hdr3DLutSurface->GetCmSurface()->ReadSurface(pVebox3DLutBuffer, nullptr);
+            {
+                m_lutCache.Upload(pVebox3DLutBuffer, p3DLut, [&](uint8_t *lut) {
+                    m_hdr3DLutSurface->GetCmSurface()->ReadSurface(lut, nullptr);
+                });
             }
             else
             {
@@ -507,17 +542,6 @@ void Hdr3DLutGenerator::Render(const uint32_t maxDLL, const uint32_t maxCLL, con
                 pOsInterface,
                 &p3DLutSurface->OsResource);
         }
-
-        if (enableDump)
-        {
-            // Dump 3DLut Surface
-            int32_t width = 0, height = 0, depth = 0;
-            m_hdr3DLutSurface->GetSurfaceDimentions(width, height, depth);
-            m_hdr3DLutSurface->DumpSurfaceToFile(OutputDumpDirectory + "3DLutSurface" + std::to_string(width) + "x" + std::to_string(height) + ".dat");
-            // Dump Coefficient Surface(including CCM, Tone Mapping Type etc.)
-            m_hdrCoefSurface->GetSurfaceDimentions(width, height, depth);
-            m_hdrCoefSurface->DumpSurfaceToFile(OutputDumpDirectory + "CoffSurface" + std::to_string(width) + "x" + std::to_string(height) + ".dat");
-        }
     }
 
     VPHAL_RENDER_NORMALMESSAGE("Hdr3DLutGenerator Render maxCLL %d, maxDLL %d, hdrMode: %d!", maxCLL, maxDLL, hdrMode);
@@ -30,6 +30,7 @@
 #if !EMUL
 #include "vphal_common.h"
 #include "vphal_mdf_wrapper.h"
+#include "vphal_render_hdr_3dlut_cache.h"
 
 //!
 //! \brief    Tone Mapping Source Type, Please don't change the Enmu Value.
@@ -110,6 +111,21 @@ private:
     void InitCoefSurface(const uint32_t maxDLL, const uint32_t maxCLL, const VPHAL_HDR_MODE hdrMode);
     void Init3DLutSurface();
 
+    //!
+    //! \brief    Parameters 3DLut is generated from
+    //!
+    struct Hdr3DLutKey
+    {
+        uint32_t        maxDLL;
+        uint32_t        maxCLL;
+        VPHAL_HDR_MODE  hdrMode;
+
+        bool operator==(const Hdr3DLutKey &key) const
+        {
+            return maxDLL == key.maxDLL && maxCLL == key.maxCLL && hdrMode == key.hdrMode;
+        }
+    };
+
     EventManager                        *m_eventManager        = nullptr;
 
     PRENDERHAL_INTERFACE                m_renderHal            = nullptr;
@@ -130,6 +146,9 @@ private:
     const uint32_t    m_mulSize  = 128;
     const uint32_t    m_lutSizeInBytes = m_segSize * m_segSize * m_mulSize * 4 * 2;
 
+    static const uint32_t               m_lutCacheSize = 4;                          //!< Max number of 3DLuts in m_lutCache
+    VphalHdr3DLutCache<Hdr3DLutKey>     m_lutCache{m_lutSizeInBytes, m_lutCacheSize}; //!< Generated 3DLuts
+
     uint32_t*         m_kernelBinary = nullptr;
     uint32_t          m_kernelSize   = 0;
 };
@@ -55,7 +55,7 @@ MOS_STATUS CodechalDecodeHevcG12::AllocateResourcesVariableSizes ()
 
     uint32_t widthMax     = MOS_MAX(m_width, m_widthLastMaxAlloced);
     uint32_t heightMax    = MOS_MAX(m_height, m_heightLastMaxAlloced);
-    uint32_t frameSizeMax = MOS_MAX((m_copyDataBufferInUse ? m_copyDataBufferSize : m_dataSize), m_frameSizeMaxAlloced);
+    uint32_t frameSizeMax = MOS_MAX((m_copyDataBufferInUse ? m_bitstreamChain.GetBufferSize() : m_dataSize), m_frameSizeMaxAlloced);
 
     uint32_t ctbLog2SizeYPic = m_hevcPicParams->log2_diff_max_min_luma_coding_block_size +
                                m_hevcPicParams->log2_min_luma_coding_block_size_minus3 + 3;
@@ -65,6 +65,13 @@ HevcDecodeSliceLongG12::HevcDecodeSliceLongG12(
     m_refIdxMapping = &m_decoder->m_refIdxMapping[0];
     m_hevcRefList = m_decoder->m_hevcRefList;
 
+    // The object lives for one picture, so the picture level ref idx fields are set here once
+    CodecHalDecodeHevcSetPicRefIdxParams(
+        m_picRefIdxParams,
+        *m_hevcPicParams,
+        (void**)m_hevcRefList,
+        m_refIdxMapping);
+
     m_isRealTile = m_decoder->m_isRealTile;
     m_isSeparateTileDecoding = m_decoder->m_isSeparateTileDecoding;
     m_isSccPaletteMode = CodecHalDecodeIsSCCPLTMode(m_hevcSccPicParams);
@@ -506,29 +513,13 @@ MOS_STATUS HevcDecodeSliceLongG12::SendRefIdxState(
 
     if (!m_hcpInterface->IsHevcISlice(slc->LongSliceFlags.fields.slice_type))
     {
-        MHW_VDBOX_HEVC_REF_IDX_PARAMS_G12 refIdxParams;
+        // Picture level fields are set up once in the constructor
+        MHW_VDBOX_HEVC_REF_IDX_PARAMS_G12 &refIdxParams = m_picRefIdxParams;
  
         FixSliceRefList(slc);
 
-        refIdxParams.CurrPic = m_hevcPicParams->CurrPic;
-        refIdxParams.ucNumRefForList = slc->num_ref_idx_l0_active_minus1 + 1;
-
-        CODECHAL_DECODE_CHK_STATUS_RETURN(MOS_SecureMemcpy(
-            &refIdxParams.RefPicList,
-            sizeof(refIdxParams.RefPicList),
-            &slc->RefPicList,
-            sizeof(slc->RefPicList)));
-
-        refIdxParams.hevcRefList = (void**)m_hevcRefList;
-        refIdxParams.poc_curr_pic = m_hevcPicParams->CurrPicOrderCntVal;
-        for (uint8_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
-        {
-            refIdxParams.poc_list[i] = m_hevcPicParams->PicOrderCntValList[i];
-        }
+        CODECHAL_DECODE_CHK_STATUS_RETURN(CodecHalDecodeHevcSetSliceRefIdxParams(refIdxParams, *slc));
 
-        refIdxParams.pRefIdxMapping = sliceState->pRefIdxMapping;
-        refIdxParams.RefFieldPicFlag = m_hevcPicParams->RefFieldPicFlag;
-        refIdxParams.RefBottomFieldFlag = m_hevcPicParams->RefBottomFieldFlag;
         CODECHAL_DECODE_CHK_STATUS_RETURN(m_hcpInterface->AddHcpRefIdxStateCmd(
             cmdBuf,
             nullptr,
@@ -358,6 +358,7 @@ private:
 
     int8_t             *m_refIdxMapping = nullptr;      //!< Pointer to RefIdx mapping table
     PCODEC_REF_LIST    *m_hevcRefList = nullptr;        //!< Pointer to RefList
+    MHW_VDBOX_HEVC_REF_IDX_PARAMS_G12 m_picRefIdxParams = {}; //!< Picture level ref idx params, list fields are set per slice
 
     bool            m_isRealTile = false;               //!< Flag to indicate if real tile decoding mode in use
     bool            m_isSeparateTileDecoding = false;   //!< Flag to indicate if SCC seperate tile decoding in use
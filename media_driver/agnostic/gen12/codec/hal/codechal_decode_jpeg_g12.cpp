@@ -231,7 +231,7 @@ MOS_STATUS CodechalDecodeJpegG12::DecodeStateLevel()
     MHW_VDBOX_IND_OBJ_BASE_ADDR_PARAMS indObjBaseAddrParams;
     MOS_ZeroMemory(&indObjBaseAddrParams, sizeof(indObjBaseAddrParams));
     indObjBaseAddrParams.Mode = CODECHAL_DECODE_MODE_JPEG;
-    indObjBaseAddrParams.dwDataSize     = m_copiedDataBufferInUse ? m_nextCopiedDataOffset : m_dataSize;
+    indObjBaseAddrParams.dwDataSize     = m_copiedDataBufferInUse ? m_bitstreamChain.GetNextOffset() : m_dataSize;
     indObjBaseAddrParams.presDataBuffer = &m_resDataBuffer;
 
     // Set MFX_JPEG_PIC_STATE_CMD
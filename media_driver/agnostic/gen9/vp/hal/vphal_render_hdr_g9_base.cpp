@@ -36,6 +36,7 @@
 
 #include "hal_oca_interface.h"
 #include "vphal_render_ief.h"
+#include "vphal_render_hdr_table_cache.h"
 
 enum HDR_TMMODE {
     PREPROCESS_TM_S2H,
@@ -905,6 +906,48 @@ finish:
     return eStatus;
 }
 
+//!
+//! \brief    Parameters the monitor gamut CCM depends on
+//!
+typedef struct _VPHAL_HDR_CCM_CACHE_KEY_G9
+{
+    VPHAL_HDR_CCM_TYPE              CCMType;
+    uint16_t                        display_primaries_x[3];
+    uint16_t                        display_primaries_y[3];
+    uint16_t                        white_point_x;
+    uint16_t                        white_point_y;
+
+    bool operator==(const _VPHAL_HDR_CCM_CACHE_KEY_G9 &Key) const
+    {
+        return CCMType                == Key.CCMType                &&
+               display_primaries_x[0] == Key.display_primaries_x[0] &&
+               display_primaries_x[1] == Key.display_primaries_x[1] &&
+               display_primaries_x[2] == Key.display_primaries_x[2] &&
+               display_primaries_y[0] == Key.display_primaries_y[0] &&
+               display_primaries_y[1] == Key.display_primaries_y[1] &&
+               display_primaries_y[2] == Key.display_primaries_y[2] &&
+               white_point_x          == Key.white_point_x          &&
+               white_point_y          == Key.white_point_y;
+    }
+} VPHAL_HDR_CCM_CACHE_KEY_G9;
+
+typedef struct _VPHAL_HDR_CCM_G9
+{
+    float                           Matrix[12];
+} VPHAL_HDR_CCM_G9;
+
+typedef struct _VPHAL_HDR_OETF_LUT_G9
+{
+    uint16_t                        Lut[VPHAL_HDR_OETF_1DLUT_POINT_NUMBER];
+} VPHAL_HDR_OETF_LUT_G9;
+
+#define VPHAL_HDR_CCM_CACHE_SIZE_G9     8
+
+//! Monitor gamut CCMs shared by all HDR instances, which only change with the display.
+static VphalHdrTableCache<VPHAL_HDR_CCM_CACHE_KEY_G9, VPHAL_HDR_CCM_G9, VPHAL_HDR_CCM_CACHE_SIZE_G9> g_HdrCcmCache_g9;
+//! ST2084 OETF LUTs keyed by stretch factor, of which inverse tone mapping only uses one.
+static VphalHdrTableCache<float, VPHAL_HDR_OETF_LUT_G9, 1> g_HdrOetfLutCache_g9;
+
 //!
 //! \brief    Recalculate Sampler Avs 8x8 Horizontal/Vertical scaling table
 //! \details  Recalculate Sampler Avs 8x8 Horizontal/Vertical scaling table
@@ -1394,10 +1437,9 @@ static void RGB2CIEXYZMatrix(
     output[2][2] = m[2][2] * aragab[2];
 }
 
-void VpHal_CalculateCCMWithMonitorGamut(
-    VPHAL_HDR_CCM_TYPE  CCMType,
-    PVPHAL_HDR_PARAMS   pTarget,
-    float TempMatrix[12])
+static void VpHal_HdrCalcCCMWithMonitorGamut_g9(
+    const VPHAL_HDR_CCM_CACHE_KEY_G9 &Key,
+    float                            TempMatrix[12])
 {
     float src_xr = 1.0f, src_yr = 1.0f;
     float src_xg = 1.0f, src_yg = 1.0f;
@@ -1417,9 +1459,7 @@ void VpHal_CalculateCCMWithMonitorGamut(
     Mat3 BT709ToBT2020Matrix = {1.0f};
     Mat3 BT2020ToBT709Matrix = {1.0f};
 
-    VPHAL_PUBLIC_CHK_NULL_NO_STATUS(pTarget);
-
-    if (CCMType == VPHAL_HDR_CCM_BT2020_TO_MONITOR_MATRIX)
+    if (Key.CCMType == VPHAL_HDR_CCM_BT2020_TO_MONITOR_MATRIX)
     {
         src_xr = 0.708f;
         src_yr = 0.292f;
@@ -1430,25 +1470,25 @@ void VpHal_CalculateCCMWithMonitorGamut(
         src_xn = 0.3127f;
         src_yn = 0.3290f;
 
-        dst_xr = pTarget->display_primaries_x[2] / 50000.0f;
-        dst_yr = pTarget->display_primaries_y[2] / 50000.0f;
-        dst_xg = pTarget->display_primaries_x[0] / 50000.0f;
-        dst_yg = pTarget->display_primaries_y[0] / 50000.0f;
-        dst_xb = pTarget->display_primaries_x[1] / 50000.0f;
-        dst_yb = pTarget->display_primaries_y[1] / 50000.0f;
-        dst_xn = pTarget->white_point_x / 50000.0f;
-        dst_yn = pTarget->white_point_y / 50000.0f;
-    }
-    else if (CCMType == VPHAL_HDR_CCM_MONITOR_TO_BT2020_MATRIX)
-    {
-        src_xr = pTarget->display_primaries_x[2] / 50000.0f;
-        src_yr = pTarget->display_primaries_y[2] / 50000.0f;
-        src_xg = pTarget->display_primaries_x[0] / 50000.0f;
-        src_yg = pTarget->display_primaries_y[0] / 50000.0f;
-        src_xb = pTarget->display_primaries_x[1] / 50000.0f;
-        src_yb = pTarget->display_primaries_y[1] / 50000.0f;
-        src_xn = pTarget->white_point_x / 50000.0f;
-        src_yn = pTarget->white_point_y / 50000.0f;
+        dst_xr = Key.display_primaries_x[2] / 50000.0f;
+        dst_yr = Key.display_primaries_y[2] / 50000.0f;
+        dst_xg = Key.display_primaries_x[0] / 50000.0f;
+        dst_yg = Key.display_primaries_y[0] / 50000.0f;
+        dst_xb = Key.display_primaries_x[1] / 50000.0f;
+        dst_yb = Key.display_primaries_y[1] / 50000.0f;
+        dst_xn = Key.white_point_x / 50000.0f;
+        dst_yn = Key.white_point_y / 50000.0f;
+    }
+    else if (Key.CCMType == VPHAL_HDR_CCM_MONITOR_TO_BT2020_MATRIX)
+    {
+        src_xr = Key.display_primaries_x[2] / 50000.0f;
+        src_yr = Key.display_primaries_y[2] / 50000.0f;
+        src_xg = Key.display_primaries_x[0] / 50000.0f;
+        src_yg = Key.display_primaries_y[0] / 50000.0f;
+        src_xb = Key.display_primaries_x[1] / 50000.0f;
+        src_yb = Key.display_primaries_y[1] / 50000.0f;
+        src_xn = Key.white_point_x / 50000.0f;
+        src_yn = Key.white_point_y / 50000.0f;
 
         dst_xr = 0.708f;
         dst_yr = 0.292f;
@@ -1462,14 +1502,14 @@ void VpHal_CalculateCCMWithMonitorGamut(
     else
     {
         // VPHAL_HDR_CCM_MONITOR_TO_BT2020_MATRIX
-        src_xr = pTarget->display_primaries_x[2] / 50000.0f;
-        src_yr = pTarget->display_primaries_y[2] / 50000.0f;
-        src_xg = pTarget->display_primaries_x[0] / 50000.0f;
-        src_yg = pTarget->display_primaries_y[0] / 50000.0f;
-        src_xb = pTarget->display_primaries_x[1] / 50000.0f;
-        src_yb = pTarget->display_primaries_y[1] / 50000.0f;
-        src_xn = pTarget->white_point_x / 50000.0f;
-        src_yn = pTarget->white_point_y / 50000.0f;
+        src_xr = Key.display_primaries_x[2] / 50000.0f;
+        src_yr = Key.display_primaries_y[2] / 50000.0f;
+        src_xg = Key.display_primaries_x[0] / 50000.0f;
+        src_yg = Key.display_primaries_y[0] / 50000.0f;
+        src_xb = Key.display_primaries_x[1] / 50000.0f;
+        src_yb = Key.display_primaries_y[1] / 50000.0f;
+        src_xn = Key.white_point_x / 50000.0f;
+        src_yn = Key.white_point_y / 50000.0f;
 
         dst_xr = 0.64f;
         dst_yr = 0.33f;
@@ -1510,6 +1550,32 @@ void VpHal_CalculateCCMWithMonitorGamut(
     TempMatrix[9]  = SrcToDstMatrix[2][1];
     TempMatrix[10] = SrcToDstMatrix[2][2];
     TempMatrix[11] = 0.0f;
+}
+
+void VpHal_CalculateCCMWithMonitorGamut(
+    VPHAL_HDR_CCM_TYPE  CCMType,
+    PVPHAL_HDR_PARAMS   pTarget,
+    float TempMatrix[12])
+{
+    VPHAL_HDR_CCM_CACHE_KEY_G9 CacheKey;
+    VPHAL_HDR_CCM_G9           Ccm;
+
+    VPHAL_PUBLIC_CHK_NULL_NO_STATUS(pTarget);
+
+    // The matrix only depends on the CCM type and the monitor gamut, reuse it if already calculated
+    MOS_ZeroMemory(&CacheKey, sizeof(CacheKey));
+    CacheKey.CCMType = CCMType;
+    MOS_SecureMemcpy(CacheKey.display_primaries_x, sizeof(CacheKey.display_primaries_x),
+        pTarget->display_primaries_x, sizeof(pTarget->display_primaries_x));
+    MOS_SecureMemcpy(CacheKey.display_primaries_y, sizeof(CacheKey.display_primaries_y),
+        pTarget->display_primaries_y, sizeof(pTarget->display_primaries_y));
+    CacheKey.white_point_x = pTarget->white_point_x;
+    CacheKey.white_point_y = pTarget->white_point_y;
+
+    g_HdrCcmCache_g9.Get(CacheKey, Ccm, [](const VPHAL_HDR_CCM_CACHE_KEY_G9 &Key, VPHAL_HDR_CCM_G9 &Table) {
+        VpHal_HdrCalcCCMWithMonitorGamut_g9(Key, Table.Matrix);
+    });
+    MOS_SecureMemcpy(TempMatrix, sizeof(Ccm.Matrix), Ccm.Matrix, sizeof(Ccm.Matrix));
 
 finish:
     return;
@@ -3368,8 +3434,13 @@ MOS_STATUS VpHal_HdrInitOETF1DLUT_g9(
     {
         if (pHdrState->HdrMode[iIndex] == VPHAL_HDR_MODE_INVERSE_TONE_MAPPING)
         {
-            const float fStretchFactor = 0.01f;
-            VpHal_Generate2SegmentsOETFLUT(fStretchFactor, OETF2084, pHdrState->OetfSmpteSt2084);
+            const float           fStretchFactor = 0.01f;
+            VPHAL_HDR_OETF_LUT_G9 OetfLut;
+            g_HdrOetfLutCache_g9.Get(fStretchFactor, OetfLut, [](float fStretch, VPHAL_HDR_OETF_LUT_G9 &Table) {
+                VpHal_Generate2SegmentsOETFLUT(fStretch, OETF2084, Table.Lut);
+            });
+            MOS_SecureMemcpy(pHdrState->OetfSmpteSt2084, sizeof(pHdrState->OetfSmpteSt2084),
+                OetfLut.Lut, sizeof(OetfLut.Lut));
             pSrcOetfLut = pHdrState->OetfSmpteSt2084;
         }
         else // pHdrState->HdrMode[iIndex] == VPHAL_HDR_MODE_H2H
@@ -0,0 +1,159 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "codechal_decode_bitstream_chain.h"
+#include <random>
+#include <vector>
+#include <cstring>
+
+class CodechalDecodeBitstreamChainTest : public testing::Test
+{
+protected:
+    static const uint32_t ALIGNMENT = CodechalDecodeBitstreamChain::m_chunkAlignment;
+
+    //!
+    //! \brief  Split size bytes into random chunks; with alignedChunks, all but the
+    //!         last chunk are cache line multiples as JPEG requires
+    //!
+    std::vector<uint32_t> RandomSplit(uint32_t size, bool alignedChunks)
+    {
+        std::vector<uint32_t> chunks;
+        while (size > 0)
+        {
+            uint32_t maxChunk = size < 4096 ? size : 4096;
+            uint32_t chunk    = std::uniform_int_distribution<uint32_t>(1, maxChunk)(m_rand);
+            if (alignedChunks && chunk < size)
+            {
+                chunk = MOS_ALIGN_FLOOR(chunk, ALIGNMENT);
+                chunk = chunk ? chunk : ALIGNMENT;
+                chunk = chunk < size ? chunk : size;
+            }
+            chunks.push_back(chunk);
+            size -= chunk;
+        }
+        return chunks;
+    }
+
+    std::mt19937 m_rand{0x6d656469};
+};
+
+TEST_F(CodechalDecodeBitstreamChainTest, RandomSplitReassemblesBitstream)
+{
+    for (uint32_t iteration = 0; iteration < 1000; iteration++)
+    {
+        uint32_t             size = std::uniform_int_distribution<uint32_t>(1, 16 * 1024)(m_rand);
+        std::vector<uint8_t> bitstream(size);
+        for (auto &byte : bitstream)
+        {
+            byte = (uint8_t)m_rand();
+        }
+
+        std::vector<uint8_t> copyBuffer(MOS_ALIGN_CEIL(size, ALIGNMENT), 0);
+        CodechalDecodeBitstreamChain chain;
+        chain.Reset();
+        chain.SetBufferSize((uint32_t)copyBuffer.size());
+        chain.SetExpectedSize(size);
+
+        std::vector<uint32_t> chunks   = RandomSplit(size, true);
+        uint32_t              consumed = 0;
+        for (size_t i = 0; i < chunks.size(); i++)
+        {
+            bool last = (i == chunks.size() - 1);
+            ASSERT_FALSE(chain.IsComplete());
+            ASSERT_TRUE(chain.Fits(chunks[i]));
+            ASSERT_EQ(last, chain.CompletesWith(chunks[i]));
+
+            uint32_t offset = chain.GetNextOffset();
+            ASSERT_EQ(0u, offset % ALIGNMENT);
+            ASSERT_EQ(offset, chain.Append(chunks[i]));
+            memcpy(&copyBuffer[offset], &bitstream[consumed], chunks[i]);
+            consumed += chunks[i];
+        }
+
+        EXPECT_TRUE(chain.IsComplete());
+        EXPECT_EQ(MOS_ALIGN_CEIL(size, ALIGNMENT), chain.GetNextOffset());
+        EXPECT_EQ(0, memcmp(copyBuffer.data(), bitstream.data(), size));
+    }
+}
+
+TEST_F(CodechalDecodeBitstreamChainTest, RandomSplitMatchesPaddedOffsets)
+{
+    // HEVC chunks are arbitrary sized, each one is copied to the next cache line
+    for (uint32_t iteration = 0; iteration < 2000; iteration++)
+    {
+        uint32_t size         = std::uniform_int_distribution<uint32_t>(1, 64 * 1024)(m_rand);
+        uint32_t expectedSize = MOS_ALIGN_CEIL(size, ALIGNMENT);
+        std::vector<uint32_t> chunks = RandomSplit(size, false);
+
+        CodechalDecodeBitstreamChain chain;
+        chain.SetBufferSize(expectedSize + (uint32_t)chunks.size() * ALIGNMENT);
+        chain.SetExpectedSize(expectedSize);
+
+        uint32_t refOffset   = 0;
+        uint32_t prevEnd     = 0;
+        bool     refComplete = false;
+        for (auto chunk : chunks)
+        {
+            ASSERT_EQ(refOffset + chunk <= chain.GetBufferSize(), chain.Fits(chunk));
+            uint32_t offset = chain.Append(chunk);
+            ASSERT_EQ(refOffset, offset);
+            ASSERT_GE(offset, prevEnd);
+            prevEnd = offset + chunk;
+
+            refOffset += MOS_ALIGN_CEIL(chunk, ALIGNMENT);
+            refComplete = refOffset >= expectedSize;
+            ASSERT_EQ(refComplete, chain.IsComplete());
+            ASSERT_EQ(refOffset, chain.GetNextOffset());
+        }
+        EXPECT_TRUE(refComplete);
+    }
+}
+
+TEST_F(CodechalDecodeBitstreamChainTest, RejectsChunksBeyondBuffer)
+{
+    CodechalDecodeBitstreamChain chain;
+    chain.SetBufferSize(256);
+    chain.SetExpectedSize(256);
+
+    EXPECT_TRUE(chain.Fits(256));
+    EXPECT_FALSE(chain.Fits(257));
+    chain.Append(100);
+    EXPECT_EQ(128u, chain.GetNextOffset());
+    EXPECT_TRUE(chain.Fits(128));
+    EXPECT_FALSE(chain.Fits(129));
+    EXPECT_FALSE(chain.Fits(0xffffffff));
+}
+
+TEST_F(CodechalDecodeBitstreamChainTest, ResetKeepsBufferSize)
+{
+    CodechalDecodeBitstreamChain chain;
+    chain.SetBufferSize(4096);
+    chain.SetExpectedSize(1000);
+    chain.Append(1000);
+    EXPECT_TRUE(chain.IsComplete());
+
+    chain.Reset();
+    EXPECT_EQ(0u, chain.GetNextOffset());
+    EXPECT_EQ(0u, chain.GetExpectedSize());
+    EXPECT_EQ(4096u, chain.GetBufferSize());
+}
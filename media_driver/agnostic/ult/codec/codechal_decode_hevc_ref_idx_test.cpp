@@ -0,0 +1,270 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "codechal_decode_hevc_ref_idx.h"
+#include <chrono>
+#include <random>
+#include <vector>
+
+// Same fields and defaults as MHW_VDBOX_HEVC_REF_IDX_PARAMS in mhw_vdbox_hcp_interface.h,
+// which needs the MHW headers
+struct HevcRefIdxParams
+{
+    CODEC_PICTURE   CurrPic = {};
+    bool            isEncode = false;
+    uint8_t         ucList = 0;
+    uint8_t         ucNumRefForList = 0;
+    CODEC_PICTURE   RefPicList[2][CODEC_MAX_NUM_REF_FRAME_HEVC] = {};
+    void            **hevcRefList = nullptr;
+    int32_t         poc_curr_pic = 0;
+    int32_t         poc_list[CODEC_MAX_NUM_REF_FRAME_HEVC] = {};
+    int8_t          *pRefIdxMapping = 0;
+    uint16_t        RefFieldPicFlag = 0;
+    uint16_t        RefBottomFieldFlag = 0;
+    bool            bDummyReference = false;
+};
+
+enum
+{
+    SliceB = 0,
+    SliceP = 1,
+    SliceI = 2
+};
+
+static bool operator==(const CODEC_PICTURE &a, const CODEC_PICTURE &b)
+{
+    return a.FrameIdx == b.FrameIdx && a.PicFlags == b.PicFlags && a.PicEntry == b.PicEntry;
+}
+
+// Every field AddHcpRefIdxStateCmd reads
+static void ExpectSameParams(const HevcRefIdxParams &expected, const HevcRefIdxParams &actual, uint32_t cmd)
+{
+    EXPECT_TRUE(expected.CurrPic == actual.CurrPic) << "cmd " << cmd;
+    EXPECT_EQ(expected.isEncode, actual.isEncode) << "cmd " << cmd;
+    EXPECT_EQ(expected.ucList, actual.ucList) << "cmd " << cmd;
+    EXPECT_EQ(expected.ucNumRefForList, actual.ucNumRefForList) << "cmd " << cmd;
+    for (uint32_t list = 0; list < 2; list++)
+    {
+        for (uint32_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+        {
+            EXPECT_TRUE(expected.RefPicList[list][i] == actual.RefPicList[list][i]) << "cmd " << cmd;
+        }
+    }
+    EXPECT_EQ(expected.hevcRefList, actual.hevcRefList) << "cmd " << cmd;
+    EXPECT_EQ(expected.poc_curr_pic, actual.poc_curr_pic) << "cmd " << cmd;
+    for (uint32_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+    {
+        EXPECT_EQ(expected.poc_list[i], actual.poc_list[i]) << "cmd " << cmd;
+    }
+    EXPECT_EQ(expected.pRefIdxMapping, actual.pRefIdxMapping) << "cmd " << cmd;
+    EXPECT_EQ(expected.RefFieldPicFlag, actual.RefFieldPicFlag) << "cmd " << cmd;
+    EXPECT_EQ(expected.RefBottomFieldFlag, actual.RefBottomFieldFlag) << "cmd " << cmd;
+    EXPECT_EQ(expected.bDummyReference, actual.bDummyReference) << "cmd " << cmd;
+}
+
+class CodechalDecodeHevcRefIdxTest : public testing::Test
+{
+protected:
+    static CODEC_PICTURE RandomPicture(std::mt19937 &rand)
+    {
+        CODEC_PICTURE pic = {};
+        pic.FrameIdx = (uint8_t)(rand() % 127);
+        pic.PicFlags = (CODEC_PICTURE_FLAG)(1 << (rand() % 4));
+        pic.PicEntry = (uint8_t)rand();
+        return pic;
+    }
+
+    void RandomPicture(uint32_t numSlices)
+    {
+        m_picParams = {};
+        m_picParams.CurrPic            = RandomPicture(m_rand);
+        m_picParams.CurrPicOrderCntVal = (int32_t)m_rand();
+        for (uint32_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+        {
+            m_picParams.PicOrderCntValList[i] = (int32_t)m_rand();
+            m_refIdxMapping[i]                = (int8_t)(m_rand() % 16 - 1);
+        }
+        m_picParams.RefFieldPicFlag    = (uint16_t)m_rand();
+        m_picParams.RefBottomFieldFlag = (uint16_t)m_rand();
+
+        m_slices.assign(numSlices, CODEC_HEVC_SLICE_PARAMS());
+        for (auto &slc : m_slices)
+        {
+            slc = {};
+            slc.LongSliceFlags.fields.slice_type = m_rand() % 3;
+            slc.num_ref_idx_l0_active_minus1     = (uint8_t)(m_rand() % CODEC_MAX_NUM_REF_FRAME_HEVC);
+            slc.num_ref_idx_l1_active_minus1     = (uint8_t)(m_rand() % CODEC_MAX_NUM_REF_FRAME_HEVC);
+            for (uint32_t list = 0; list < 2; list++)
+            {
+                for (uint32_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+                {
+                    slc.RefPicList[list][i] = RandomPicture(m_rand);
+                }
+            }
+        }
+    }
+
+    // Ref idx state sequence of SendSliceLongFormat before the change: the params
+    // were built from scratch for every P/B slice
+    void EmitPerSlice(std::vector<HevcRefIdxParams> &cmds)
+    {
+        for (auto &slc : m_slices)
+        {
+            if (slc.LongSliceFlags.fields.slice_type == SliceI)
+            {
+                continue;
+            }
+            HevcRefIdxParams refIdxParams;
+            refIdxParams.CurrPic         = m_picParams.CurrPic;
+            refIdxParams.ucList          = 0;
+            refIdxParams.ucNumRefForList = slc.num_ref_idx_l0_active_minus1 + 1;
+            MOS_SecureMemcpy(&refIdxParams.RefPicList, sizeof(refIdxParams.RefPicList), &slc.RefPicList, sizeof(slc.RefPicList));
+            refIdxParams.hevcRefList  = m_hevcRefList;
+            refIdxParams.poc_curr_pic = m_picParams.CurrPicOrderCntVal;
+            for (uint8_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+            {
+                refIdxParams.poc_list[i] = m_picParams.PicOrderCntValList[i];
+            }
+            refIdxParams.pRefIdxMapping     = m_refIdxMapping;
+            refIdxParams.RefFieldPicFlag    = m_picParams.RefFieldPicFlag;
+            refIdxParams.RefBottomFieldFlag = m_picParams.RefBottomFieldFlag;
+            cmds.push_back(refIdxParams);
+
+            if (slc.LongSliceFlags.fields.slice_type == SliceB)
+            {
+                refIdxParams.ucList          = 1;
+                refIdxParams.ucNumRefForList = slc.num_ref_idx_l1_active_minus1 + 1;
+                cmds.push_back(refIdxParams);
+            }
+        }
+    }
+
+    // Same sequence with the picture level fields filled once
+    void EmitPerPicture(HevcRefIdxParams &picRefIdxParams, std::vector<HevcRefIdxParams> &cmds)
+    {
+        CodecHalDecodeHevcSetPicRefIdxParams(picRefIdxParams, m_picParams, m_hevcRefList, m_refIdxMapping);
+        for (auto &slc : m_slices)
+        {
+            if (slc.LongSliceFlags.fields.slice_type == SliceI)
+            {
+                continue;
+            }
+            HevcRefIdxParams &refIdxParams = picRefIdxParams;
+            ASSERT_EQ(MOS_STATUS_SUCCESS, CodecHalDecodeHevcSetSliceRefIdxParams(refIdxParams, slc));
+            cmds.push_back(refIdxParams);
+
+            if (slc.LongSliceFlags.fields.slice_type == SliceB)
+            {
+                refIdxParams.ucList          = 1;
+                refIdxParams.ucNumRefForList = slc.num_ref_idx_l1_active_minus1 + 1;
+                cmds.push_back(refIdxParams);
+            }
+        }
+    }
+
+    std::mt19937                          m_rand{47};
+    CODEC_HEVC_PIC_PARAMS                 m_picParams = {};
+    std::vector<CODEC_HEVC_SLICE_PARAMS>  m_slices;
+    int8_t                                m_refIdxMapping[CODEC_MAX_NUM_REF_FRAME_HEVC] = {};
+    void                                  *m_refListStorage[1] = {};
+    void                                  **m_hevcRefList = m_refListStorage;
+};
+
+TEST_F(CodechalDecodeHevcRefIdxTest, SameCommandsAsPerSliceBuild)
+{
+    // The decoder keeps the params across pictures, so pictures are decoded back to back
+    HevcRefIdxParams picRefIdxParams;
+    for (uint32_t picture = 0; picture < 200; picture++)
+    {
+        RandomPicture(1 + m_rand() % 40);
+
+        std::vector<HevcRefIdxParams> expected, actual;
+        EmitPerSlice(expected);
+        EmitPerPicture(picRefIdxParams, actual);
+
+        ASSERT_EQ(expected.size(), actual.size());
+        for (uint32_t i = 0; i < expected.size(); i++)
+        {
+            ExpectSameParams(expected[i], actual[i], i);
+        }
+        if (HasFailure())
+        {
+            FAIL() << "picture " << picture;
+        }
+    }
+}
+
+TEST_F(CodechalDecodeHevcRefIdxTest, PSliceAfterBSliceUsesList0)
+{
+    RandomPicture(2);
+    m_slices[0].LongSliceFlags.fields.slice_type = SliceB;
+    m_slices[1].LongSliceFlags.fields.slice_type = SliceP;
+
+    HevcRefIdxParams picRefIdxParams;
+    std::vector<HevcRefIdxParams> cmds;
+    EmitPerPicture(picRefIdxParams, cmds);
+
+    ASSERT_EQ(3u, cmds.size());
+    EXPECT_EQ(1, cmds[1].ucList);
+    EXPECT_EQ(0, cmds[2].ucList);
+    EXPECT_EQ(m_slices[1].num_ref_idx_l0_active_minus1 + 1, cmds[2].ucNumRefForList);
+}
+
+// Throughput of the ref idx parameter setup of a 1000-slice P/B picture
+TEST_F(CodechalDecodeHevcRefIdxTest, ThousandSliceThroughput)
+{
+    RandomPicture(1000);
+    for (auto &slc : m_slices)
+    {
+        slc.LongSliceFlags.fields.slice_type = (m_rand() & 1) ? SliceP : SliceB;
+    }
+
+    const uint32_t pictures = 200;
+    std::vector<HevcRefIdxParams> cmds;
+    cmds.reserve(2000);
+    HevcRefIdxParams picRefIdxParams;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t picture = 0; picture < pictures; picture++)
+    {
+        cmds.clear();
+        EmitPerSlice(cmds);
+    }
+    auto perSlice = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t picture = 0; picture < pictures; picture++)
+    {
+        cmds.clear();
+        EmitPerPicture(picRefIdxParams, cmds);
+    }
+    auto perPicture = std::chrono::steady_clock::now() - start;
+    EXPECT_FALSE(cmds.empty());
+
+    using ns = std::chrono::nanoseconds;
+    std::cout << "[ HEVC     ] ref idx params, 1000 slices x " << pictures << " pictures: per slice "
+              << (double)std::chrono::duration_cast<ns>(perSlice).count() / (pictures * 1000)
+              << " ns/slice, per picture "
+              << (double)std::chrono::duration_cast<ns>(perPicture).count() / (pictures * 1000)
+              << " ns/slice" << std::endl;
+}
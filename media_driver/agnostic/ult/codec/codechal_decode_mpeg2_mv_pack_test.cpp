@@ -0,0 +1,157 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "codechal_decode_mpeg2_mv_pack.h"
+#include <random>
+
+// Values of CodechalDecodeMotionType and CodechalDecodeMvPacking in codechal_decoder.h
+enum
+{
+    McField = 1,
+    McFrame = 2,
+    Mc16x8  = 2,
+    McDmv   = 3
+};
+
+enum
+{
+    FirstForwHorz = 0,
+    FirstForwVert = 1,
+    FirstBackHorz = 2,
+    FirstBackVert = 3,
+    SecndForwHorz = 4,
+    SecndForwVert = 5,
+    SecndBackHorz = 6,
+    SecndBackVert = 7
+};
+
+//!
+//! \brief  Switch based packing CodechalDecodeMpeg2::PackMotionVectors used before the tables
+//!
+static void PackMotionVectorsBySwitch(bool framePicture, uint32_t motionType, const int16_t *mv, int16_t *packedMVs0, int16_t *packedMVs1)
+{
+    uint16_t intelMotionType = CODECHAL_MPEG2_IMT_NONE;
+
+    if (framePicture)
+    {
+        switch (motionType)
+        {
+        case McFrame: intelMotionType = CODECHAL_MPEG2_IMT_FRAME_FRAME; break;
+        case McField: intelMotionType = CODECHAL_MPEG2_IMT_FRAME_FIELD; break;
+        case McDmv:   intelMotionType = CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME; break;
+        default: break;
+        }
+    }
+    else
+    {
+        switch (motionType)
+        {
+        case McField: intelMotionType = CODECHAL_MPEG2_IMT_FIELD_FIELD; break;
+        case McDmv:   intelMotionType = CODECHAL_MPEG2_IMT_FIELD_DUAL_PRIME; break;
+        case Mc16x8:  intelMotionType = CODECHAL_MPEG2_IMT_16X8; break;
+        default: break;
+        }
+    }
+
+    switch (intelMotionType)
+    {
+    case CODECHAL_MPEG2_IMT_16X8:
+    case CODECHAL_MPEG2_IMT_FIELD_FIELD:
+    case CODECHAL_MPEG2_IMT_FRAME_FRAME:
+    case CODECHAL_MPEG2_IMT_FIELD_DUAL_PRIME:
+        packedMVs0[0] = (short)mv[FirstForwHorz];
+        packedMVs0[1] = (short)mv[FirstForwVert];
+        packedMVs0[2] = (short)mv[FirstBackHorz];
+        packedMVs0[3] = (short)mv[FirstBackVert];
+        break;
+    case CODECHAL_MPEG2_IMT_FRAME_FIELD:
+    case CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME:
+        packedMVs0[0] = (short)mv[FirstForwHorz];
+        packedMVs0[1] = (short)(mv[FirstForwVert] >> 1);
+        packedMVs0[2] = (short)mv[FirstBackHorz];
+        packedMVs0[3] = (short)(mv[FirstBackVert] >> 1);
+        break;
+    default:
+        break;
+    }
+
+    switch (intelMotionType)
+    {
+    case CODECHAL_MPEG2_IMT_16X8:
+        packedMVs1[0] = (short)mv[SecndForwHorz];
+        packedMVs1[1] = (short)mv[SecndForwVert];
+        packedMVs1[2] = (short)mv[SecndBackHorz];
+        packedMVs1[3] = (short)mv[SecndBackVert];
+        break;
+    case CODECHAL_MPEG2_IMT_FRAME_DUAL_PRIME:
+        packedMVs1[0] = (short)mv[FirstForwHorz];
+        packedMVs1[1] = (short)(mv[FirstForwVert] >> 1);
+        packedMVs1[2] = (short)mv[SecndBackHorz];
+        packedMVs1[3] = (short)(mv[SecndBackVert] >> 1);
+        break;
+    case CODECHAL_MPEG2_IMT_FRAME_FIELD:
+        packedMVs1[0] = (short)mv[SecndForwHorz];
+        packedMVs1[1] = (short)(mv[SecndForwVert] >> 1);
+        packedMVs1[2] = (short)mv[SecndBackHorz];
+        packedMVs1[3] = (short)(mv[SecndBackVert] >> 1);
+        break;
+    default:
+        break;
+    }
+}
+
+TEST(CodechalDecodeMpeg2MvPackTest, TablesMatchSwitchPacking)
+{
+    std::mt19937 rand(0x6d7632);
+
+    for (uint32_t iteration = 0; iteration < 20000; iteration++)
+    {
+        int16_t mv[8];
+        for (auto &component : mv)
+        {
+            // Full range including odd negative vertical components
+            component = (int16_t)rand();
+        }
+
+        for (int32_t framePicture = 0; framePicture <= 1; framePicture++)
+        {
+            for (uint32_t motionType = 0; motionType < 4; motionType++)
+            {
+                // Sets which are not used keep their previous content
+                int16_t referenceMVs0[4] = {-1, -2, -3, -4};
+                int16_t referenceMVs1[4] = {-5, -6, -7, -8};
+                int16_t packedMVs0[4]    = {-1, -2, -3, -4};
+                int16_t packedMVs1[4]    = {-5, -6, -7, -8};
+
+                PackMotionVectorsBySwitch(framePicture != 0, motionType, mv, referenceMVs0, referenceMVs1);
+                CodechalDecodeMpeg2PackMotionVectors(framePicture != 0, motionType, mv, packedMVs0, packedMVs1);
+
+                for (uint32_t i = 0; i < 4; i++)
+                {
+                    ASSERT_EQ(referenceMVs0[i], packedMVs0[i]) << "frame " << framePicture << " motion type " << motionType;
+                    ASSERT_EQ(referenceMVs1[i], packedMVs1[i]) << "frame " << framePicture << " motion type " << motionType;
+                }
+            }
+        }
+    }
+}
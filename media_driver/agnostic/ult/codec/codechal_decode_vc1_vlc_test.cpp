@@ -0,0 +1,177 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "codechal_decode_vc1_vlc.h"
+#include <random>
+#include <vector>
+
+//!
+//! \brief  Bit reader over 32-bit cache words following CodechalDecodeVc1::GetBits
+//!
+class Vc1TestBitReader
+{
+public:
+    Vc1TestBitReader(const std::vector<uint32_t> &words) : m_words(words) {}
+
+    uint32_t GetBits(uint32_t bitsRead)
+    {
+        uint32_t value       = 0;
+        int32_t  shiftOffset = m_bitOffset - (int32_t)bitsRead;
+        if (shiftOffset >= 0)
+        {
+            value = m_words[m_index] >> shiftOffset;
+        }
+        else
+        {
+            shiftOffset += 32;
+            value = (m_words[m_index] << (32 - shiftOffset)) + (m_words[m_index + 1] >> shiftOffset);
+            m_index++;
+        }
+        m_bitOffset = shiftOffset;
+        m_processed += bitsRead;
+        return value & ((1u << bitsRead) - 1);
+    }
+
+    uint32_t Word() const { return m_words[m_index]; }
+    int32_t  BitOffset() const { return m_bitOffset; }
+    uint32_t Processed() const { return m_processed; }
+
+private:
+    const std::vector<uint32_t> &m_words;
+    uint32_t                    m_index     = 0;
+    int32_t                     m_bitOffset = 32;
+    uint32_t                    m_processed = 0;
+};
+
+//!
+//! \brief  CodechalDecodeVc1::GetVLC table walk over a max bits wide input
+//!
+static uint16_t WalkVlcTable(const uint32_t *table, uint32_t value)
+{
+    uint32_t maxCodeLength = table[0];
+    uint32_t index         = 1;
+
+    for (uint32_t codeLength = 1; codeLength <= maxCodeLength; codeLength++)
+    {
+        uint32_t subtableSize = table[index++];
+        while (subtableSize--)
+        {
+            if (table[index++] == (value >> (maxCodeLength - codeLength)))
+            {
+                return (uint16_t)((codeLength << 8) | table[index]);
+            }
+            index++;
+        }
+    }
+
+    return 0;
+}
+
+TEST(CodechalDecodeVc1VlcTest, TileLutMatchesTableWalk)
+{
+    std::vector<uint16_t> lut(1 << CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS, 0);
+    ASSERT_EQ((uint32_t)CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS, CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable[0]);
+    ASSERT_TRUE(CodechalDecodeVc1BuildVlcLut(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, lut.data()));
+
+    for (uint32_t value = 0; value < lut.size(); value++)
+    {
+        EXPECT_EQ(WalkVlcTable(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, value), lut[value]) << "input " << value;
+    }
+}
+
+TEST(CodechalDecodeVc1VlcTest, TileLutCoversAllTiles)
+{
+    std::vector<uint16_t> lut(1 << CODECHAL_DECODE_VC1_TILE_VLC_MAX_BITS, 0);
+    CodechalDecodeVc1BuildVlcLut(CODECHAL_DECODE_VC1_VldCode3x2Or2x3TilesTable, lut.data());
+
+    // Every 6-bit tile pattern is reachable, and code space left unused stays invalid
+    std::vector<bool> decoded(64, false);
+    for (uint16_t entry : lut)
+    {
+        if (entry != 0)
+        {
+            ASSERT_LT(entry & 0xFF, 64);
+            decoded[entry & 0xFF] = true;
+        }
+    }
+    for (uint32_t tile = 0; tile < 64; tile++)
+    {
+        EXPECT_TRUE(decoded[tile]) << "tile " << tile;
+    }
+}
+
+TEST(CodechalDecodeVc1VlcTest, Norm2ScanMatchesBitByBit)
+{
+    std::mt19937 rand(0x56431);
+
+    for (uint32_t iteration = 0; iteration < 2000; iteration++)
+    {
+        // Biased bits give runs of short and long symbols
+        uint32_t                 bias = rand() % 4;
+        std::vector<uint32_t>    words(64);
+        for (auto &word : words)
+        {
+            word = rand();
+            word = (bias == 1) ? (word | rand()) : (bias == 2) ? (word & rand()) : word;
+        }
+
+        Vc1TestBitReader reference(words);
+        Vc1TestBitReader scanned(words);
+        uint32_t         skip  = rand() % 32;
+        uint32_t         count = rand() % 600;
+        if (skip)
+        {
+            reference.GetBits(skip);
+            scanned.GetBits(skip);
+        }
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (reference.GetBits(1) && reference.GetBits(1) == 0)
+            {
+                reference.GetBits(1);
+            }
+        }
+
+        // Same loop as CodechalDecodeVc1::BitplaneNorm2Mode
+        uint32_t symbols = count;
+        while (symbols)
+        {
+            uint32_t used = CodechalDecodeVc1Norm2ScanWord(scanned.Word(), scanned.BitOffset(), symbols);
+            if (used > 0)
+            {
+                scanned.GetBits(used);
+                continue;
+            }
+
+            if (scanned.GetBits(1) && scanned.GetBits(1) == 0)
+            {
+                scanned.GetBits(1);
+            }
+            symbols--;
+        }
+
+        ASSERT_EQ(reference.Processed(), scanned.Processed()) << "iteration " << iteration;
+        ASSERT_EQ(reference.BitOffset(), scanned.BitOffset()) << "iteration " << iteration;
+    }
+}
@@ -0,0 +1,174 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "codechal_decode_vp8_bool_decoder.h"
+#include <random>
+#include <string.h>
+#include <vector>
+
+//!
+//! \brief  VP8 boolean encoder as in libvpx vp8_encode_bool/vp8_stop_encode
+//!
+class Vp8TestBoolEncoder
+{
+public:
+    void Encode(uint32_t bit, int32_t probability)
+    {
+        uint32_t split = 1 + (((m_range - 1) * probability) >> 8);
+        if (bit)
+        {
+            m_lowValue += split;
+            m_range -= split;
+        }
+        else
+        {
+            m_range = split;
+        }
+
+        int32_t shift = Norm[m_range];
+        m_range <<= shift;
+        m_count += shift;
+
+        if (m_count >= 0)
+        {
+            int32_t offset = shift - m_count;
+            if ((m_lowValue << (offset - 1)) & 0x80000000)
+            {
+                // Propagate carry into bytes already written
+                int32_t x = (int32_t)m_data.size() - 1;
+                while (x >= 0 && m_data[x] == 0xff)
+                {
+                    m_data[x--] = 0;
+                }
+                m_data[x]++;
+            }
+            m_data.push_back((uint8_t)(m_lowValue >> (24 - offset)));
+            m_lowValue <<= offset;
+            shift = m_count;
+            m_lowValue &= 0xffffff;
+            m_count -= 8;
+        }
+        m_lowValue <<= shift;
+    }
+
+    void Flush()
+    {
+        for (int32_t i = 0; i < 32; i++)
+        {
+            Encode(0, 128);
+        }
+    }
+
+    const std::vector<uint8_t> &Data() const { return m_data; }
+
+private:
+    std::vector<uint8_t> m_data;
+    uint32_t             m_lowValue = 0;
+    uint32_t             m_range    = 255;
+    int32_t              m_count    = -24;
+};
+
+TEST(Vp8BoolDecoderTest, CoefProbsMatchGenericPath)
+{
+    std::mt19937 rand(0x7638);
+
+    for (uint32_t iteration = 0; iteration < 5000; iteration++)
+    {
+        // Short buffers run out during the update loop and take the end of data refill
+        uint32_t             size = (iteration % 4 == 0) ? rand() % 64 : 64 + rand() % 2048;
+        std::vector<uint8_t> buffer(size + 1);
+        uint32_t             density = rand() % 256;
+        for (auto &byte : buffer)
+        {
+            // Low bytes favor 0 flags, high bytes favor updates
+            byte = (uint8_t)((rand() % 256 + density) / 2);
+        }
+
+        Vp8BoolDecoder reference;
+        Vp8BoolDecoder specialized;
+        ASSERT_EQ(0, reference.Start(buffer.data(), buffer.data() + size));
+        ASSERT_EQ(0, specialized.Start(buffer.data(), buffer.data() + size));
+
+        // Header fields before coefficient updates leave the decoder at any bit
+        uint32_t skip = rand() % 40;
+        for (uint32_t i = 0; i < skip; i++)
+        {
+            int32_t probability = 1 + rand() % 255;
+            ASSERT_EQ(reference.DecodeBool(probability), specialized.DecodeBool(probability));
+        }
+
+        uint8_t referenceProbs[sizeof(CoefUpdateProbs)];
+        uint8_t specializedProbs[sizeof(CoefUpdateProbs)];
+        for (uint32_t i = 0; i < sizeof(CoefUpdateProbs); i++)
+        {
+            referenceProbs[i] = specializedProbs[i] = (uint8_t)rand();
+        }
+
+        const uint8_t *updateProbs = &CoefUpdateProbs[0][0][0][0];
+        for (uint32_t i = 0; i < sizeof(CoefUpdateProbs); i++)
+        {
+            if (reference.DecodeBool(updateProbs[i]))
+            {
+                referenceProbs[i] = (uint8_t)reference.DecodeValue(8);
+            }
+        }
+        specialized.ReadCoefProbs(specializedProbs);
+
+        ASSERT_EQ(0, memcmp(referenceProbs, specializedProbs, sizeof(referenceProbs))) << "iteration " << iteration;
+        ASSERT_EQ(reference.GetValue(), specialized.GetValue()) << "iteration " << iteration;
+        ASSERT_EQ(reference.GetRange(), specialized.GetRange()) << "iteration " << iteration;
+        ASSERT_EQ(reference.GetCount(), specialized.GetCount()) << "iteration " << iteration;
+        ASSERT_EQ(reference.GetBuffer(), specialized.GetBuffer()) << "iteration " << iteration;
+
+        // Following header fields decode the same
+        ASSERT_EQ(reference.DecodeValue(7), specialized.DecodeValue(7));
+    }
+}
+
+TEST(Vp8BoolDecoderTest, RoundTripEncodedBools)
+{
+    std::mt19937 rand(0x7639);
+
+    for (uint32_t iteration = 0; iteration < 200; iteration++)
+    {
+        std::vector<int32_t>  probabilities(1 + rand() % 4000);
+        std::vector<uint32_t> bits(probabilities.size());
+        Vp8TestBoolEncoder    encoder;
+        for (size_t i = 0; i < bits.size(); i++)
+        {
+            probabilities[i] = 1 + rand() % 255;
+            // Draw bits roughly following the probability of 0
+            bits[i] = (uint32_t)(rand() % 256) >= (uint32_t)probabilities[i];
+            encoder.Encode(bits[i], probabilities[i]);
+        }
+        encoder.Flush();
+
+        const std::vector<uint8_t> &data = encoder.Data();
+        Vp8BoolDecoder              decoder;
+        ASSERT_EQ(0, decoder.Start(data.data(), data.data() + data.size()));
+        for (size_t i = 0; i < bits.size(); i++)
+        {
+            ASSERT_EQ(bits[i], decoder.DecodeBool(probabilities[i])) << "iteration " << iteration << " bool " << i;
+        }
+    }
+}
@@ -0,0 +1,131 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "codechal_decode_ytile_copy.h"
+#include <unordered_map>
+#include <random>
+
+//!
+//! \brief  Byte address of (x, y) in a Y-tiled surface, as CodechalDecode::LinearToYTiledAddress
+//!
+static uint32_t YTiledAddress(uint32_t x, uint32_t y, uint32_t pitch)
+{
+    uint32_t tile   = (y / 32) * (pitch / 128) + x / 128;
+    uint32_t column = (x % 128) / 16;
+    return tile * 4096 + column * 512 + (y % 32) * 16 + x % 16;
+}
+
+//!
+//! \brief  Check the spans copy exactly the bytes of the band, each to its own place
+//!
+static void CheckRowSpans(uint32_t srcY, uint32_t srcPitch, uint32_t dstY, uint32_t dstPitch, uint32_t width, uint32_t height)
+{
+    CODECHAL_DECODE_YTILE_ROW_SPANS spans = {};
+    ASSERT_EQ(MOS_STATUS_SUCCESS, CodechalDecodeGetYTiledRowSpans(srcY, srcPitch, dstY, dstPitch, width, height, spans));
+
+    std::unordered_map<uint32_t, uint32_t> copied;
+    copied.reserve(spans.spanSize * spans.spanNum);
+    for (uint32_t i = 0; i < spans.spanNum; i++)
+    {
+        for (uint32_t k = 0; k < spans.spanSize; k++)
+        {
+            ASSERT_TRUE(copied.emplace(
+                spans.srcOffset + i * CODECHAL_DECODE_YTILE_COLUMN + k,
+                spans.dstOffset + i * CODECHAL_DECODE_YTILE_COLUMN + k).second);
+        }
+    }
+
+    uint32_t alignedWidth = (width + 15) / 16 * 16;
+    ASSERT_EQ(alignedWidth * height, copied.size());
+    for (uint32_t y = 0; y < height; y++)
+    {
+        for (uint32_t x = 0; x < alignedWidth; x++)
+        {
+            auto it = copied.find(YTiledAddress(x, srcY + y, srcPitch));
+            ASSERT_NE(copied.end(), it) << "x " << x << " y " << y;
+            ASSERT_EQ(YTiledAddress(x, dstY + y, dstPitch), it->second) << "x " << x << " y " << y;
+        }
+    }
+}
+
+TEST(CodechalDecodeYTileCopyTest, StartOffsetMatchesLinearToYTiled)
+{
+    for (uint32_t pitch = 128; pitch <= 4096; pitch += 128)
+    {
+        for (uint32_t y = 0; y < 4 * 32; y++)
+        {
+            CODECHAL_DECODE_YTILE_ROW_SPANS spans = {};
+            ASSERT_EQ(MOS_STATUS_SUCCESS, CodechalDecodeGetYTiledRowSpans(y, pitch, y, pitch, pitch, 1, spans));
+            EXPECT_EQ(YTiledAddress(0, y, pitch), spans.srcOffset);
+            EXPECT_EQ(YTiledAddress(0, y, pitch), spans.dstOffset);
+        }
+    }
+}
+
+TEST(CodechalDecodeYTileCopyTest, Vc1UvBand)
+{
+    // FormatUnequalFieldPicture copies one 16 row MB row of UV between surfaces of same pitch
+    for (uint32_t pitch = 128; pitch <= 2048; pitch += 128)
+    {
+        for (uint32_t frameHeight = 16; frameHeight <= 128; frameHeight += 16)
+        {
+            CheckRowSpans(frameHeight + 32, pitch, frameHeight, pitch, pitch, 16);
+            CheckRowSpans(frameHeight, pitch, frameHeight + 32, pitch, pitch, 16);
+        }
+    }
+}
+
+TEST(CodechalDecodeYTileCopyTest, RandomBands)
+{
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<uint32_t> pitchDist(1, 16);
+    std::uniform_int_distribution<uint32_t> tileRowDist(0, 7);
+    std::uniform_int_distribution<uint32_t> rowDist(0, 31);
+
+    for (int iter = 0; iter < 500; iter++)
+    {
+        uint32_t srcPitch = pitchDist(rng) * 128;
+        uint32_t dstPitch = pitchDist(rng) * 128;
+        uint32_t yOff     = rowDist(rng);
+        uint32_t height   = (iter % 4 == 0) ? 32 - yOff : 1 + rowDist(rng) % (32 - yOff);
+        uint32_t width    = 1 + rng() % (srcPitch < dstPitch ? srcPitch : dstPitch);
+        if (iter % 8 == 0)
+        {
+            yOff   = 0;
+            height = 32;
+        }
+
+        CheckRowSpans(tileRowDist(rng) * 32 + yOff, srcPitch, tileRowDist(rng) * 32 + yOff, dstPitch, width, height);
+    }
+}
+
+TEST(CodechalDecodeYTileCopyTest, InvalidBands)
+{
+    CODECHAL_DECODE_YTILE_ROW_SPANS spans = {};
+
+    // Not in the same row of tile
+    EXPECT_EQ(MOS_STATUS_INVALID_PARAMETER, CodechalDecodeGetYTiledRowSpans(16, 512, 17, 512, 512, 8, spans));
+    // Crossing tile row
+    EXPECT_EQ(MOS_STATUS_INVALID_PARAMETER, CodechalDecodeGetYTiledRowSpans(24, 512, 56, 512, 512, 9, spans));
+    EXPECT_EQ(MOS_STATUS_SUCCESS, CodechalDecodeGetYTiledRowSpans(24, 512, 56, 512, 512, 8, spans));
+}
@@ -0,0 +1,93 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "codechal_vp9_ctx_image.h"
+#include "codec_def_vp9_probs.h"
+#include <random>
+#include <vector>
+
+//!
+//! \brief  Prefill a context buffer so bytes the init must leave alone are distinguishable
+//!
+static std::vector<uint8_t> RandomCtxBuffer(std::mt19937 &rng)
+{
+    std::uniform_int_distribution<int> byteDist(0, 255);
+    std::vector<uint8_t> buffer(CODEC_VP9_PROB_MAX_NUM_ELEM);
+    for (auto &b : buffer)
+    {
+        b = (uint8_t)byteDist(rng);
+    }
+    return buffer;
+}
+
+TEST(CodechalVp9CtxImageTest, ContextBufferInitMatchesByteWiseBuild)
+{
+    std::mt19937 rng(1);
+
+    for (int iter = 0; iter < 32; iter++)
+    {
+        for (bool setToKey : {false, true})
+        {
+            std::vector<uint8_t> expected = RandomCtxBuffer(rng);
+            std::vector<uint8_t> actual   = expected;
+
+            ASSERT_EQ(MOS_STATUS_SUCCESS, CodecHalVp9BuildContextBuffer(expected.data(), setToKey));
+            ASSERT_EQ(MOS_STATUS_SUCCESS, CodecHalVp9ContextBufferInit(actual.data(), setToKey));
+            EXPECT_EQ(expected, actual) << "setToKey " << setToKey;
+        }
+    }
+}
+
+TEST(CodechalVp9CtxImageTest, CtxBufDiffInitMatchesByteWiseBuild)
+{
+    std::mt19937 rng(2);
+
+    for (int iter = 0; iter < 32; iter++)
+    {
+        for (bool setToKey : {false, true})
+        {
+            std::vector<uint8_t> expected = RandomCtxBuffer(rng);
+            std::vector<uint8_t> actual   = expected;
+
+            ASSERT_EQ(MOS_STATUS_SUCCESS, CodecHalVp9BuildCtxBufDiff(expected.data(), setToKey));
+            ASSERT_EQ(MOS_STATUS_SUCCESS, CodecHalVp9CtxBufDiffInit(actual.data(), setToKey));
+            EXPECT_EQ(expected, actual) << "setToKey " << setToKey;
+        }
+    }
+}
+
+TEST(CodechalVp9CtxImageTest, KeyAndNonKeyImagesDiffer)
+{
+    std::vector<uint8_t> keyCtx(CODEC_VP9_PROB_MAX_NUM_ELEM, 0);
+    std::vector<uint8_t> nonKeyCtx(CODEC_VP9_PROB_MAX_NUM_ELEM, 0);
+
+    ASSERT_EQ(MOS_STATUS_SUCCESS, CodecHalVp9ContextBufferInit(keyCtx.data(), true));
+    ASSERT_EQ(MOS_STATUS_SUCCESS, CodecHalVp9ContextBufferInit(nonKeyCtx.data(), false));
+    EXPECT_NE(keyCtx, nonKeyCtx);
+}
+
+TEST(CodechalVp9CtxImageTest, NullBuffer)
+{
+    EXPECT_EQ(MOS_STATUS_NULL_POINTER, CodecHalVp9ContextBufferInit(nullptr, true));
+    EXPECT_EQ(MOS_STATUS_NULL_POINTER, CodecHalVp9CtxBufDiffInit(nullptr, false));
+}
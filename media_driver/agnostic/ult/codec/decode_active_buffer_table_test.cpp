@@ -0,0 +1,160 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "decode_active_buffer_table.h"
+#include <algorithm>
+#include <map>
+#include <random>
+
+using namespace decode;
+
+struct FakeBuffer
+{
+    uint32_t id;
+};
+
+//!
+//! \brief  Check the table against the std::map RefrenceAssociatedBuffer used before
+//!
+static void ExpectSameAsMap(const ActiveBufferTable<FakeBuffer> &table, const std::map<uint32_t, FakeBuffer *> &reference, uint32_t maxFrameIdx)
+{
+    ASSERT_EQ(reference.size(), table.GetCount());
+
+    uint32_t pos = 0;
+    for (auto &entry : reference)
+    {
+        EXPECT_EQ(entry.first, table.GetFrameIndex(pos++));
+    }
+
+    for (uint32_t frameIdx = 0; frameIdx <= maxFrameIdx; frameIdx++)
+    {
+        auto it = reference.find(frameIdx);
+        EXPECT_EQ(it == reference.end() ? nullptr : it->second, table.Get(frameIdx)) << "frameIdx " << frameIdx;
+    }
+}
+
+TEST(ActiveBufferTableTest, Empty)
+{
+    ActiveBufferTable<FakeBuffer> table;
+
+    EXPECT_EQ(0u, table.GetCount());
+    EXPECT_EQ(nullptr, table.Get(0));
+    EXPECT_EQ(nullptr, table.Get(0xffffffff));
+}
+
+TEST(ActiveBufferTableTest, AscendingOrder)
+{
+    ActiveBufferTable<FakeBuffer> table;
+    FakeBuffer                    buffers[4] = {{0}, {1}, {2}, {3}};
+
+    table.Add(7, &buffers[0]);
+    table.Add(2, &buffers[1]);
+    table.Add(126, &buffers[2]);
+    table.Add(0, &buffers[3]);
+
+    ASSERT_EQ(4u, table.GetCount());
+    EXPECT_EQ(0u, table.GetFrameIndex(0));
+    EXPECT_EQ(2u, table.GetFrameIndex(1));
+    EXPECT_EQ(7u, table.GetFrameIndex(2));
+    EXPECT_EQ(126u, table.GetFrameIndex(3));
+    EXPECT_EQ(&buffers[2], table.Get(126));
+    EXPECT_EQ(nullptr, table.Get(127));
+
+    EXPECT_EQ(&buffers[1], table.RemoveAt(1));
+    EXPECT_EQ(nullptr, table.Get(2));
+    ASSERT_EQ(3u, table.GetCount());
+    EXPECT_EQ(7u, table.GetFrameIndex(1));
+
+    table.Clear();
+    EXPECT_EQ(0u, table.GetCount());
+    EXPECT_EQ(nullptr, table.Get(0));
+}
+
+TEST(ActiveBufferTableTest, MatchesMapOverReferenceShuffles)
+{
+    const uint32_t maxFrameIdx = 127;   // CODECHAL_MAX_DPB_NUM_AV1 - 1
+
+    ActiveBufferTable<FakeBuffer>        table;
+    std::map<uint32_t, FakeBuffer *>     reference;
+    std::vector<FakeBuffer>              buffers(maxFrameIdx + 1);
+    std::mt19937                         rng(1);
+    std::uniform_int_distribution<uint32_t> frameDist(0, maxFrameIdx);
+
+    for (uint32_t i = 0; i <= maxFrameIdx; i++)
+    {
+        buffers[i].id = i;
+    }
+
+    for (int frame = 0; frame < 5000; frame++)
+    {
+        // Reference list of up to 8 frames, as AV1 uses
+        std::vector<uint32_t> refFrameList;
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            refFrameList.push_back(frameDist(rng));
+        }
+        uint32_t curFrameIdx = frameDist(rng);
+
+        // UpdateRefList: retire frames not referenced, in ascending order
+        std::vector<FakeBuffer *> retired;
+        uint32_t pos = 0;
+        while (pos < table.GetCount())
+        {
+            uint32_t frameIdx = table.GetFrameIndex(pos);
+            bool isRef = frameIdx != curFrameIdx &&
+                std::find(refFrameList.begin(), refFrameList.end(), frameIdx) != refFrameList.end();
+            if (isRef)
+            {
+                ++pos;
+                continue;
+            }
+            retired.push_back(table.RemoveAt(pos));
+        }
+
+        std::vector<FakeBuffer *> retiredByMap;
+        for (auto it = reference.begin(); it != reference.end();)
+        {
+            bool isRef = it->first != curFrameIdx &&
+                std::find(refFrameList.begin(), refFrameList.end(), it->first) != refFrameList.end();
+            if (isRef)
+            {
+                ++it;
+                continue;
+            }
+            retiredByMap.push_back(it->second);
+            it = reference.erase(it);
+        }
+        ASSERT_EQ(retiredByMap, retired) << "frame " << frame;
+
+        // ActiveCurBuffer
+        ASSERT_EQ(nullptr, table.Get(curFrameIdx));
+        table.Add(curFrameIdx, &buffers[curFrameIdx]);
+        reference[curFrameIdx] = &buffers[curFrameIdx];
+
+        ExpectSameAsMap(table, reference, maxFrameIdx + 8);
+        if (HasFailure())
+        {
+            FAIL() << "frame " << frame;
+        }
+    }
+}
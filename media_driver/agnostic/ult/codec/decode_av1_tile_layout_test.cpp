@@ -0,0 +1,174 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "decode_av1_tile_layout.h"
+#include <random>
+#include <vector>
+
+using namespace decode;
+
+//!
+//! \brief  Tile layout of one frame dimension as specified by AV1 tile_info()
+//!
+class Av1TileLayoutTest : public testing::Test
+{
+protected:
+    static const int32_t MAX_TILE_WIDTH = 4096;
+    static const int32_t MAX_TILE_COLS  = 64;
+    static const int32_t MAX_FRAME_SIZE = 65536;     // frame_width_minus_1 is 16 bits
+
+    static int32_t TileLog2(int32_t blkSize, int32_t target)
+    {
+        int32_t k;
+        for (k = 0; (blkSize << k) < target; k++)
+        {
+        }
+        return k;
+    }
+
+    //!
+    //! \brief  MiColStarts / MiRowStarts in superblocks for uniform tile spacing
+    //!
+    static std::vector<int32_t> UniformStartSb(int32_t sbNum, int32_t tileLog2)
+    {
+        std::vector<int32_t> starts;
+        int32_t tileSizeSb = (sbNum + (1 << tileLog2) - 1) >> tileLog2;
+        for (int32_t startSb = 0; startSb < sbNum; startSb += tileSizeSb)
+        {
+            starts.push_back(startSb);
+        }
+        return starts;
+    }
+
+    //!
+    //! \brief  Run the driver layout on sizes taken from the reference starts and compare
+    //!
+    static void CheckLayout(int32_t miNum, int32_t mibSizeLog2, const std::vector<int32_t> &refStartSb)
+    {
+        int32_t  sbNum   = (miNum + (1 << mibSizeLog2) - 1) >> mibSizeLog2;
+        uint16_t tileNum = (uint16_t)refStartSb.size();
+        uint16_t sizeInSbsMinus1[MAX_TILE_COLS];
+        uint16_t startSb[MAX_TILE_COLS];
+
+        for (uint16_t i = 0; i < tileNum; i++)
+        {
+            int32_t end        = (i + 1 < tileNum) ? refStartSb[i + 1] : sbNum;
+            sizeInSbsMinus1[i] = (uint16_t)(end - refStartSb[i] - 1);
+        }
+        // Last tile size is derived by the driver, never taken from the app
+        sizeInSbsMinus1[tileNum - 1] = 0xffff;
+
+        Av1TileLayout::CalcTileStartSb(miNum, mibSizeLog2, tileNum, sizeInSbsMinus1, startSb);
+
+        for (uint16_t i = 0; i < tileNum; i++)
+        {
+            ASSERT_EQ(refStartSb[i], startSb[i]) << "miNum " << miNum << " mibSizeLog2 " << mibSizeLog2
+                                                 << " tiles " << tileNum << " tile " << i;
+        }
+        ASSERT_EQ(sbNum, startSb[tileNum - 1] + sizeInSbsMinus1[tileNum - 1] + 1)
+            << "miNum " << miNum << " mibSizeLog2 " << mibSizeLog2 << " tiles " << tileNum;
+    }
+};
+
+TEST_F(Av1TileLayoutTest, UniformSpacingAllFrameSizes)
+{
+    for (int32_t mibSizeLog2 = 4; mibSizeLog2 <= 5; mibSizeLog2++)
+    {
+        int32_t maxTileSizeSb = MAX_TILE_WIDTH >> (mibSizeLog2 + 2);
+
+        // MiCols = 2 * ((frame_width + 7) >> 3) covers every even MI count
+        for (int32_t miNum = 2; miNum <= (MAX_FRAME_SIZE >> 2); miNum += 2)
+        {
+            int32_t sbNum      = (miNum + (1 << mibSizeLog2) - 1) >> mibSizeLog2;
+            int32_t minLog2    = TileLog2(maxTileSizeSb, sbNum);
+            int32_t maxLog2    = TileLog2(1, sbNum < MAX_TILE_COLS ? sbNum : MAX_TILE_COLS);
+
+            // Rows have no lower bound of their own, so start from a single tile
+            for (int32_t tileLog2 = 0; tileLog2 <= maxLog2; tileLog2++)
+            {
+                std::vector<int32_t> refStartSb = UniformStartSb(sbNum, tileLog2);
+                if (tileLog2 >= minLog2)
+                {
+                    ASSERT_LE(refStartSb.size(), (size_t)MAX_TILE_COLS);
+                }
+                CheckLayout(miNum, mibSizeLog2, refStartSb);
+            }
+        }
+    }
+}
+
+TEST_F(Av1TileLayoutTest, ExplicitSpacingRandomSplits)
+{
+    std::mt19937 rand(0x617631);
+
+    for (int32_t mibSizeLog2 = 4; mibSizeLog2 <= 5; mibSizeLog2++)
+    {
+        int32_t maxTileSizeSb = MAX_TILE_WIDTH >> (mibSizeLog2 + 2);
+
+        for (int32_t miNum = 2; miNum <= (MAX_FRAME_SIZE >> 2); miNum += 2)
+        {
+            int32_t sbNum = (miNum + (1 << mibSizeLog2) - 1) >> mibSizeLog2;
+
+            // Only splits with at most MAX_TILE_COLS tiles are legal
+            if (TileLog2(maxTileSizeSb, sbNum) > 6)
+            {
+                continue;
+            }
+
+            for (int32_t iteration = 0; iteration < 4; iteration++)
+            {
+                std::vector<int32_t> refStartSb;
+                for (int32_t startSb = 0; startSb < sbNum;)
+                {
+                    int32_t remaining = sbNum - startSb;
+                    int32_t tilesLeft = MAX_TILE_COLS - (int32_t)refStartSb.size();
+                    // Keep enough room for the remaining superblocks within the tile limit
+                    int32_t minSize   = remaining - maxTileSizeSb * (tilesLeft - 1);
+                    minSize           = minSize > 1 ? minSize : 1;
+                    int32_t maxSize   = remaining < maxTileSizeSb ? remaining : maxTileSizeSb;
+                    int32_t sizeSb    = std::uniform_int_distribution<int32_t>(minSize, maxSize)(rand);
+
+                    refStartSb.push_back(startSb);
+                    startSb += sizeSb;
+                }
+                ASSERT_LE(refStartSb.size(), (size_t)MAX_TILE_COLS);
+                CheckLayout(miNum, mibSizeLog2, refStartSb);
+            }
+        }
+    }
+}
+
+TEST_F(Av1TileLayoutTest, SingleTileTakesWholeFrame)
+{
+    uint16_t sizeInSbsMinus1[1] = {0xffff};
+    uint16_t startSb[1]         = {0xffff};
+
+    // 1920 pixels = 480 MI = 30 64x64 SBs or 15 128x128 SBs
+    Av1TileLayout::CalcTileStartSb(480, 4, 1, sizeInSbsMinus1, startSb);
+    EXPECT_EQ(0, startSb[0]);
+    EXPECT_EQ(29, sizeInSbsMinus1[0]);
+
+    Av1TileLayout::CalcTileStartSb(480, 5, 1, sizeInSbsMinus1, startSb);
+    EXPECT_EQ(0, startSb[0]);
+    EXPECT_EQ(14, sizeInSbsMinus1[0]);
+}
@@ -0,0 +1,256 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "decode_buffer_pool.h"
+#include <set>
+#include <vector>
+
+using namespace decode;
+
+//!
+//! \brief  Buffer and allocator stand-ins following DecodeAllocator::AllocateBuffer/Destroy
+//!
+class BufferPoolTest : public testing::Test
+{
+protected:
+    struct FakeBuffer
+    {
+        uint32_t size;
+        uint32_t usage;
+        uint32_t lastUse;       // Submitted count of the last frame using this buffer
+    };
+
+    typedef BufferPool<FakeBuffer, uint32_t> Pool;
+
+    FakeBuffer *Allocate(uint32_t size, uint32_t usage)
+    {
+        FakeBuffer *buffer = m_usePool ? m_pool.Acquire(size, usage, false, m_completed) : nullptr;
+        if (buffer == nullptr)
+        {
+            buffer          = new FakeBuffer;
+            buffer->usage   = usage;
+            buffer->lastUse = 0;
+            m_allocCount++;
+        }
+        else
+        {
+            // Frames which used the buffer before must be completed
+            EXPECT_GE((int32_t)(m_completed - buffer->lastUse), 0);
+        }
+        buffer->size = size;
+        m_live.insert(buffer);
+        return buffer;
+    }
+
+    void Destroy(FakeBuffer *buffer)
+    {
+        m_live.erase(buffer);
+        if (m_usePool && m_pool.Release(buffer, buffer->size, buffer->usage, false, m_submitted + 1, m_budget))
+        {
+            Trim(m_budget);
+            return;
+        }
+        m_pool.Remove(buffer);
+        FreeBuffer(buffer);
+    }
+
+    void Trim(uint32_t budget)
+    {
+        FakeBuffer *buffer = nullptr;
+        while ((buffer = m_pool.Evict(budget)) != nullptr)
+        {
+            FreeBuffer(buffer);
+        }
+    }
+
+    void FreeBuffer(FakeBuffer *buffer)
+    {
+        delete buffer;
+        m_freeCount++;
+    }
+
+    //!
+    //! \brief  Submit one frame using all live buffers, GPU lags behind by inFlight frames
+    //!
+    void DecodeFrame(uint32_t inFlight)
+    {
+        m_submitted++;
+        for (auto buffer : m_live)
+        {
+            buffer->lastUse = m_submitted;
+        }
+        m_completed = m_submitted > inFlight ? m_submitted - inFlight : 0;
+    }
+
+    void TearDown() override
+    {
+        for (auto buffer : m_live)
+        {
+            FreeBuffer(buffer);
+        }
+        m_live.clear();
+        Trim(0);
+        EXPECT_EQ(0u, m_pool.GetCount());
+        EXPECT_EQ(m_allocCount, m_freeCount);
+    }
+
+    Pool                  m_pool;
+    std::set<FakeBuffer*> m_live;
+    bool                  m_usePool    = true;
+    uint32_t              m_budget     = 32 * 1024 * 1024;
+    uint32_t              m_submitted  = 0;
+    uint32_t              m_completed  = 0;
+    uint32_t              m_allocCount = 0;
+    uint32_t              m_freeCount  = 0;
+};
+
+TEST_F(BufferPoolTest, ReuseKeepsAllocationSize)
+{
+    FakeBuffer *buffer = Allocate(8000, 0);
+    Destroy(buffer);
+    EXPECT_EQ(8000u, m_pool.GetSize());
+
+    DecodeFrame(0);
+    FakeBuffer *smaller = Allocate(5000, 0);
+    EXPECT_EQ(buffer, smaller);
+    EXPECT_EQ(5000u, smaller->size);
+    EXPECT_EQ(0u, m_pool.GetSize());
+
+    // Pool accounts the real allocation, not the size of the last request
+    Destroy(smaller);
+    EXPECT_EQ(8000u, m_pool.GetSize());
+
+    DecodeFrame(0);
+    FakeBuffer *full = Allocate(8000, 0);
+    EXPECT_EQ(buffer, full);
+    EXPECT_EQ(1u, m_allocCount);
+    Destroy(full);
+}
+
+TEST_F(BufferPoolTest, MatchBySizeClassAndUsage)
+{
+    FakeBuffer *buffer = Allocate(6000, 1);
+    Destroy(buffer);
+    DecodeFrame(0);
+
+    // Larger than the allocation, smaller size class, different usage
+    EXPECT_EQ(nullptr, m_pool.Acquire(6001, 1, false, m_completed));
+    EXPECT_EQ(nullptr, m_pool.Acquire(4000, 1, false, m_completed));
+    EXPECT_EQ(nullptr, m_pool.Acquire(6000, 2, false, m_completed));
+    EXPECT_EQ(nullptr, m_pool.Acquire(6000, 1, true, m_completed));
+    EXPECT_EQ(buffer, m_pool.Acquire(4097, 1, false, m_completed));
+    m_live.insert(buffer);
+}
+
+TEST_F(BufferPoolTest, NoReuseBeforeCompletion)
+{
+    FakeBuffer *buffer = Allocate(4096, 0);
+    DecodeFrame(1);
+    Destroy(buffer);
+
+    // Frame in flight and the frame under construction may still use it
+    EXPECT_EQ(nullptr, m_pool.Acquire(4096, 0, false, m_completed));
+    DecodeFrame(1);
+    EXPECT_EQ(nullptr, m_pool.Acquire(4096, 0, false, m_completed));
+    DecodeFrame(1);
+    EXPECT_EQ(buffer, m_pool.Acquire(4096, 0, false, m_completed));
+    m_live.insert(buffer);
+}
+
+TEST_F(BufferPoolTest, BudgetEvictsOldest)
+{
+    m_budget = 10000;
+
+    FakeBuffer *first  = Allocate(4000, 0);
+    FakeBuffer *second = Allocate(4000, 1);
+    FakeBuffer *third  = Allocate(4000, 2);
+    FakeBuffer *huge   = Allocate(20000, 0);
+    Destroy(first);
+    Destroy(second);
+    EXPECT_EQ(8000u, m_pool.GetSize());
+
+    Destroy(third);
+    EXPECT_EQ(8000u, m_pool.GetSize());
+    EXPECT_EQ(1u, m_freeCount);
+
+    // Buffer beyond budget is destroyed right away
+    Destroy(huge);
+    EXPECT_EQ(8000u, m_pool.GetSize());
+    EXPECT_EQ(2u, m_freeCount);
+
+    DecodeFrame(0);
+    EXPECT_EQ(nullptr, m_pool.Acquire(4000, 0, false, m_completed));
+    EXPECT_EQ(third, m_pool.Acquire(4000, 2, false, m_completed));
+    m_live.insert(third);
+}
+
+TEST_F(BufferPoolTest, ResolutionSwitchAllocatorCalls)
+{
+    const uint32_t bufferNum   = 10;
+    const uint32_t switchNum   = 40;
+    const uint32_t framesNum   = 8;
+    const uint32_t inFlight    = 2;
+    const uint32_t widths[]    = {1920, 1280, 3840, 720, 2560};
+    const uint32_t widthsNum   = sizeof(widths) / sizeof(widths[0]);
+
+    for (int32_t usePool = 0; usePool <= 1; usePool++)
+    {
+        m_usePool            = usePool != 0;
+        uint32_t allocBefore = m_allocCount;
+        std::vector<FakeBuffer *> buffers(bufferNum, nullptr);
+
+        for (uint32_t i = 0; i <= switchNum; i++)
+        {
+            uint32_t width = widths[(i * 3) % widthsNum];
+            for (uint32_t j = 0; j < bufferNum; j++)
+            {
+                // Row store style buffers scaling with frame width, each with own usage
+                if (buffers[j] != nullptr)
+                {
+                    Destroy(buffers[j]);
+                }
+                buffers[j] = Allocate(width * (j + 1) * 16, j);
+            }
+            for (uint32_t frame = 0; frame < framesNum; frame++)
+            {
+                DecodeFrame(inFlight);
+            }
+            EXPECT_LE(m_pool.GetSize(), m_budget);
+        }
+
+        if (m_usePool)
+        {
+            // Every resolution allocates its buffers at most once, later switches reuse them
+            EXPECT_LE(m_allocCount - allocBefore, bufferNum * widthsNum);
+        }
+        else
+        {
+            EXPECT_EQ(bufferNum * (switchNum + 1), m_allocCount - allocBefore);
+        }
+
+        for (auto buffer : buffers)
+        {
+            Destroy(buffer);
+        }
+    }
+}
@@ -0,0 +1,393 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "hal_kerneldll_hash.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+// Stand-in for the compositing filter entry (same size class as the real one,
+// mostly small enum values, which is what the hash has to spread)
+struct tagKdll_FilterEntry
+{
+    int32_t values[18];
+};
+
+class KernelDllHashTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        memset(&m_table, 0, sizeof(m_table));
+        m_table.pool = 1;
+        m_table.last = DL_MAX_COMBINED_KERNELS;
+        for (uint16_t i = 1; i <= DL_MAX_COMBINED_KERNELS; i++)
+        {
+            m_table.HashEntry[i - 1].next = (i < DL_MAX_COMBINED_KERNELS) ? i + 1 : 0;
+        }
+    }
+
+    uint16_t Allocate(uint64_t hash)
+    {
+        uint16_t entry = m_table.pool;
+        if (entry == 0)
+        {
+            return 0;
+        }
+        m_table.pool                       = m_table.HashEntry[entry - 1].next;
+        m_table.HashEntry[entry - 1].ui64Hash = hash;
+        m_table.HashEntry[entry - 1].next  = 0;
+        KernelDll_InsertHashSlot(&m_table, entry);
+        return entry;
+    }
+
+    bool Release(uint16_t entry)
+    {
+        if (!KernelDll_RemoveHashSlot(&m_table, entry))
+        {
+            return false;
+        }
+        m_table.HashEntry[entry - 1].next = m_table.pool;
+        m_table.pool                      = entry;
+        return true;
+    }
+
+    std::vector<uint16_t> FindAll(uint64_t hash) const
+    {
+        std::vector<uint16_t> found;
+        uint32_t slot = KDLL_HASH_SLOT(hash);
+        uint16_t entry;
+        while ((entry = KernelDll_FindHashSlot(&m_table, hash, &slot)) != 0)
+        {
+            found.push_back(entry);
+        }
+        return found;
+    }
+
+    // Every live entry sits in the slot it recorded, no empty slot lies
+    // between its home slot and that slot, and nothing else is in the table
+    void CheckTable(const std::map<uint16_t, uint64_t> &live) const
+    {
+        uint32_t used = 0;
+        for (uint32_t slot = 0; slot < DL_KERNEL_HASH_TABLE_SIZE; slot++)
+        {
+            used += (m_table.wHashTable[slot] != 0);
+        }
+        ASSERT_EQ(live.size(), used);
+
+        for (auto &item : live)
+        {
+            const Kdll_KernelHashEntry &e = m_table.HashEntry[item.first - 1];
+            ASSERT_EQ(item.second, e.ui64Hash);
+            ASSERT_LT(e.wSlot, DL_KERNEL_HASH_TABLE_SIZE);
+            ASSERT_EQ(item.first, m_table.wHashTable[e.wSlot]);
+            for (uint32_t slot = KDLL_HASH_SLOT(e.ui64Hash); slot != e.wSlot; slot = KDLL_HASH_NEXT_SLOT(slot))
+            {
+                ASSERT_NE(0, m_table.wHashTable[slot]) << "entry " << item.first << " unreachable";
+            }
+
+            std::vector<uint16_t> found = FindAll(item.second);
+            ASSERT_NE(found.end(), std::find(found.begin(), found.end(), item.first));
+            for (uint16_t f : found)
+            {
+                ASSERT_EQ(1u, live.count(f));
+                ASSERT_EQ(item.second, live.at(f));
+            }
+        }
+    }
+
+    Kdll_KernelHashTable m_table;
+};
+
+// Hash with a given home slot (upper bits vary so entries stay distinct)
+static uint64_t HashAtSlot(uint32_t slot, uint32_t tag)
+{
+    uint64_t hi = (uint64_t)tag << 32;
+    return hi | ((slot ^ tag) & (DL_KERNEL_HASH_TABLE_SIZE - 1));
+}
+
+TEST_F(KernelDllHashTest, InsertFindRemove)
+{
+    uint16_t a = Allocate(0x1234567890abcdefULL);
+    uint16_t b = Allocate(0xfedcba0987654321ULL);
+    ASSERT_NE(0, a);
+    ASSERT_NE(0, b);
+
+    EXPECT_EQ(std::vector<uint16_t>{a}, FindAll(0x1234567890abcdefULL));
+    EXPECT_EQ(std::vector<uint16_t>{b}, FindAll(0xfedcba0987654321ULL));
+    EXPECT_TRUE(FindAll(0x1111111111111111ULL).empty());
+
+    EXPECT_TRUE(Release(a));
+    EXPECT_TRUE(FindAll(0x1234567890abcdefULL).empty());
+    EXPECT_EQ(std::vector<uint16_t>{b}, FindAll(0xfedcba0987654321ULL));
+
+    // Releasing twice is reported, not applied
+    EXPECT_FALSE(Release(a));
+    EXPECT_EQ(std::vector<uint16_t>{b}, FindAll(0xfedcba0987654321ULL));
+}
+
+TEST_F(KernelDllHashTest, SameHashEntriesAreAllFound)
+{
+    // Different filters may share the 64-bit hash; lookup compares the filter
+    // of every entry with the hash, so each of them must be returned
+    const uint64_t hash = 0x0123456789abcdefULL;
+    std::vector<uint16_t> entries;
+    for (int i = 0; i < 5; i++)
+    {
+        entries.push_back(Allocate(hash));
+    }
+    EXPECT_EQ(entries, FindAll(hash));
+
+    ASSERT_TRUE(Release(entries[1]));
+    entries.erase(entries.begin() + 1);
+    std::vector<uint16_t> found = FindAll(hash);
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(entries, found);
+}
+
+TEST_F(KernelDllHashTest, BackwardShiftAcrossTableEnd)
+{
+    // Cluster straddling the last slot: removing its head must pull the
+    // wrapped entries back without moving the ones which are home
+    const uint32_t last = DL_KERNEL_HASH_TABLE_SIZE - 1;
+    std::map<uint16_t, uint64_t> live;
+    uint64_t hashes[] = {HashAtSlot(last - 1, 0), HashAtSlot(last - 1, 2), HashAtSlot(last, 4),
+                         HashAtSlot(0, 6), HashAtSlot(last - 1, 8), HashAtSlot(1, 10)};
+    for (uint64_t hash : hashes)
+    {
+        live[Allocate(hash)] = hash;
+    }
+    CheckTable(live);
+
+    uint16_t head = m_table.wHashTable[last - 1];
+    ASSERT_TRUE(Release(head));
+    live.erase(head);
+    CheckTable(live);
+    EXPECT_EQ(0, m_table.wHashTable[3]);
+}
+
+TEST_F(KernelDllHashTest, RandomizedAgainstReference)
+{
+    std::mt19937 rng(26);
+    std::map<uint16_t, uint64_t> live;
+
+    for (int iter = 0; iter < 20000; iter++)
+    {
+        bool insert = live.empty() ||
+                      (live.size() < DL_MAX_COMBINED_KERNELS && (rng() % 3) != 0);
+        if (insert)
+        {
+            // Crowd a few home slots so clusters merge and wrap
+            uint64_t hash = HashAtSlot((rng() % 8) * 37 + DL_KERNEL_HASH_TABLE_SIZE - 20, rng() % 64);
+            uint16_t entry = Allocate(hash);
+            ASSERT_NE(0, entry);
+            live[entry] = hash;
+        }
+        else
+        {
+            auto it = live.begin();
+            std::advance(it, rng() % live.size());
+            ASSERT_TRUE(Release(it->first));
+            live.erase(it);
+        }
+        CheckTable(live);
+        if (HasFatalFailure())
+        {
+            FAIL() << "iteration " << iter;
+        }
+    }
+}
+
+TEST(KernelDllSimpleHash64Test, SizeAndTailBytesMatter)
+{
+    uint8_t data[24] = {};
+    uint64_t base = KernelDll_SimpleHash64(data, sizeof(data));
+    EXPECT_NE(base, KernelDll_SimpleHash64(data, sizeof(data) - 1));
+
+    for (uint32_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = 1;
+        EXPECT_NE(base, KernelDll_SimpleHash64(data, sizeof(data))) << "byte " << i;
+        data[i] = 0;
+    }
+}
+
+// Combined kernel cache before the change: 32-bit FNV-1a folded to 8 bits,
+// one chain per folded hash
+struct FnvFoldedCache
+{
+    static uint32_t Hash(const void *pData, int32_t iSize)
+    {
+        uint32_t hash = 0x811c9dc5;
+        const char *p = (const char *)pData;
+        for (; iSize > 0; iSize--)
+        {
+            hash ^= (*p++);
+            hash *= 0x1000193;
+        }
+        return hash;
+    }
+
+    static uint32_t Fold(uint32_t hash)
+    {
+        uint32_t folded = ((hash >> 8) ^ hash) & 0x00ff00ff;
+        return ((folded >> 16) ^ folded) & 0xff;
+    }
+
+    struct Entry
+    {
+        uint16_t                    next;
+        uint32_t                    hash;
+        int                         iFilter;
+        const tagKdll_FilterEntry   *pFilter;
+    };
+
+    uint16_t heads[256] = {};
+    Entry    entries[DL_MAX_COMBINED_KERNELS + 1] = {};
+
+    void Add(uint16_t entry, const std::vector<tagKdll_FilterEntry> &filter)
+    {
+        uint32_t hash = Hash(filter.data(), (int32_t)(filter.size() * sizeof(tagKdll_FilterEntry)));
+        entries[entry] = {heads[Fold(hash)], hash, (int)filter.size(), filter.data()};
+        heads[Fold(hash)] = entry;
+    }
+
+    uint16_t Find(const std::vector<tagKdll_FilterEntry> &filter, uint64_t &visited, uint64_t &compares) const
+    {
+        int32_t  size = (int32_t)(filter.size() * sizeof(tagKdll_FilterEntry));
+        uint32_t hash = Hash(filter.data(), size);
+        for (uint16_t entry = heads[Fold(hash)]; entry; entry = entries[entry].next)
+        {
+            visited++;
+            if (entries[entry].hash == hash && entries[entry].iFilter == (int)filter.size())
+            {
+                compares++;
+                if (memcmp(entries[entry].pFilter, filter.data(), size) == 0)
+                {
+                    return entry;
+                }
+            }
+        }
+        return 0;
+    }
+};
+
+// Cache-thrash benchmark: the composition pipeline looks up its filter once per
+// frame; a mixed workload cycles through more filters than the cache holds, so
+// half of the lookups miss. Reports time per lookup, entries (slots) walked per
+// lookup and filter compares for the old and the new table.
+TEST_F(KernelDllHashTest, CacheThrashBenchmark)
+{
+    std::mt19937 rng(64);
+    std::vector<std::vector<tagKdll_FilterEntry>> filters(DL_MAX_COMBINED_KERNELS * 2);
+    for (size_t i = 0; i < filters.size(); i++)
+    {
+        // 2..5 layers of small enum-like values, differing in one field or two
+        filters[i].resize(2 + i % 4);
+        for (auto &layer : filters[i])
+        {
+            for (int32_t &value : layer.values)
+            {
+                value = rng() % 4;
+            }
+        }
+        filters[i][0].values[0] = (int32_t)i;
+    }
+
+    // Resident half of the filters, as after the cache has been filled
+    FnvFoldedCache oldCache;
+    std::vector<uint64_t> hashes(filters.size());
+    for (size_t i = 0; i < filters.size(); i++)
+    {
+        hashes[i] = KernelDll_SimpleHash64(filters[i].data(), (int32_t)(filters[i].size() * sizeof(tagKdll_FilterEntry)));
+    }
+    for (uint16_t i = 0; i < DL_MAX_COMBINED_KERNELS; i++)
+    {
+        uint16_t entry = Allocate(hashes[i]);
+        ASSERT_NE(0, entry);
+        m_table.HashEntry[entry - 1].iFilter = (int)filters[i].size();
+        m_table.HashEntry[entry - 1].pFilter = filters[i].data();
+        oldCache.Add(entry, filters[i]);
+    }
+
+    std::vector<uint32_t> trace(200000);
+    for (uint32_t &id : trace)
+    {
+        id = rng() % filters.size();
+    }
+
+    uint64_t oldVisited = 0, newVisited = 0, oldCompares = 0, newCompares = 0;
+    uint32_t oldHits = 0, newHits = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t id : trace)
+    {
+        oldHits += (oldCache.Find(filters[id], oldVisited, oldCompares) != 0);
+    }
+    auto oldTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t id : trace)
+    {
+        const std::vector<tagKdll_FilterEntry> &filter = filters[id];
+        int32_t  size  = (int32_t)(filter.size() * sizeof(tagKdll_FilterEntry));
+        uint64_t hash  = KernelDll_SimpleHash64(filter.data(), size);
+        uint32_t home  = KDLL_HASH_SLOT(hash);
+        uint32_t slot  = home;
+        uint16_t entry;
+        while ((entry = KernelDll_FindHashSlot(&m_table, hash, &slot)) != 0)
+        {
+            newCompares++;
+            const Kdll_KernelHashEntry &e = m_table.HashEntry[entry - 1];
+            if (e.iFilter == (int)filter.size() && memcmp(e.pFilter, filter.data(), size) == 0)
+            {
+                newHits++;
+                break;
+            }
+        }
+        // Slots walked up to the match, or up to and including the empty slot
+        newVisited += ((slot - home) & (DL_KERNEL_HASH_TABLE_SIZE - 1)) + (entry == 0);
+    }
+    auto newTime = std::chrono::steady_clock::now() - start;
+
+    // Both tables hold the same filters
+    EXPECT_EQ(oldHits, newHits);
+    EXPECT_GT(newHits, 0u);
+    EXPECT_LT(newHits, trace.size());
+
+    // With a 64-bit hash only the matching filter is ever compared
+    EXPECT_EQ(newHits, newCompares);
+    EXPECT_LE(newCompares, oldCompares);
+
+    using ns = std::chrono::nanoseconds;
+    std::cout << "[ KDLL     ] " << trace.size() << " lookups, " << newHits << " hits: "
+              << "chained FNV " << (double)std::chrono::duration_cast<ns>(oldTime).count() / trace.size()
+              << " ns/lookup, " << (double)oldVisited / trace.size() << " entries/lookup, "
+              << oldCompares << " compares; "
+              << "open addressing " << (double)std::chrono::duration_cast<ns>(newTime).count() / trace.size()
+              << " ns/lookup, " << (double)newVisited / trace.size() << " slots/lookup, "
+              << newCompares << " compares" << std::endl;
+}
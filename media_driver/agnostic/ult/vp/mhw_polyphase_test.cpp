@@ -0,0 +1,410 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "mhw_polyphase.h"
+#include <math.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+//!
+//! \brief  Mirror of the Y table constants in mhw_utilities.h and mhw_state_heap.h
+//!
+#define TEST_POLYPHASE_TABLES       32
+#define TEST_POLYPHASE_Y_ENTRIES    8
+#define TEST_POLYPHASE_UV_ENTRIES   4
+#define TEST_POLYPHASE_5x5_ENTRIES  5
+#define TEST_AVS_COEF_UNIT          (1 << 6)
+
+//!
+//! \brief  Mirror of MOS_Sinc, MOS_Lanczos and MOS_Lanczos_g in mos_utilities.cpp
+//!
+static float Sinc(float x)
+{
+    return (MOS_ABS(x) < 1e-9f) ? 1.0F : (float)(sin(x) / x);
+}
+
+static float Lanczos(float x, uint32_t dwNumEntries, float fLanczosT)
+{
+    uint32_t dwNumHalfEntries = dwNumEntries >> 1;
+    if (fLanczosT < dwNumHalfEntries)
+    {
+        fLanczosT = (float)dwNumHalfEntries;
+    }
+    if (MOS_ABS(x) >= dwNumHalfEntries)
+    {
+        return 0.0;
+    }
+    x *= MOS_PI;
+    return Sinc(x) * Sinc(x / fLanczosT);
+}
+
+static float LanczosG(float x, uint32_t dwNumEntries, float fLanczosT)
+{
+    uint32_t dwNumHalfEntries = (dwNumEntries >> 1) + (dwNumEntries & 1);
+    if (fLanczosT < dwNumHalfEntries)
+    {
+        fLanczosT = (float)dwNumHalfEntries;
+    }
+    if (x > (dwNumEntries >> 1) || (- x) >= dwNumHalfEntries)
+    {
+        return 0.0;
+    }
+    x *= MOS_PI;
+    return Sinc(x) * Sinc(x / fLanczosT);
+}
+
+//!
+//! \brief  Y table loop of Mhw_CalcPolyphaseTablesY before it was cached, which convolved
+//!         Y tables with the high pass filter whatever its strength
+//!
+static void CalcPolyphaseTablesYBaseline(
+    int32_t *iCoefs, float fScaleFactor, bool bYPlane, float fHPStrength,
+    bool bUse8x8Filter, uint32_t dwHwPhase, float fLanczosT)
+{
+    uint32_t dwNumEntries = bYPlane ? TEST_POLYPHASE_Y_ENTRIES : TEST_POLYPHASE_UV_ENTRIES;
+    uint32_t dwTableCoefUnit = TEST_AVS_COEF_UNIT;
+    uint32_t i, j;
+    int32_t  k;
+    float    fPhaseCoefs[TEST_POLYPHASE_Y_ENTRIES]     = {};
+    float    fPhaseCoefsCopy[TEST_POLYPHASE_Y_ENTRIES] = {};
+    float    fHPFilter[3], fHPSum, fHPHalfPhase;
+    float    fBase, fPos, fSumCoefs;
+    int32_t  iCenterPixel = dwNumEntries / 2 - 1;
+    float    fStartOffset = (float)(-iCenterPixel);
+    int32_t  iSumQuantCoefs;
+
+    for (i = 0; i < dwHwPhase; i++)
+    {
+        fBase = fStartOffset - (float)i / (float)TEST_POLYPHASE_TABLES;
+        fSumCoefs = 0.0F;
+
+        for (j = 0; j < dwNumEntries; j++)
+        {
+            fPos = fBase + (float)j;
+            if (bUse8x8Filter)
+            {
+                fPhaseCoefs[j] = fPhaseCoefsCopy[j] = Lanczos(fPos * fScaleFactor, dwNumEntries, fLanczosT);
+            }
+            else
+            {
+                fPhaseCoefs[j] = fPhaseCoefsCopy[j] = LanczosG(fPos * fScaleFactor, TEST_POLYPHASE_5x5_ENTRIES, fLanczosT);
+            }
+            fSumCoefs += fPhaseCoefs[j];
+        }
+
+        if (bYPlane)
+        {
+            if (i <= TEST_POLYPHASE_TABLES / 2)
+            {
+                fHPHalfPhase = (float)i / (float)TEST_POLYPHASE_TABLES;
+            }
+            else
+            {
+                fHPHalfPhase = (float)(TEST_POLYPHASE_TABLES - i) / (float)TEST_POLYPHASE_TABLES;
+            }
+            fHPFilter[0] = fHPFilter[2] = -fHPStrength * Sinc(fHPHalfPhase * MOS_PI);
+            fHPFilter[1] = 1.0F + 2.0F * fHPStrength;
+
+            for (j = 0; j < dwNumEntries; j++)
+            {
+                fHPSum = 0.0F;
+                for (k = -1; k <= 1; k++)
+                {
+                    if ((((long)j + k) >= 0) && (j + k < dwNumEntries))
+                    {
+                        fHPSum += fPhaseCoefsCopy[(int32_t)j+k] * fHPFilter[k+1];
+                    }
+                    fPhaseCoefs[j] = fHPSum;
+                }
+            }
+        }
+
+        iSumQuantCoefs = 0;
+        for (j = 0; j < dwNumEntries; j++)
+        {
+            iCoefs[i * dwNumEntries + j] = (int32_t)floor(0.5F + (float)dwTableCoefUnit * fPhaseCoefs[j] / fSumCoefs);
+            iSumQuantCoefs += iCoefs[i * dwNumEntries + j];
+        }
+
+        if (i <= TEST_POLYPHASE_TABLES / 2)
+        {
+            iCoefs[i * dwNumEntries + iCenterPixel] -= iSumQuantCoefs - dwTableCoefUnit;
+        }
+        else
+        {
+            iCoefs[i * dwNumEntries + iCenterPixel + 1] -= iSumQuantCoefs - dwTableCoefUnit;
+        }
+    }
+}
+
+//!
+//! \brief  Mirror of MHW_POLYPHASE_CACHE_KEY for Y tables, fLanczosT is derived from the
+//!         format and plane in the driver, so it stands in for both
+//!
+struct YKey
+{
+    float    fScaleFactor;
+    float    fHPStrength;
+    bool     bYPlane;
+    uint32_t dwHwPhase;
+    float    fLanczosT;
+    bool     bUse8x8Filter;
+
+    bool operator==(const YKey &Key) const
+    {
+        return fScaleFactor  == Key.fScaleFactor  &&
+               fHPStrength   == Key.fHPStrength   &&
+               bYPlane       == Key.bYPlane       &&
+               dwHwPhase     == Key.dwHwPhase     &&
+               fLanczosT     == Key.fLanczosT     &&
+               bUse8x8Filter == Key.bUse8x8Filter;
+    }
+
+    uint32_t NumCoefs() const
+    {
+        return dwHwPhase * (bYPlane ? TEST_POLYPHASE_Y_ENTRIES : TEST_POLYPHASE_UV_ENTRIES);
+    }
+};
+
+typedef MhwPolyphaseCache<YKey, TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES, 16> YCache;
+
+//!
+//! \brief  Same calculation as Mhw_CalcPolyphaseTablesY
+//!
+static void CalcPolyphaseTablesY(int32_t *iCoefs, const YKey &Key)
+{
+    uint32_t dwNumEntries = Key.bYPlane ? TEST_POLYPHASE_Y_ENTRIES : TEST_POLYPHASE_UV_ENTRIES;
+    Mhw_CalcPolyphaseCoefsY(
+        iCoefs,
+        Key.fScaleFactor,
+        dwNumEntries,
+        Key.dwHwPhase,
+        TEST_POLYPHASE_TABLES,
+        TEST_AVS_COEF_UNIT,
+        Key.bYPlane && Key.fHPStrength != 0.0F,
+        Key.fHPStrength,
+        [&](float x) {
+            return Key.bUse8x8Filter ?
+                Lanczos(x, dwNumEntries, Key.fLanczosT) :
+                LanczosG(x, TEST_POLYPHASE_5x5_ENTRIES, Key.fLanczosT);
+        },
+        Sinc);
+}
+
+static std::vector<YKey> YSweep()
+{
+    const float scaleFactors[] = {
+        0.0625f, 0.125f, 0.2f, 0.25f, 1.0f / 3.0f, 0.5f, 0.5625f, 2.0f / 3.0f, 0.75f,
+        0.8888889f, 0.999f, 1.0f, 1.001f, 1.125f, 4.0f / 3.0f, 1.5f, 1.7777778f, 2.0f,
+        2.25f, 3.0f, 4.0f, 7.5f, 16.0f};
+    const float hpStrengths[] = {0.0f, -0.0f, 0.125f, 0.5f, 1.0f};
+    const float lanczosTs[]   = {2.0f, 4.0f, 8.0f};
+    const uint32_t hwPhases[] = {17, 32};
+
+    std::vector<YKey> sweep;
+    for (float sf : scaleFactors)
+        for (float hp : hpStrengths)
+            for (int plane = 0; plane < 2; plane++)
+                for (uint32_t phase : hwPhases)
+                    for (float t : lanczosTs)
+                        for (int filter8x8 = 0; filter8x8 < 2; filter8x8++)
+                        {
+                            YKey key = {sf, hp, plane == 0, phase, t, filter8x8 != 0};
+                            sweep.push_back(key);
+                        }
+    return sweep;
+}
+
+TEST(MhwPolyphaseTest, YSweepIsBitIdenticalToBaseline)
+{
+    std::vector<YKey> sweep = YSweep();
+    ASSERT_EQ(23u * 5 * 2 * 2 * 3 * 2, sweep.size());
+
+    for (const YKey &key : sweep)
+    {
+        int32_t baseline[TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES];
+        int32_t table[TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES];
+        memset(baseline, 0xcd, sizeof(baseline));
+        memset(table, 0xab, sizeof(table));
+
+        CalcPolyphaseTablesYBaseline(baseline, key.fScaleFactor, key.bYPlane, key.fHPStrength,
+            key.bUse8x8Filter, key.dwHwPhase, key.fLanczosT);
+        CalcPolyphaseTablesY(table, key);
+
+        ASSERT_EQ(0, memcmp(baseline, table, key.NumCoefs() * sizeof(int32_t)))
+            << "scale " << key.fScaleFactor << " hp " << key.fHPStrength << " y " << key.bYPlane
+            << " phases " << key.dwHwPhase << " t " << key.fLanczosT << " 8x8 " << key.bUse8x8Filter;
+    }
+}
+
+TEST(MhwPolyphaseTest, NonZeroHPStrengthChangesYTables)
+{
+    // The sweep only proves something if the convolution it skips is not a no-op anyway.
+    YKey    key = {0.5f, 0.0f, true, 17, 4.0f, true};
+    int32_t sharp[TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES];
+    int32_t plain[TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES];
+    CalcPolyphaseTablesY(plain, key);
+    key.fHPStrength = 0.5f;
+    CalcPolyphaseTablesY(sharp, key);
+    EXPECT_NE(0, memcmp(plain, sharp, key.NumCoefs() * sizeof(int32_t)));
+}
+
+TEST(MhwPolyphaseTest, ZeroStrengthHPIsIdentityForSignedZerosAndDenormals)
+{
+    // Convolving with {-0 * sinc, 1, -0 * sinc} only adds signed zeros, which can turn a
+    // -0 coefficient into +0 but never changes a quantized one.
+    const float denorm = std::numeric_limits<float>::denorm_min();
+    const float taps[][TEST_POLYPHASE_Y_ENTRIES] = {
+        {-0.0f, 0.0f, -0.0f, 1.0f, 0.5f, -0.0f, 0.0f, -0.0f},
+        {denorm, -denorm, 0.25f, 1.0f, 0.75f, -0.125f, -denorm, denorm},
+        {-0.0078125f, 0.0078125f, -0.5f, 1.0f, 1.0f, -0.5f, 0.0078125f, -0.0078125f},
+        {1e-30f, -1e-30f, -0.0f, 2.0f, -0.0f, 1e-30f, -1e-30f, 0.0f},
+    };
+
+    for (const auto &tap : taps)
+    {
+        for (float hp : {0.0f, -0.0f})
+        {
+            int32_t convolved[TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES];
+            int32_t skipped[TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES];
+            uint32_t calls = 0;
+            auto kernel = [&](float) { return tap[calls++ % TEST_POLYPHASE_Y_ENTRIES]; };
+
+            Mhw_CalcPolyphaseCoefsY(convolved, 1.0f, TEST_POLYPHASE_Y_ENTRIES, 32, TEST_POLYPHASE_TABLES,
+                TEST_AVS_COEF_UNIT, true, hp, kernel, Sinc);
+            calls = 0;
+            Mhw_CalcPolyphaseCoefsY(skipped, 1.0f, TEST_POLYPHASE_Y_ENTRIES, 32, TEST_POLYPHASE_TABLES,
+                TEST_AVS_COEF_UNIT, false, hp, kernel, Sinc);
+
+            EXPECT_EQ(0, memcmp(convolved, skipped, sizeof(convolved)));
+        }
+    }
+}
+
+TEST(MhwPolyphaseTest, CachedSweepIsBitIdenticalToBaseline)
+{
+    YCache            cache;
+    std::vector<YKey> sweep = YSweep();
+    std::mt19937      rng(2026);
+
+    // Scaling streams mostly flip between a few ratios, and sometimes switch to any other.
+    std::uniform_int_distribution<size_t> hot(0, 5), any(0, sweep.size() - 1), pick(0, 9);
+    for (uint32_t i = 0; i < 5000; i++)
+    {
+        const YKey &key = sweep[pick(rng) ? hot(rng) * 97 % sweep.size() : any(rng)];
+        int32_t baseline[TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES];
+        int32_t cached[TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES];
+        memset(cached, 0xcd, sizeof(cached));
+
+        cache.Get(key, cached, key.NumCoefs(), [&](int32_t *table) { CalcPolyphaseTablesY(table, key); });
+        CalcPolyphaseTablesYBaseline(baseline, key.fScaleFactor, key.bYPlane, key.fHPStrength,
+            key.bUse8x8Filter, key.dwHwPhase, key.fLanczosT);
+
+        ASSERT_EQ(0, memcmp(baseline, cached, key.NumCoefs() * sizeof(int32_t))) << "request " << i;
+    }
+    EXPECT_LT(cache.GetCalcCount(), 5000u / 2);
+}
+
+TEST(MhwPolyphaseTest, EveryKeyFieldAndTableSizeMisses)
+{
+    YCache  cache;
+    int32_t table[TEST_POLYPHASE_Y_ENTRIES * TEST_POLYPHASE_TABLES];
+    uint32_t calcs = 0;
+    auto calc = [&](int32_t *coefs) { coefs[0] = (int32_t)++calcs; };
+
+    YKey base = {0.5f, 0.0f, true, 17, 4.0f, true};
+    cache.Get(base, table, base.NumCoefs(), calc);
+    ASSERT_EQ(1u, calcs);
+
+    for (uint32_t field = 0; field < 6; field++)
+    {
+        YKey key = base;
+        switch (field)
+        {
+        case 0: key.fScaleFactor  = 0.75f; break;
+        case 1: key.fHPStrength   = 0.5f;  break;
+        case 2: key.bYPlane       = false; break;
+        case 3: key.dwHwPhase     = 32;    break;
+        case 4: key.fLanczosT     = 8.0f;  break;
+        case 5: key.bUse8x8Filter = false; break;
+        }
+        cache.Get(key, table, key.NumCoefs(), calc);
+        EXPECT_EQ(field + 2, calcs) << "field " << field;
+        EXPECT_EQ((int32_t)(field + 2), table[0]);
+    }
+
+    // Same key with another table size is another table
+    cache.Get(base, table, base.NumCoefs() - 1, calc);
+    EXPECT_EQ(8u, calcs);
+
+    // Negative zero strength is the same table as zero strength
+    YKey negativeZero = base;
+    negativeZero.fHPStrength = -0.0f;
+    cache.Get(negativeZero, table, base.NumCoefs(), calc);
+    EXPECT_EQ(8u, calcs);
+    EXPECT_EQ(1, table[0]);
+    EXPECT_EQ(8u, cache.GetCalcCount());
+}
+
+TEST(MhwPolyphaseTest, LeastRecentlyUsedTableIsReplaced)
+{
+    MhwPolyphaseCache<uint32_t, 4, 2> cache;
+    int32_t  table[4];
+    uint32_t calcs = 0;
+    auto calc = [&](int32_t *coefs) {
+        calcs++;
+        for (int i = 0; i < 4; i++) coefs[i] = (int32_t)(calcs * 10 + i);
+    };
+
+    cache.Get(1, table, 4, calc);
+    cache.Get(2, table, 4, calc);
+    cache.Get(1, table, 4, calc);   // 2 is now least recently used
+    cache.Get(3, table, 4, calc);   // replaces 2
+    EXPECT_EQ(3u, calcs);
+
+    cache.Get(1, table, 4, calc);
+    EXPECT_EQ(3u, calcs);
+    EXPECT_EQ(10, table[0]);
+    EXPECT_EQ(13, table[3]);
+
+    cache.Get(2, table, 4, calc);
+    EXPECT_EQ(4u, calcs);
+}
+
+TEST(MhwPolyphaseTest, TablesLargerThanEntriesAreNotCached)
+{
+    MhwPolyphaseCache<uint32_t, 4, 2> cache;
+    int32_t  table[8];
+    uint32_t calcs = 0;
+    auto calc = [&](int32_t *coefs) {
+        calcs++;
+        for (int i = 0; i < 8; i++) coefs[i] = (int32_t)(calcs * 10 + i);
+    };
+
+    cache.Get(1, table, 8, calc);
+    cache.Get(1, table, 8, calc);
+    EXPECT_EQ(2u, calcs);
+    EXPECT_EQ(27, table[7]);
+    EXPECT_EQ(0u, cache.GetCalcCount());
+}
@@ -0,0 +1,345 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "renderhal_dsh_curbe_cache.h"
+#include <iostream>
+#include <vector>
+
+// Mirror of the staging part of RENDERHAL_DSH_CURBE_CACHE
+struct CurbeCache
+{
+    uint32_t dwSize;
+    uint8_t  *pData;
+    uint8_t  *pStaging;
+    uint32_t dwAllocSize;
+    uint32_t dwStagedSize;
+    bool     bDeferred;
+    bool     bReused;
+    uint64_t ui64BytesWritten;
+    uint64_t ui64BytesReused;
+};
+
+static const uint32_t kCurbeBlockAlign = 64;
+static const uint32_t kCurbeRegionSize = 1024;
+
+// Mirrors the RenderHal DSH glue: one GSH block per media state, CURBE_LOAD
+// resolved in SendCurbeLoad, staging ended after the command buffer is submitted.
+// The GPU copy of each submission is taken at submit time.
+class CurbeCacheTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        memset(&m_cache, 0, sizeof(m_cache));
+        m_data.assign(kCurbeRegionSize, 0);
+        m_staging.assign(kCurbeRegionSize, 0);
+        m_cache.pData       = m_data.data();
+        m_cache.pStaging    = m_staging.data();
+        m_cache.dwAllocSize = kCurbeRegionSize;
+    }
+
+    MOS_STATUS Write(const uint8_t *pSrc, uint32_t dwOffset, uint32_t dwSize)
+    {
+        if (m_staged < 0 || m_submitted[m_staged])
+        {
+            m_lateWrites++;
+        }
+        else
+        {
+            memcpy(m_blocks[m_staged].data() + dwOffset, pSrc, dwSize);
+        }
+        m_writes++;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    bool Reference()
+    {
+        m_references++;
+        if (!m_referenceAlive)
+        {
+            m_reference = -1;
+            return false;
+        }
+        m_extended.push_back(m_reference);
+        return true;
+    }
+
+    void Begin()
+    {
+        auto write = [this](const uint8_t *pSrc, uint32_t dwOffset, uint32_t dwSize) {
+            return Write(pSrc, dwOffset, dwSize);
+        };
+        ASSERT_EQ(MOS_STATUS_SUCCESS, RenderHal_DSH_FlushStagedCurbe(&m_cache, write));
+
+        m_blocks.push_back(std::vector<uint8_t>(kCurbeRegionSize, 0));
+        m_submitted.push_back(false);
+        m_staged  = (int32_t)m_blocks.size() - 1;
+        m_current = 0;
+        RenderHal_DSH_BeginCurbeStaging(&m_cache, kCurbeRegionSize, m_reference >= 0 && m_referenceAlive);
+    }
+
+    void Load(const std::vector<uint8_t> &curbe)
+    {
+        auto write = [this](const uint8_t *pSrc, uint32_t dwOffset, uint32_t dwSize) {
+            return Write(pSrc, dwOffset, dwSize);
+        };
+        uint32_t dwCurbeSize = MOS_ALIGN_CEIL((uint32_t)curbe.size(), kCurbeBlockAlign);
+        ASSERT_LE(m_current + dwCurbeSize, kCurbeRegionSize);
+        ASSERT_EQ(MOS_STATUS_SUCCESS, RenderHal_DSH_StageCurbeData(
+            &m_cache, m_current, curbe.data(), (uint32_t)curbe.size(), dwCurbeSize, write));
+        m_current += dwCurbeSize;
+    }
+
+    void SendCurbeLoad()
+    {
+        auto write = [this](const uint8_t *pSrc, uint32_t dwOffset, uint32_t dwSize) {
+            return Write(pSrc, dwOffset, dwSize);
+        };
+        auto reference = [this]() { return Reference(); };
+        ASSERT_EQ(MOS_STATUS_SUCCESS, RenderHal_DSH_ResolveCurbeLoad(&m_cache, m_current, reference, write));
+        m_loadBlock = m_cache.bReused ? m_reference : m_staged;
+        m_loaded    = true;
+    }
+
+    // Returns what the CURBE load of this media state reads on the GPU
+    std::vector<uint8_t> Submit()
+    {
+        std::vector<uint8_t> gpu;
+        if (m_loaded)
+        {
+            gpu.assign(m_blocks[m_loadBlock].begin(), m_blocks[m_loadBlock].begin() + m_current);
+        }
+        m_submitted[m_staged] = true;
+
+        if (RenderHal_DSH_EndCurbeStaging(&m_cache, m_current))
+        {
+            m_reference = m_staged;
+        }
+        m_staged = -1;
+        m_loaded = false;
+        return gpu;
+    }
+
+    std::vector<uint8_t> Frame(const std::vector<std::vector<uint8_t>> &curbes)
+    {
+        Begin();
+        for (auto &curbe : curbes)
+        {
+            Load(curbe);
+        }
+        SendCurbeLoad();
+        return Submit();
+    }
+
+    // CURBE as the GPU must see it: each load padded to the block alignment
+    static std::vector<uint8_t> Expected(const std::vector<std::vector<uint8_t>> &curbes)
+    {
+        std::vector<uint8_t> expected;
+        for (auto &curbe : curbes)
+        {
+            expected.insert(expected.end(), curbe.begin(), curbe.end());
+            expected.resize(MOS_ALIGN_CEIL(expected.size(), kCurbeBlockAlign), 0);
+        }
+        return expected;
+    }
+
+    static std::vector<uint8_t> Curbe(uint32_t dwSize, uint8_t seed)
+    {
+        std::vector<uint8_t> curbe(dwSize);
+        for (uint32_t i = 0; i < dwSize; i++)
+        {
+            curbe[i] = (uint8_t)(seed + i * 7);
+        }
+        return curbe;
+    }
+
+    CurbeCache                        m_cache;
+    std::vector<uint8_t>              m_data;
+    std::vector<uint8_t>              m_staging;
+    std::vector<std::vector<uint8_t>> m_blocks;
+    std::vector<bool>                 m_submitted;
+    std::vector<int32_t>              m_extended;
+    int32_t                           m_staged         = -1;
+    int32_t                           m_reference      = -1;
+    int32_t                           m_loadBlock      = -1;
+    uint32_t                          m_current        = 0;
+    bool                              m_loaded         = false;
+    bool                              m_referenceAlive = true;
+    uint32_t                          m_writes         = 0;
+    uint32_t                          m_lateWrites     = 0;
+    uint32_t                          m_references     = 0;
+};
+
+TEST_F(CurbeCacheTest, UnchangedCurbeReferencesFirstBlock)
+{
+    std::vector<std::vector<uint8_t>> curbes = {Curbe(100, 1), Curbe(64, 2)};
+
+    for (uint32_t frame = 0; frame < 300; frame++)
+    {
+        EXPECT_EQ(Expected(curbes), Frame(curbes)) << "frame " << frame;
+    }
+
+    EXPECT_EQ(2u, m_writes);
+    EXPECT_EQ(0, m_reference);
+    EXPECT_EQ(299u, m_references);
+    EXPECT_EQ(192u, m_cache.ui64BytesWritten);
+    EXPECT_EQ(299u * 192u, m_cache.ui64BytesReused);
+    EXPECT_EQ(0u, m_lateWrites);
+}
+
+TEST_F(CurbeCacheTest, ChangedCurbeIsWrittenBeforeSubmit)
+{
+    uint32_t seed    = 12345;
+    uint32_t reused  = 0;
+    auto     random  = [&seed]() { seed = seed * 1103515245 + 12345; return seed >> 16; };
+
+    std::vector<std::vector<uint8_t>> curbes = {Curbe(96, 0), Curbe(32, 1), Curbe(200, 2)};
+    for (uint32_t frame = 0; frame < 2000; frame++)
+    {
+        switch (random() % 6)
+        {
+        case 0:     // one byte of one load changes
+            curbes[random() % curbes.size()][0] ^= (uint8_t)(1 + random() % 255);
+            break;
+        case 1:     // last byte changes
+            curbes.back().back()++;
+            break;
+        case 2:     // load grows within its padding
+            curbes[0].resize(curbes[0].size() % kCurbeBlockAlign ? curbes[0].size() + 1 : 96, 0);
+            break;
+        case 3:     // one load more or less
+            if (curbes.size() > 1 && random() % 2)
+            {
+                curbes.pop_back();
+            }
+            else if (curbes.size() < 5)
+            {
+                curbes.push_back(Curbe(16 + random() % 150, (uint8_t)random()));
+            }
+            break;
+        default:    // unchanged
+            break;
+        }
+
+        EXPECT_EQ(Expected(curbes), Frame(curbes)) << "frame " << frame;
+        reused += m_cache.bReused;
+    }
+
+    EXPECT_EQ(0u, m_lateWrites);
+    EXPECT_EQ(reused, m_extended.size());
+    EXPECT_GT(reused, 500u);
+    std::cout << "[ CURBE    ] 2000 media states, " << reused << " referenced the last CURBE, "
+              << m_cache.ui64BytesWritten << " bytes written, " << m_cache.ui64BytesReused
+              << " bytes reused" << std::endl;
+}
+
+TEST_F(CurbeCacheTest, LifetimeExtendedOnlyWhenReferenced)
+{
+    Frame({Curbe(128, 1)});
+
+    // Same start, different tail: written, old block not referenced
+    Frame({Curbe(64, 1), Curbe(64, 9)});
+    EXPECT_EQ(0u, m_references);
+    EXPECT_EQ(1, m_reference);
+
+    // Same data but larger CURBE: never compared against the reference
+    Frame({Curbe(64, 1), Curbe(64, 9), Curbe(64, 3)});
+    EXPECT_EQ(0u, m_references);
+
+    Frame({Curbe(64, 1), Curbe(64, 9), Curbe(64, 3)});
+    EXPECT_EQ(1u, m_references);
+    ASSERT_EQ(1u, m_extended.size());
+    EXPECT_EQ(2, m_extended[0]);
+}
+
+TEST_F(CurbeCacheTest, ExpiredReferenceFallsBackToWrite)
+{
+    std::vector<std::vector<uint8_t>> curbes = {Curbe(128, 4)};
+    Frame(curbes);
+
+    // Block reclaimed between staging and the CURBE load
+    Begin();
+    Load(curbes[0]);
+    m_referenceAlive = false;
+    SendCurbeLoad();
+
+    EXPECT_FALSE(m_cache.bReused);
+    EXPECT_EQ(1u, m_references);
+    EXPECT_EQ(Expected(curbes), Submit());
+    EXPECT_EQ(1, m_reference);
+    EXPECT_EQ(0u, m_lateWrites);
+}
+
+TEST_F(CurbeCacheTest, CurbeWithoutLoadIsNotWrittenAfterSubmit)
+{
+    std::vector<std::vector<uint8_t>> curbes = {Curbe(128, 5)};
+    Frame(curbes);
+    uint32_t writes = m_writes;
+
+    // Staged but never loaded: nothing may be written once submitted
+    Begin();
+    Load(curbes[0]);
+    Submit();
+    Begin();
+
+    EXPECT_EQ(writes, m_writes);
+    EXPECT_EQ(0u, m_lateWrites);
+    EXPECT_EQ(0, m_reference);
+
+    Load(curbes[0]);
+    SendCurbeLoad();
+    EXPECT_TRUE(m_cache.bReused);
+    EXPECT_EQ(Expected(curbes), Submit());
+}
+
+TEST_F(CurbeCacheTest, NextMediaStateFlushesDeferredCurbe)
+{
+    std::vector<std::vector<uint8_t>> curbes = {Curbe(128, 6)};
+    Frame(curbes);
+
+    // Second media state assigned before the first one sends its CURBE load
+    Begin();
+    Load(curbes[0]);
+    int32_t first = m_staged;
+    Begin();
+
+    std::vector<uint8_t> block(m_blocks[first].begin(), m_blocks[first].begin() + 128);
+    EXPECT_EQ(Expected(curbes), block);
+    EXPECT_EQ(0u, m_lateWrites);
+}
+
+TEST_F(CurbeCacheTest, ReloadedCurbeIsZeroPadded)
+{
+    std::vector<std::vector<uint8_t>> curbes = {Curbe(100, 7)};
+
+    // CM rewinds the CURBE offset and loads again at the same place
+    for (uint32_t frame = 0; frame < 2; frame++)
+    {
+        Begin();
+        Load(Curbe(128, 8));
+        m_current = 0;
+        Load(curbes[0]);
+        SendCurbeLoad();
+        EXPECT_EQ(Expected(curbes), Submit()) << "frame " << frame;
+    }
+}
@@ -0,0 +1,405 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "renderhal_sampler_avs_template.h"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+// Mirrors of the MHW AVS param/table structs (same member order and types, so
+// MHW_SAMPLER_STATE_AVS_PARAM padding sits at the same offsets)
+struct AvsCoeff
+{
+    int8_t ZeroXFilterCoefficient[8];
+    int8_t ZeroYFilterCoefficient[8];
+    int8_t OneXFilterCoefficient[4];
+    int8_t OneYFilterCoefficient[4];
+};
+
+struct AvsTable
+{
+    AvsCoeff paMhwAvsCoeffParam[17];
+    uint8_t  byteTransitionArea8Pixels;
+    uint8_t  byteTransitionArea4Pixels;
+    uint8_t  byteMaxDerivative8Pixels;
+    uint8_t  byteMaxDerivative4Pixels;
+    uint8_t  byteDefaultSharpnessLevel;
+    bool     bEnableRGBAdaptive;
+    bool     bAdaptiveFilterAllChannels;
+    bool     bBypassYAdaptiveFiltering;
+    bool     bBypassXAdaptiveFiltering;
+    bool     b8TapAdaptiveEnable;
+    bool     b4TapGY;
+    bool     b4TapRBUV;
+    bool     bIsCoeffExtraEnabled;
+    AvsCoeff paMhwAvsCoeffParamExtra[15];
+};
+
+struct AvsParam
+{
+    int16_t   stateID;
+    bool      bEnableSTDE;
+    bool      b8TapAdaptiveEnable;
+    bool      bSkinDetailFactor;
+    bool      bHdcDwEnable;
+    bool      bWritebackStandard;
+    bool      bEnableIEF;
+    uint16_t  wIEFFactor;
+    uint16_t  wR3xCoefficient;
+    uint16_t  wR3cCoefficient;
+    uint16_t  wR5xCoefficient;
+    uint16_t  wR5cxCoefficient;
+    uint16_t  wR5cCoefficient;
+    bool      bEnableAVS;
+    bool      AvsType;
+    bool      EightTapAFEnable;
+    bool      BypassIEF;
+    uint16_t  GainFactor;
+    uint8_t   GlobalNoiseEstm;
+    uint8_t   StrongEdgeThr;
+    uint8_t   WeakEdgeThr;
+    uint8_t   StrongEdgeWght;
+    uint8_t   RegularWght;
+    uint8_t   NonEdgeWght;
+    bool      b8TapLumaForYUV444;
+    uint16_t  AdditionalOverridesUsed;
+    uint16_t  YSlope2;
+    uint16_t  S0L;
+    uint16_t  YSlope1;
+    uint16_t  S2U;
+    uint16_t  S1U;
+    AvsTable  *pMhwSamplerAvsTableParam;
+    int32_t   iTable8x8_Index;
+    void      *pTable8x8_Ptr;
+    uint32_t  dwTable8x8_Offset;
+};
+
+struct AvsTemplate
+{
+    uint64_t ui64Key;
+    uint32_t dwRefresh;
+    AvsParam Params;
+    AvsTable Table;
+    uint8_t  SamplerState[1280];
+};
+
+struct AvsTemplateCache
+{
+    uint32_t    dwRefresh;
+    uint32_t    dwHits;
+    uint32_t    dwMisses;
+    uint64_t    ui64BytesReused;
+    AvsTemplate Template[8];
+};
+
+// Gen9+ SAMPLER_STATE_8x8_AVS: 16 DWs of state + 17 + 15 tables of 8 DWs
+static const uint32_t kAvsStateSize = 16 * 4 + 32 * 8 * 4;
+
+// Stand-in for MHW packing: every keyed field lands in the state, nothing else
+static uint32_t g_packs = 0;
+
+static MOS_STATUS FakePack(const AvsParam &p, const AvsTable &t, uint8_t *pState)
+{
+    uint32_t n = 0;
+    auto put = [&](const void *pField, size_t size) {
+        memcpy(pState + n, pField, size);
+        n += (uint32_t)size;
+    };
+    const bool b[] = {p.bEnableSTDE, p.b8TapAdaptiveEnable, p.bSkinDetailFactor, p.bHdcDwEnable,
+        p.bWritebackStandard, p.bEnableIEF, p.bEnableAVS, p.AvsType, p.EightTapAFEnable, p.BypassIEF,
+        p.b8TapLumaForYUV444, t.bEnableRGBAdaptive, t.bAdaptiveFilterAllChannels,
+        t.bBypassYAdaptiveFiltering, t.bBypassXAdaptiveFiltering, t.b8TapAdaptiveEnable, t.b4TapGY,
+        t.b4TapRBUV, t.bIsCoeffExtraEnabled};
+    const uint16_t w[] = {p.wIEFFactor, p.wR3xCoefficient, p.wR3cCoefficient, p.wR5xCoefficient,
+        p.wR5cxCoefficient, p.wR5cCoefficient, p.GainFactor, p.AdditionalOverridesUsed, p.YSlope2,
+        p.S0L, p.YSlope1, p.S2U, p.S1U};
+    const uint8_t c[] = {p.GlobalNoiseEstm, p.StrongEdgeThr, p.WeakEdgeThr, p.StrongEdgeWght,
+        p.RegularWght, p.NonEdgeWght, t.byteTransitionArea8Pixels, t.byteTransitionArea4Pixels,
+        t.byteMaxDerivative8Pixels, t.byteMaxDerivative4Pixels, t.byteDefaultSharpnessLevel};
+    put(b, sizeof(b));
+    put(w, sizeof(w));
+    put(c, sizeof(c));
+    n = 64;
+    put(t.paMhwAvsCoeffParam, sizeof(t.paMhwAvsCoeffParam));
+    put(t.paMhwAvsCoeffParamExtra, sizeof(t.paMhwAvsCoeffParamExtra));
+    g_packs++;
+    return (n <= kAvsStateSize) ? MOS_STATUS_SUCCESS : MOS_STATUS_UNKNOWN;
+}
+
+// Scaling dependent params/table, built into storage that starts out as 'fill'
+static void BuildAvs(AvsParam &p, AvsTable &t, uint8_t fill, int scale)
+{
+    memset(&p, fill, sizeof(p));
+    memset(&t, fill, sizeof(t));
+
+    p.stateID = 0; p.bEnableSTDE = false; p.b8TapAdaptiveEnable = true; p.bSkinDetailFactor = false;
+    p.bHdcDwEnable = true; p.bWritebackStandard = true; p.bEnableIEF = false; p.wIEFFactor = 0;
+    p.wR3xCoefficient = 6; p.wR3cCoefficient = 15; p.wR5xCoefficient = 9; p.wR5cxCoefficient = 8;
+    p.wR5cCoefficient = 3; p.bEnableAVS = true; p.AvsType = false; p.EightTapAFEnable = true;
+    p.BypassIEF = true; p.GainFactor = 44; p.GlobalNoiseEstm = 255; p.StrongEdgeThr = 8;
+    p.WeakEdgeThr = 1; p.StrongEdgeWght = 7; p.RegularWght = 2; p.NonEdgeWght = 1;
+    p.b8TapLumaForYUV444 = false; p.AdditionalOverridesUsed = 0; p.YSlope2 = 31; p.S0L = 2043;
+    p.YSlope1 = 31; p.S2U = 1456; p.S1U = 113;
+    p.pMhwSamplerAvsTableParam = &t; p.iTable8x8_Index = 0; p.pTable8x8_Ptr = nullptr;
+    p.dwTable8x8_Offset = 0;
+
+    for (int i = 0; i < 17; i++)
+    {
+        for (int j = 0; j < 8; j++)
+        {
+            t.paMhwAvsCoeffParam[i].ZeroXFilterCoefficient[j] = (int8_t)((i * 7 + j * scale) & 0x3f);
+            t.paMhwAvsCoeffParam[i].ZeroYFilterCoefficient[j] = (int8_t)((i * 5 - j * scale) & 0x3f);
+        }
+        for (int j = 0; j < 4; j++)
+        {
+            t.paMhwAvsCoeffParam[i].OneXFilterCoefficient[j] = (int8_t)((i + j + scale) & 0x1f);
+            t.paMhwAvsCoeffParam[i].OneYFilterCoefficient[j] = (int8_t)((i - j + scale) & 0x1f);
+        }
+    }
+    for (int i = 0; i < 15; i++)
+    {
+        t.paMhwAvsCoeffParamExtra[i] = t.paMhwAvsCoeffParam[(i + scale) % 17];
+    }
+    t.byteTransitionArea8Pixels = 5; t.byteTransitionArea4Pixels = 4;
+    t.byteMaxDerivative8Pixels = 20; t.byteMaxDerivative4Pixels = 7;
+    t.byteDefaultSharpnessLevel = (uint8_t)(scale & 0xff); t.bEnableRGBAdaptive = false;
+    t.bAdaptiveFilterAllChannels = false; t.bBypassYAdaptiveFiltering = true;
+    t.bBypassXAdaptiveFiltering = true; t.b8TapAdaptiveEnable = false; t.b4TapGY = false;
+    t.b4TapRBUV = false; t.bIsCoeffExtraEnabled = true;
+}
+
+class SamplerAvsTemplateTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        memset(&m_cache, 0, sizeof(m_cache));
+        g_packs = 0;
+    }
+
+    MOS_STATUS Set(uint8_t *pSampler, const AvsParam &p, const AvsTable &t)
+    {
+        return RenderHal_SetSamplerStateAvsFromTemplates(&m_cache, pSampler, kAvsStateSize, p, t,
+            [&](uint8_t *pState) { return FakePack(p, t, pState); });
+    }
+
+    AvsTemplateCache m_cache;
+};
+
+TEST(SamplerAvsTemplateKeyTest, PaddingDoesNotAffectKeyOrMatch)
+{
+    static_assert(offsetof(AvsParam, AdditionalOverridesUsed) >
+                      offsetof(AvsParam, b8TapLumaForYUV444) + sizeof(bool),
+                  "mirror struct must carry the padding byte of the MHW struct");
+
+    AvsParam p0, p1;
+    AvsTable t0, t1;
+    BuildAvs(p0, t0, 0xaa, 3);
+    BuildAvs(p1, t1, 0x55, 3);
+    ASSERT_NE(0, memcmp(&p0, &p1, sizeof(p0)));
+
+    // Placement and table pointer are not keyed either
+    p1.stateID           = 5;
+    p1.iTable8x8_Index   = 2;
+    p1.pTable8x8_Ptr     = &p1;
+    p1.dwTable8x8_Offset = 0x1000;
+
+    EXPECT_EQ(RenderHal_GetSamplerAvsTemplateKey(p0, t0), RenderHal_GetSamplerAvsTemplateKey(p1, t1));
+    EXPECT_TRUE(RenderHal_IsSameSamplerAvsTemplate(p0, t0, p1, t1));
+}
+
+TEST(SamplerAvsTemplateKeyTest, EveryPackedFieldIsKeyed)
+{
+    typedef std::function<void(AvsParam &, AvsTable &)> Flip;
+    const std::vector<Flip> flips = {
+        [](AvsParam &p, AvsTable &) { p.bEnableSTDE = !p.bEnableSTDE; },
+        [](AvsParam &p, AvsTable &) { p.b8TapAdaptiveEnable = !p.b8TapAdaptiveEnable; },
+        [](AvsParam &p, AvsTable &) { p.bSkinDetailFactor = !p.bSkinDetailFactor; },
+        [](AvsParam &p, AvsTable &) { p.bHdcDwEnable = !p.bHdcDwEnable; },
+        [](AvsParam &p, AvsTable &) { p.bWritebackStandard = !p.bWritebackStandard; },
+        [](AvsParam &p, AvsTable &) { p.bEnableIEF = !p.bEnableIEF; },
+        [](AvsParam &p, AvsTable &) { p.wIEFFactor++; },
+        [](AvsParam &p, AvsTable &) { p.wR3xCoefficient++; },
+        [](AvsParam &p, AvsTable &) { p.wR3cCoefficient++; },
+        [](AvsParam &p, AvsTable &) { p.wR5xCoefficient++; },
+        [](AvsParam &p, AvsTable &) { p.wR5cxCoefficient++; },
+        [](AvsParam &p, AvsTable &) { p.wR5cCoefficient++; },
+        [](AvsParam &p, AvsTable &) { p.bEnableAVS = !p.bEnableAVS; },
+        [](AvsParam &p, AvsTable &) { p.AvsType = !p.AvsType; },
+        [](AvsParam &p, AvsTable &) { p.EightTapAFEnable = !p.EightTapAFEnable; },
+        [](AvsParam &p, AvsTable &) { p.BypassIEF = !p.BypassIEF; },
+        [](AvsParam &p, AvsTable &) { p.GainFactor++; },
+        [](AvsParam &p, AvsTable &) { p.GlobalNoiseEstm--; },
+        [](AvsParam &p, AvsTable &) { p.StrongEdgeThr++; },
+        [](AvsParam &p, AvsTable &) { p.WeakEdgeThr++; },
+        [](AvsParam &p, AvsTable &) { p.StrongEdgeWght++; },
+        [](AvsParam &p, AvsTable &) { p.RegularWght++; },
+        [](AvsParam &p, AvsTable &) { p.NonEdgeWght++; },
+        [](AvsParam &p, AvsTable &) { p.b8TapLumaForYUV444 = !p.b8TapLumaForYUV444; },
+        [](AvsParam &p, AvsTable &) { p.AdditionalOverridesUsed++; },
+        [](AvsParam &p, AvsTable &) { p.YSlope2++; },
+        [](AvsParam &p, AvsTable &) { p.S0L++; },
+        [](AvsParam &p, AvsTable &) { p.YSlope1++; },
+        [](AvsParam &p, AvsTable &) { p.S2U++; },
+        [](AvsParam &p, AvsTable &) { p.S1U++; },
+        [](AvsParam &, AvsTable &t) { t.paMhwAvsCoeffParam[0].ZeroXFilterCoefficient[0]++; },
+        [](AvsParam &, AvsTable &t) { t.paMhwAvsCoeffParam[16].OneYFilterCoefficient[3]++; },
+        [](AvsParam &, AvsTable &t) { t.byteTransitionArea8Pixels++; },
+        [](AvsParam &, AvsTable &t) { t.byteTransitionArea4Pixels++; },
+        [](AvsParam &, AvsTable &t) { t.byteMaxDerivative8Pixels++; },
+        [](AvsParam &, AvsTable &t) { t.byteMaxDerivative4Pixels++; },
+        [](AvsParam &, AvsTable &t) { t.byteDefaultSharpnessLevel++; },
+        [](AvsParam &, AvsTable &t) { t.bEnableRGBAdaptive = !t.bEnableRGBAdaptive; },
+        [](AvsParam &, AvsTable &t) { t.bAdaptiveFilterAllChannels = !t.bAdaptiveFilterAllChannels; },
+        [](AvsParam &, AvsTable &t) { t.bBypassYAdaptiveFiltering = !t.bBypassYAdaptiveFiltering; },
+        [](AvsParam &, AvsTable &t) { t.bBypassXAdaptiveFiltering = !t.bBypassXAdaptiveFiltering; },
+        [](AvsParam &, AvsTable &t) { t.b8TapAdaptiveEnable = !t.b8TapAdaptiveEnable; },
+        [](AvsParam &, AvsTable &t) { t.b4TapGY = !t.b4TapGY; },
+        [](AvsParam &, AvsTable &t) { t.b4TapRBUV = !t.b4TapRBUV; },
+        [](AvsParam &, AvsTable &t) { t.bIsCoeffExtraEnabled = !t.bIsCoeffExtraEnabled; },
+        [](AvsParam &, AvsTable &t) { t.paMhwAvsCoeffParamExtra[0].ZeroYFilterCoefficient[0]++; },
+        [](AvsParam &, AvsTable &t) { t.paMhwAvsCoeffParamExtra[14].OneXFilterCoefficient[3]++; },
+    };
+
+    AvsParam p0, p1;
+    AvsTable t0, t1;
+    BuildAvs(p0, t0, 0, 3);
+    uint64_t key0 = RenderHal_GetSamplerAvsTemplateKey(p0, t0);
+
+    for (size_t i = 0; i < flips.size(); i++)
+    {
+        BuildAvs(p1, t1, 0, 3);
+        flips[i](p1, t1);
+        EXPECT_FALSE(RenderHal_IsSameSamplerAvsTemplate(p0, t0, p1, t1)) << "flip " << i;
+        EXPECT_NE(key0, RenderHal_GetSamplerAvsTemplateKey(p1, t1)) << "flip " << i;
+    }
+}
+
+TEST_F(SamplerAvsTemplateTest, CachedStateMatchesDirectPacking)
+{
+    AvsParam p;
+    AvsTable t;
+    uint8_t  direct[kAvsStateSize];
+    uint8_t  cached[kAvsStateSize];
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (int scale = 0; scale < 12; scale++)
+        {
+            BuildAvs(p, t, (uint8_t)(pass ? 0x55 : 0xaa), scale);
+            memset(direct, 0, sizeof(direct));
+            ASSERT_EQ(MOS_STATUS_SUCCESS, FakePack(p, t, direct));
+
+            memset(cached, 0xcd, sizeof(cached));
+            ASSERT_EQ(MOS_STATUS_SUCCESS, Set(cached, p, t));
+            EXPECT_EQ(0, memcmp(direct, cached, sizeof(direct))) << "pass " << pass << " scale " << scale;
+        }
+    }
+
+    // 12 scalings cycled through 8 LRU templates never hit
+    EXPECT_EQ(0u, m_cache.dwHits);
+    EXPECT_EQ(24u, m_cache.dwMisses);
+}
+
+TEST_F(SamplerAvsTemplateTest, PackFailureLeavesNoTemplate)
+{
+    AvsParam p;
+    AvsTable t;
+    uint8_t  state[kAvsStateSize];
+    BuildAvs(p, t, 0, 1);
+
+    auto fail = [](uint8_t *) { return MOS_STATUS_INVALID_PARAMETER; };
+    EXPECT_EQ(MOS_STATUS_INVALID_PARAMETER,
+              RenderHal_SetSamplerStateAvsFromTemplates(&m_cache, state, kAvsStateSize, p, t, fail));
+    for (auto &tmpl : m_cache.Template)
+    {
+        EXPECT_EQ(0u, tmpl.ui64Key);
+    }
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, Set(state, p, t));
+    EXPECT_EQ(1u, g_packs);
+}
+
+// 4 layer composition: main video and PIP use their own scaling, two overlays
+// share one. The main video resizes every 100 frames.
+TEST_F(SamplerAvsTemplateTest, CompositionTraceReusesPackedState)
+{
+    const int frames = 300;
+    const int layers = 4;
+    uint8_t   cached[kAvsStateSize];
+    uint8_t   direct[kAvsStateSize];
+    uint32_t  calls = 0;
+
+    auto scaleOf = [](int frame, int layer) {
+        switch (layer)
+        {
+        case 0:  return 1 + frame / 100;
+        case 1:  return 7;
+        default: return 9;
+        }
+    };
+
+    std::vector<AvsParam> params(frames * layers);
+    std::vector<AvsTable> tables(frames * layers);
+    for (int frame = 0; frame < frames; frame++)
+    {
+        for (int layer = 0; layer < layers; layer++)
+        {
+            BuildAvs(params[calls], tables[calls], (uint8_t)(frame + layer), scaleOf(frame, layer));
+            calls++;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < calls; i++)
+    {
+        ASSERT_EQ(MOS_STATUS_SUCCESS, Set(cached, params[i], tables[i]));
+    }
+    auto cachedTime = std::chrono::steady_clock::now() - start;
+    uint32_t packs  = g_packs;
+
+    // 3 main video scalings + PIP + shared overlay scaling
+    EXPECT_EQ(5u, packs);
+    EXPECT_EQ(calls - packs, m_cache.dwHits);
+    EXPECT_EQ((uint64_t)(calls - packs) * kAvsStateSize, m_cache.ui64BytesReused);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < calls; i++)
+    {
+        memset(direct, 0, sizeof(direct));
+        ASSERT_EQ(MOS_STATUS_SUCCESS, FakePack(params[i], tables[i], direct));
+    }
+    auto directTime = std::chrono::steady_clock::now() - start;
+
+    using ns = std::chrono::nanoseconds;
+    std::cout << "[ AVS      ] " << calls << " sampler states, " << packs << " packed, "
+              << m_cache.dwHits << " copied from templates ("
+              << m_cache.ui64BytesReused << " packed bytes reused). GSH bytes saved: 0, "
+              << "each media ID keeps its own sampler area" << std::endl;
+    std::cout << "[ AVS      ] template path "
+              << (double)std::chrono::duration_cast<ns>(cachedTime).count() / calls
+              << " ns/state (key + compare + copy), flat copy stand-in packer "
+              << (double)std::chrono::duration_cast<ns>(directTime).count() / calls
+              << " ns/state" << std::endl;
+}
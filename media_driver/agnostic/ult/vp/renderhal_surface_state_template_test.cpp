@@ -0,0 +1,879 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "renderhal_surface_state_template.h"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+// Mirrors of MOS_SURFACE, RENDERHAL_SURFACE, RENDERHAL_SURFACE_STATE_PARAMS and the
+// template structs (same members, enums replaced by their underlying int)
+struct SsRect
+{
+    int32_t left;
+    int32_t top;
+    int32_t right;
+    int32_t bottom;
+};
+
+struct SsResource
+{
+    void     *pGmmResInfo;
+    uint32_t handle;
+};
+
+struct SsOsSurface
+{
+    SsResource       OsResource;
+    uint32_t         dwArraySlice;
+    uint32_t         dwMipSlice;
+    int32_t          S3dChannel;
+    int32_t          Type;
+    int32_t          bOverlay;
+    int32_t          bFlipChain;
+    uint32_t         dwWidth;
+    uint32_t         dwHeight;
+    uint32_t         dwSize;
+    uint32_t         dwDepth;
+    uint32_t         dwArraySize;
+    uint32_t         dwLockPitch;
+    uint32_t         dwPitch;
+    uint32_t         dwSlicePitch;
+    uint32_t         dwQPitch;
+    int32_t          TileType;
+    int32_t          Format;
+    int32_t          bArraySpacing;
+    int32_t          bCompressible;
+    uint32_t         dwOffset;
+    MOS_PLANE_OFFSET YPlaneOffset;
+    MOS_PLANE_OFFSET UPlaneOffset;
+    MOS_PLANE_OFFSET VPlaneOffset;
+    union
+    {
+        struct
+        {
+            MOS_RESOURCE_OFFSETS Y;
+            MOS_RESOURCE_OFFSETS U;
+            MOS_RESOURCE_OFFSETS V;
+        } YUV;
+        MOS_RESOURCE_OFFSETS RGB;
+    } RenderOffset;
+    union
+    {
+        struct
+        {
+            uint32_t Y;
+            uint32_t U;
+            uint32_t V;
+        } YUV;
+        uint32_t RGB;
+    } LockOffset;
+    int32_t          bIsCompressed;
+    int32_t          CompressionMode;
+    uint32_t         CompressionFormat;
+    int32_t          MmcState;
+    int32_t          TileModeGMM;
+    bool             bGMMTileEnabled;
+    uint32_t         YoffsetForUplane;
+    uint32_t         YoffsetForVplane;
+};
+
+struct SsSurface
+{
+    SsOsSurface OsSurface;
+    int32_t     SurfType;
+    int32_t     ScalingMode;
+    int32_t     Rotation;
+    uint32_t    ChromaSiting;
+    SsRect      rcSrc;
+    SsRect      rcDst;
+    SsRect      rcMaxSrc;
+    bool        bDeinterlaceEnable;
+    bool        bQueryVariance;
+    bool        bInterlacedScaling;
+    void        *pDeinterlaceParams;
+    int32_t     SampleType;
+    int32_t     iPaletteID;
+    uint32_t    dwWidthInUse;
+    uint32_t    dwHeightInUse;
+};
+
+struct SsParams
+{
+    uint32_t Type                      : 5;
+    uint32_t bRenderTarget             : 1;
+    uint32_t bVertStride               : 1;
+    uint32_t bVertStrideOffs           : 1;
+    uint32_t bWidthInDword_Y           : 1;
+    uint32_t bWidthInDword_UV          : 1;
+    uint32_t bAVS                      : 1;
+    uint32_t Boundary                  : 3;
+    uint32_t bWidth16Align             : 1;
+    uint32_t b2PlaneNV12NeededByKernel : 1;
+    uint32_t bForceNV12                : 1;
+    uint32_t bUseSinglePlane           : 1;
+    uint32_t b32MWColorFillKern        : 1;
+    uint32_t bVASurface                : 1;
+    uint32_t AddressControl            : 2;
+    uint32_t bWAUseSrcHeight           : 1;
+    uint32_t bWAUseSrcWidth            : 1;
+    uint32_t bForce3DLUTR16G16         : 1;
+    uint32_t bChromasiting             : 1;
+    uint32_t bVmeUse                   : 1;
+    uint32_t bBufferUse                : 1;
+    uint32_t : 3;
+    int32_t  MemObjCtl;
+};
+
+struct SsKey
+{
+    void                 *pGmmResInfo;
+    uint64_t             ui64AllocSize;
+    uint32_t             dwArraySlice;
+    uint32_t             dwMipSlice;
+    int32_t              S3dChannel;
+    int32_t              Type;
+    int32_t              bOverlay;
+    int32_t              bFlipChain;
+    uint32_t             dwWidth;
+    uint32_t             dwHeight;
+    uint32_t             dwSize;
+    uint32_t             dwDepth;
+    uint32_t             dwArraySize;
+    uint32_t             dwLockPitch;
+    uint32_t             dwPitch;
+    uint32_t             dwSlicePitch;
+    uint32_t             dwQPitch;
+    int32_t              TileType;
+    int32_t              Format;
+    int32_t              bArraySpacing;
+    int32_t              bCompressible;
+    uint32_t             dwOffset;
+    MOS_PLANE_OFFSET     YPlaneOffset;
+    MOS_PLANE_OFFSET     UPlaneOffset;
+    MOS_PLANE_OFFSET     VPlaneOffset;
+    MOS_RESOURCE_OFFSETS RenderOffset[3];
+    uint32_t             LockOffset[3];
+    int32_t              bIsCompressed;
+    int32_t              CompressionMode;
+    uint32_t             CompressionFormat;
+    int32_t              MmcState;
+    int32_t              TileModeGMM;
+    uint32_t             bGMMTileEnabled;
+    uint32_t             YoffsetForUplane;
+    uint32_t             YoffsetForVplane;
+    int32_t              SurfType;
+    int32_t              ScalingMode;
+    int32_t              Rotation;
+    uint32_t             ChromaSiting;
+    SsRect               rcSrc;
+    SsRect               rcDst;
+    SsRect               rcMaxSrc;
+    uint32_t             bDeinterlaceEnable;
+    uint32_t             bQueryVariance;
+    uint32_t             bInterlacedScaling;
+    uint32_t             bDeinterlaceParams;
+    int32_t              SampleType;
+    int32_t              iPaletteID;
+    uint32_t             dwWidthInUse;
+    uint32_t             dwHeightInUse;
+    uint32_t             bEnableYV12SinglePass;
+    uint32_t             bEnableP010SinglePass;
+    SsParams             Params;
+};
+
+struct SsOutput
+{
+    uint32_t dwWidth;
+    uint32_t dwHeight;
+    SsRect   rcSrc;
+    SsRect   rcDst;
+    int32_t  ScalingMode;
+};
+
+struct SsEntry
+{
+    int32_t     Type;
+    SsOsSurface *pSurface;
+    uint8_t     *pSurfaceState;
+    uint64_t    SurfaceToken;
+    int32_t     iSurfStateID;
+    uint32_t    dwSurfStateOffset;
+    uint32_t    dwFormat;
+    uint32_t    dwWidth;
+    uint32_t    dwHeight;
+    uint32_t    dwPitch;
+    uint32_t    dwQPitch;
+    uint32_t    YUVPlane          : 2;
+    uint32_t    bAVS              : 1;
+    uint32_t    bRenderTarget     : 1;
+    uint32_t    bVertStride       : 1;
+    uint32_t    bVertStrideOffs   : 1;
+    uint32_t    bWidthInDword     : 1;
+    uint32_t    bTiledSurface     : 1;
+    uint32_t    bTileWalk         : 1;
+    uint32_t    bHalfPitchChroma  : 1;
+    uint32_t    bInterleaveChroma : 1;
+    uint32_t    DirectionV        : 3;
+    uint32_t    DirectionU        : 1;
+    uint32_t    AddressControl    : 2;
+    uint32_t    : 15;
+    uint16_t    wUXOffset;
+    uint16_t    wUYOffset;
+    uint16_t    wVXOffset;
+    uint16_t    wVYOffset;
+};
+
+const int      kMaxPlanes = 3;
+const uint32_t kStateSize = 64;
+
+struct SsTemplate
+{
+    SsKey    Key;
+    uint32_t dwRefresh;
+    uint32_t dwHits;
+    int32_t  iNumEntries;
+    SsOutput Output;
+    SsEntry  Entry[kMaxPlanes];
+    uint8_t  SurfaceState[kMaxPlanes][kStateSize];
+};
+
+struct SsCache
+{
+    uint32_t   dwRefresh;
+    uint32_t   dwHits;
+    uint32_t   dwMisses;
+    uint32_t   dwInvalidated;
+    uint32_t   dwVerified;
+    uint32_t   dwVerifyInterval;
+    bool       bDisabled;
+    SsTemplate Template[32];
+};
+
+enum
+{
+    kFormatARGB = 1,
+    kFormatNV12 = 2,
+    kFormatYV12 = 3,
+    kFormatP010 = 4,
+};
+
+// Render Hal state read by the plane selection
+struct RenderHal
+{
+    bool bEnableYV12SinglePass;
+    bool bEnableP010SinglePass;
+};
+
+// One SSH slot per plane, as handed out by pfnAssignSurfaceState
+struct StateSlots
+{
+    SsOsSurface surface[kMaxPlanes];
+    uint8_t     state[kMaxPlanes][kStateSize];
+    SsEntry     entry[kMaxPlanes];
+    SsEntry     *pEntries[kMaxPlanes];
+    int32_t     next;
+
+    void Reset()
+    {
+        memset(this, 0, sizeof(*this));
+        for (int i = 0; i < kMaxPlanes; i++)
+        {
+            pEntries[i] = nullptr;
+        }
+    }
+
+    SsEntry *Assign()
+    {
+        SsEntry *pEntry       = &entry[next];
+        pEntry->pSurface      = &surface[next];
+        pEntry->pSurfaceState = state[next];
+        pEntry->iSurfStateID  = next;
+        next++;
+        return pEntry;
+    }
+};
+
+static uint32_t g_builds = 0;
+
+static void Mix(uint64_t &h, const void *p, size_t size)
+{
+    const uint8_t *b = (const uint8_t *)p;
+    for (size_t i = 0; i < size; i++)
+    {
+        h = (h ^ b[i]) * 0x100000001b3ULL;
+    }
+}
+
+#define MIX(h, v)                      \
+    {                                  \
+        auto value = (v);              \
+        Mix(h, &value, sizeof(value)); \
+    }
+
+// Hash of every surface state input, written independently of the key under test
+static uint64_t HashInputs(const SsSurface &s, const SsParams &p, const RenderHal &hal, uint64_t allocSize)
+{
+    const SsOsSurface &o = s.OsSurface;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    MIX(h, o.OsResource.pGmmResInfo); MIX(h, allocSize);
+    MIX(h, o.dwArraySlice); MIX(h, o.dwMipSlice); MIX(h, o.S3dChannel); MIX(h, o.Type);
+    MIX(h, o.bOverlay); MIX(h, o.bFlipChain); MIX(h, o.dwWidth); MIX(h, o.dwHeight); MIX(h, o.dwSize);
+    MIX(h, o.dwDepth); MIX(h, o.dwArraySize); MIX(h, o.dwLockPitch); MIX(h, o.dwPitch);
+    MIX(h, o.dwSlicePitch); MIX(h, o.dwQPitch); MIX(h, o.TileType); MIX(h, o.Format);
+    MIX(h, o.bArraySpacing); MIX(h, o.bCompressible); MIX(h, o.dwOffset);
+    for (const MOS_PLANE_OFFSET *po : {&o.YPlaneOffset, &o.UPlaneOffset, &o.VPlaneOffset})
+    {
+        MIX(h, po->iSurfaceOffset); MIX(h, po->iXOffset); MIX(h, po->iYOffset); MIX(h, po->iLockSurfaceOffset);
+    }
+    for (const MOS_RESOURCE_OFFSETS *ro : {&o.RenderOffset.YUV.Y, &o.RenderOffset.YUV.U, &o.RenderOffset.YUV.V})
+    {
+        MIX(h, ro->BaseOffset); MIX(h, ro->XOffset); MIX(h, ro->YOffset);
+    }
+    MIX(h, o.LockOffset.YUV.Y); MIX(h, o.LockOffset.YUV.U); MIX(h, o.LockOffset.YUV.V);
+    MIX(h, o.bIsCompressed); MIX(h, o.CompressionMode); MIX(h, o.CompressionFormat); MIX(h, o.MmcState);
+    MIX(h, o.TileModeGMM); MIX(h, o.bGMMTileEnabled); MIX(h, o.YoffsetForUplane); MIX(h, o.YoffsetForVplane);
+
+    MIX(h, s.SurfType); MIX(h, s.ScalingMode); MIX(h, s.Rotation); MIX(h, s.ChromaSiting);
+    for (const SsRect *r : {&s.rcSrc, &s.rcDst, &s.rcMaxSrc})
+    {
+        MIX(h, r->left); MIX(h, r->top); MIX(h, r->right); MIX(h, r->bottom);
+    }
+    MIX(h, s.bDeinterlaceEnable); MIX(h, s.bQueryVariance); MIX(h, s.bInterlacedScaling);
+    MIX(h, s.pDeinterlaceParams != nullptr); MIX(h, s.SampleType); MIX(h, s.iPaletteID);
+    MIX(h, s.dwWidthInUse); MIX(h, s.dwHeightInUse);
+    MIX(h, hal.bEnableYV12SinglePass); MIX(h, hal.bEnableP010SinglePass);
+
+    MIX(h, p.Type); MIX(h, p.bRenderTarget); MIX(h, p.bVertStride); MIX(h, p.bVertStrideOffs);
+    MIX(h, p.bWidthInDword_Y); MIX(h, p.bWidthInDword_UV); MIX(h, p.bAVS); MIX(h, p.Boundary);
+    MIX(h, p.bWidth16Align); MIX(h, p.b2PlaneNV12NeededByKernel); MIX(h, p.bForceNV12);
+    MIX(h, p.bUseSinglePlane); MIX(h, p.b32MWColorFillKern); MIX(h, p.bVASurface);
+    MIX(h, p.AddressControl); MIX(h, p.bWAUseSrcHeight); MIX(h, p.bWAUseSrcWidth);
+    MIX(h, p.bForce3DLUTR16G16); MIX(h, p.bChromasiting); MIX(h, p.bVmeUse); MIX(h, p.bBufferUse);
+    MIX(h, p.MemObjCtl);
+    return h;
+}
+
+// Stand-in for pfnSetupSurfaceState: plane selection depends on format, params and
+// RenderHal settings, the packed P010 path rewrites the caller's surface like
+// RenderHal_GetSurfaceStateEntries does, and the state bytes depend on every input
+static int32_t FakeSetupSurfaceState(
+    const RenderHal &hal,
+    SsSurface       *pSurface,
+    const SsParams  &params,
+    uint64_t        allocSize,
+    StateSlots      *pSlots)
+{
+    SsOsSurface &o = pSurface->OsSurface;
+    uint64_t    h  = HashInputs(*pSurface, params, hal, allocSize);
+    int32_t     planes;
+
+    g_builds++;
+    switch (o.Format)
+    {
+    case kFormatNV12:
+        planes = params.bUseSinglePlane ? 1 : 2;
+        break;
+    case kFormatYV12:
+        planes = (hal.bEnableYV12SinglePass && !pSurface->pDeinterlaceParams) ? 1 : 3;
+        break;
+    case kFormatP010:
+        planes = 2;
+        if (params.bAVS && !hal.bEnableP010SinglePass)
+        {
+            o.dwWidth              = o.dwWidth * 2;
+            o.dwHeight             = o.dwHeight / 2;
+            pSurface->rcSrc.right  = o.dwWidth;
+            pSurface->rcSrc.bottom = o.dwHeight;
+            pSurface->rcDst        = pSurface->rcSrc;
+            pSurface->ScalingMode  = 1;
+            planes                 = 1;
+        }
+        break;
+    default:
+        planes = 1;
+        break;
+    }
+
+    for (int32_t i = 0; i < planes; i++)
+    {
+        SsEntry *pEntry          = pSlots->Assign();
+        pSlots->pEntries[i]    = pEntry;
+        *pEntry->pSurface      = o;
+        pEntry->Type           = params.Type;
+        pEntry->dwFormat       = (uint32_t)o.Format * 16 + i;
+        pEntry->dwWidth        = (o.dwWidth >> (i ? 1 : 0)) ? (o.dwWidth >> (i ? 1 : 0)) : 1;
+        pEntry->dwHeight       = (o.dwHeight >> (i ? 1 : 0)) ? (o.dwHeight >> (i ? 1 : 0)) : 1;
+        pEntry->dwPitch        = o.dwPitch;
+        pEntry->dwQPitch       = o.dwQPitch;
+        pEntry->YUVPlane       = i;
+        pEntry->bAVS           = params.bAVS;
+        pEntry->bRenderTarget  = params.bRenderTarget;
+        pEntry->bVertStride    = params.bVertStride;
+        pEntry->bTiledSurface  = o.TileType != 0;
+        pEntry->AddressControl = params.AddressControl;
+        pEntry->wUYOffset      = (uint16_t)o.UPlaneOffset.iYOffset;
+        for (uint32_t b = 0; b < kStateSize; b += sizeof(uint64_t))
+        {
+            uint64_t word = h ^ ((uint64_t)(i * kStateSize + b) * 0x9e3779b97f4a7c15ULL);
+            memcpy(pEntry->pSurfaceState + b, &word, sizeof(word));
+        }
+        // pfnSetupSurfaceStatesOs: token carries the resource
+        pEntry->SurfaceToken = o.OsResource.handle;
+    }
+    return planes;
+}
+
+// RenderHal_SetupSurfaceState with the template cache, driving the header the way
+// renderhal.cpp does
+static int32_t CachedSetupSurfaceState(
+    SsCache         *pCache,
+    const RenderHal &hal,
+    SsSurface       *pSurface,
+    const SsParams  &params,
+    uint64_t        allocSize,
+    StateSlots      *pSlots)
+{
+    SsKey      key;
+    SsTemplate *pTemplate = nullptr;
+    int32_t    planes;
+    bool       bTemplate  = pSurface->OsSurface.OsResource.pGmmResInfo != nullptr && !pCache->bDisabled;
+
+    if (bTemplate)
+    {
+        RenderHal_GetSurfaceStateTemplateKey(*pSurface, params, allocSize,
+            hal.bEnableYV12SinglePass, hal.bEnableP010SinglePass, &key);
+        pTemplate = RenderHal_FindSurfaceStateTemplate(pCache, key);
+        if (pTemplate)
+        {
+            pCache->dwHits++;
+            if (!RenderHal_IsSurfaceStateTemplateVerifyHit(pCache, pTemplate))
+            {
+                RenderHal_ApplySurfaceStateTemplateOutput(pTemplate->Output, pSurface);
+                for (int32_t i = 0; i < pTemplate->iNumEntries; i++)
+                {
+                    SsEntry     *pEntry = pSlots->Assign();
+                    SsOsSurface *pPlane = pEntry->pSurface;
+                    uint8_t     *pState = pEntry->pSurfaceState;
+                    int32_t     id      = pEntry->iSurfStateID;
+                    *pEntry             = pTemplate->Entry[i];
+                    *pPlane             = pSurface->OsSurface;
+                    pEntry->pSurface      = pPlane;
+                    pEntry->pSurfaceState = pState;
+                    pEntry->iSurfStateID  = id;
+                    memcpy(pState, pTemplate->SurfaceState[i], kStateSize);
+                    pEntry->SurfaceToken = pSurface->OsSurface.OsResource.handle;
+                    pSlots->pEntries[i]  = pEntry;
+                }
+                return pTemplate->iNumEntries;
+            }
+            pCache->dwVerified++;
+        }
+        else
+        {
+            pCache->dwMisses++;
+        }
+    }
+
+    planes = FakeSetupSurfaceState(hal, pSurface, params, allocSize, pSlots);
+
+    if (bTemplate && pTemplate == nullptr)
+    {
+        SsTemplate *pVictim = RenderHal_GetSurfaceStateTemplateVictim(pCache);
+        pVictim->iNumEntries = planes;
+        for (int32_t i = 0; i < planes; i++)
+        {
+            pVictim->Entry[i] = *pSlots->pEntries[i];
+            memcpy(pVictim->SurfaceState[i], pSlots->pEntries[i]->pSurfaceState, kStateSize);
+        }
+        RenderHal_SaveSurfaceStateTemplateOutput(*pSurface, &pVictim->Output);
+        pVictim->Key       = key;
+        pVictim->dwRefresh = pCache->dwRefresh++;
+        pVictim->dwHits    = 0;
+    }
+    else if (bTemplate)
+    {
+        bool same = pTemplate->iNumEntries == planes &&
+                    RenderHal_IsSameSurfaceStateTemplateOutput(pTemplate->Output, *pSurface);
+        for (int32_t i = 0; same && i < planes; i++)
+        {
+            same = RenderHal_IsSameSurfaceStateEntry(*pSlots->pEntries[i], pTemplate->Entry[i]) &&
+                   memcmp(pSlots->pEntries[i]->pSurfaceState, pTemplate->SurfaceState[i], kStateSize) == 0;
+        }
+        pCache->bDisabled = !same;
+    }
+    return planes;
+}
+
+static SsSurface MakeSurface(void *pGmm, uint32_t handle, int32_t format, uint32_t width, uint32_t height)
+{
+    SsSurface s;
+    memset(&s, 0, sizeof(s));
+    SsOsSurface &o                     = s.OsSurface;
+    o.OsResource.pGmmResInfo           = pGmm;
+    o.OsResource.handle                = handle;
+    o.Type                             = 1;
+    o.dwWidth                          = width;
+    o.dwHeight                         = height;
+    o.dwPitch                          = (width * 4 + 127) & ~127u;
+    o.dwLockPitch                      = o.dwPitch;
+    o.dwSize                           = o.dwPitch * height * 3 / 2;
+    o.dwDepth                          = 1;
+    o.TileType                         = 2;
+    o.Format                           = format;
+    o.UPlaneOffset.iSurfaceOffset      = (int)(o.dwPitch * height);
+    o.UPlaneOffset.iYOffset            = (int)height;
+    o.UPlaneOffset.iLockSurfaceOffset  = (int)(o.dwPitch * height);
+    o.RenderOffset.YUV.U.BaseOffset    = o.dwPitch * height;
+    o.LockOffset.YUV.U                 = o.dwPitch * height;
+    o.TileModeGMM                      = 3;
+    s.rcSrc                            = {0, 0, (int32_t)width, (int32_t)height};
+    s.rcDst                            = s.rcSrc;
+    s.rcMaxSrc                         = s.rcSrc;
+    s.ScalingMode                      = 2;
+    return s;
+}
+
+static SsParams MakeParams(bool bAVS)
+{
+    SsParams p;
+    memset(&p, 0, sizeof(p));
+    p.Type      = bAVS ? 3 : 1;
+    p.bAVS      = bAVS;
+    p.Boundary  = 1;
+    p.MemObjCtl = 0x20;
+    return p;
+}
+
+static SsKey GetKey(const SsSurface &s, const SsParams &p, const RenderHal &hal, uint8_t fill, uint64_t allocSize = 0x100000)
+{
+    SsKey key;
+    memset(&key, fill, sizeof(key));
+    RenderHal_GetSurfaceStateTemplateKey(s, p, allocSize, hal.bEnableYV12SinglePass, hal.bEnableP010SinglePass, &key);
+    return key;
+}
+
+TEST(SurfaceStateTemplateKeyTest, EveryInputIsKeyed)
+{
+    typedef std::function<void(SsSurface &, SsParams &, RenderHal &)> Flip;
+    const std::vector<Flip> flips = {
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.OsResource.pGmmResInfo = &s; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwArraySlice++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwMipSlice++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.S3dChannel++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.Type++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.bOverlay++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.bFlipChain++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwWidth++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwHeight++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwSize++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwDepth++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwArraySize++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwLockPitch++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwPitch++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwSlicePitch++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwQPitch++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.TileType++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.Format++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.bArraySpacing++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.bCompressible++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.dwOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.YPlaneOffset.iSurfaceOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.YPlaneOffset.iXOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.YPlaneOffset.iYOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.YPlaneOffset.iLockSurfaceOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.UPlaneOffset.iSurfaceOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.UPlaneOffset.iXOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.UPlaneOffset.iYOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.UPlaneOffset.iLockSurfaceOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.VPlaneOffset.iSurfaceOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.VPlaneOffset.iXOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.VPlaneOffset.iYOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.VPlaneOffset.iLockSurfaceOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.RenderOffset.YUV.Y.BaseOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.RenderOffset.YUV.Y.XOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.RenderOffset.YUV.U.YOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.RenderOffset.YUV.V.BaseOffset++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.LockOffset.YUV.Y++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.LockOffset.YUV.U++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.LockOffset.YUV.V++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.bIsCompressed++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.CompressionMode++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.CompressionFormat++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.MmcState++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.TileModeGMM++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.bGMMTileEnabled = !s.OsSurface.bGMMTileEnabled; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.YoffsetForUplane++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.OsSurface.YoffsetForVplane++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.SurfType++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.ScalingMode++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.Rotation++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.ChromaSiting++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.rcSrc.left++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.rcSrc.bottom++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.rcDst.top++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.rcDst.right++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.rcMaxSrc.right++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.rcMaxSrc.bottom++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.bDeinterlaceEnable = !s.bDeinterlaceEnable; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.bQueryVariance = !s.bQueryVariance; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.bInterlacedScaling = !s.bInterlacedScaling; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.pDeinterlaceParams = &s; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.SampleType++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.iPaletteID++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.dwWidthInUse++; },
+        [](SsSurface &s, SsParams &, RenderHal &) { s.dwHeightInUse++; },
+        [](SsSurface &, SsParams &, RenderHal &h) { h.bEnableYV12SinglePass = !h.bEnableYV12SinglePass; },
+        [](SsSurface &, SsParams &, RenderHal &h) { h.bEnableP010SinglePass = !h.bEnableP010SinglePass; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.Type++; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bRenderTarget = !p.bRenderTarget; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bVertStride = !p.bVertStride; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bVertStrideOffs = !p.bVertStrideOffs; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bWidthInDword_Y = !p.bWidthInDword_Y; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bWidthInDword_UV = !p.bWidthInDword_UV; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bAVS = !p.bAVS; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.Boundary++; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bWidth16Align = !p.bWidth16Align; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.b2PlaneNV12NeededByKernel = !p.b2PlaneNV12NeededByKernel; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bForceNV12 = !p.bForceNV12; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bUseSinglePlane = !p.bUseSinglePlane; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.b32MWColorFillKern = !p.b32MWColorFillKern; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bVASurface = !p.bVASurface; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.AddressControl++; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bWAUseSrcHeight = !p.bWAUseSrcHeight; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bWAUseSrcWidth = !p.bWAUseSrcWidth; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bForce3DLUTR16G16 = !p.bForce3DLUTR16G16; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bChromasiting = !p.bChromasiting; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bVmeUse = !p.bVmeUse; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.bBufferUse = !p.bBufferUse; },
+        [](SsSurface &, SsParams &p, RenderHal &) { p.MemObjCtl++; },
+    };
+
+    int       gmm  = 0;
+    RenderHal hal0 = {false, false};
+    SsSurface   s0   = MakeSurface(&gmm, 1, kFormatNV12, 1920, 1080);
+    SsParams    p0   = MakeParams(true);
+    SsKey       key0 = GetKey(s0, p0, hal0, 0);
+
+    for (size_t i = 0; i < flips.size(); i++)
+    {
+        SsSurface   s   = s0;
+        SsParams    p   = p0;
+        RenderHal hal = hal0;
+        flips[i](s, p, hal);
+        SsKey key = GetKey(s, p, hal, 0);
+        EXPECT_NE(0, memcmp(&key0, &key, sizeof(key))) << "flip " << i;
+        EXPECT_NE(HashInputs(s0, p0, hal0, 0x100000), HashInputs(s, p, hal, 0x100000)) << "flip " << i;
+    }
+
+    SsKey realloc = GetKey(s0, p0, hal0, 0, 0x200000);
+    EXPECT_NE(0, memcmp(&key0, &realloc, sizeof(key0)));
+}
+
+TEST(SurfaceStateTemplateKeyTest, AddressAndPaddingAreNotKeyed)
+{
+    int       gmm = 0;
+    RenderHal hal = {true, false};
+    SsSurface   s0  = MakeSurface(&gmm, 1, kFormatYV12, 720, 480);
+    SsSurface   s1  = s0;
+    SsParams    p   = MakeParams(false);
+    int       di0 = 0;
+    int       di1 = 0;
+
+    // The address is patched on every use, and only the presence of DI params matters
+    s1.OsSurface.OsResource.handle = 2;
+    s0.pDeinterlaceParams          = &di0;
+    s1.pDeinterlaceParams          = &di1;
+
+    SsKey key0 = GetKey(s0, p, hal, 0xaa);
+    SsKey key1 = GetKey(s1, p, hal, 0x55);
+    EXPECT_EQ(0, memcmp(&key0, &key1, sizeof(key0)));
+}
+
+class SurfaceStateTemplateTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        memset(&m_cache, 0, sizeof(m_cache));
+        m_cache.dwVerifyInterval = 64;
+        g_builds = 0;
+    }
+
+    // Runs the call through the cache and uncached, and checks the caller's surface,
+    // the entries and the SURFACE_STATE bytes are identical
+    void CheckSame(const RenderHal &hal, const SsSurface &in, const SsParams &p, uint64_t allocSize)
+    {
+        SsSurface cached   = in;
+        SsSurface uncached = in;
+
+        m_cachedSlots.Reset();
+        m_uncachedSlots.Reset();
+        int32_t n0 = CachedSetupSurfaceState(&m_cache, hal, &cached, p, allocSize, &m_cachedSlots);
+        uint32_t builds = g_builds;
+        int32_t n1 = FakeSetupSurfaceState(hal, &uncached, p, allocSize, &m_uncachedSlots);
+        g_builds = builds;
+
+        ASSERT_EQ(n1, n0);
+        ASSERT_EQ(0, memcmp(&uncached, &cached, sizeof(cached)));
+        for (int32_t i = 0; i < n0; i++)
+        {
+            const SsEntry *e0 = m_cachedSlots.pEntries[i];
+            const SsEntry *e1 = m_uncachedSlots.pEntries[i];
+            ASSERT_TRUE(RenderHal_IsSameSurfaceStateEntry(*e1, *e0)) << "plane " << i;
+            ASSERT_EQ(e1->SurfaceToken, e0->SurfaceToken);
+            ASSERT_EQ(0, memcmp(e1->pSurface, e0->pSurface, sizeof(SsOsSurface))) << "plane " << i;
+            ASSERT_EQ(0, memcmp(e1->pSurfaceState, e0->pSurfaceState, kStateSize)) << "plane " << i;
+        }
+        ASSERT_FALSE(m_cache.bDisabled);
+    }
+
+    SsCache      m_cache;
+    StateSlots m_cachedSlots;
+    StateSlots m_uncachedSlots;
+};
+
+// 4 layer composition with a P010 AVS input (rewrites the caller's surface),
+// a YV12 input toggling DI, a per-frame NV12 render target from a pool of 3
+// and an ARGB overlay. The main input is reallocated every 60 frames and its
+// source rectangle changes every 25.
+TEST_F(SurfaceStateTemplateTest, CachedStateIsByteIdenticalToUncached)
+{
+    int       gmm[8]  = {};
+    int       di      = 0;
+    RenderHal hal     = {true, false};
+    uint32_t  calls   = 0;
+
+    for (int frame = 0; frame < 300; frame++)
+    {
+        uint64_t mainSize = 0x400000 + (frame / 60) * 0x1000;
+        SsSurface  main     = MakeSurface(&gmm[0], 100 + frame / 60, kFormatP010, 1920, 1080);
+        main.rcSrc.right  = 1920 - (frame / 25) * 16;
+        CheckSame(hal, main, MakeParams(true), mainSize);
+
+        SsSurface yv12            = MakeSurface(&gmm[1], 200, kFormatYV12, 720, 480);
+        yv12.pDeinterlaceParams = (frame & 1) ? &di : nullptr;
+        CheckSame(hal, yv12, MakeParams(false), 0x80000);
+
+        SsSurface target = MakeSurface(&gmm[2 + frame % 3], 300 + frame % 3, kFormatNV12, 1920, 1080);
+        SsParams  rt     = MakeParams(false);
+        rt.bRenderTarget = true;
+        CheckSame(hal, target, rt, 0x300000);
+
+        CheckSame(hal, MakeSurface(&gmm[5], 400, kFormatARGB, 256, 64), MakeParams(false), 0x10000);
+        calls += 4;
+
+        if (HasFatalFailure())
+        {
+            return;
+        }
+    }
+
+    std::cout << "[ SSH      ] " << calls << " surfaces, " << g_builds << " built, "
+              << m_cache.dwHits << " template hits (" << m_cache.dwVerified << " verified), "
+              << m_cache.dwInvalidated << " invalidated" << std::endl;
+    EXPECT_LT(g_builds, calls / 10);
+    EXPECT_EQ(calls, m_cache.dwHits + m_cache.dwMisses);
+    EXPECT_GT(m_cache.dwInvalidated, 0u);
+}
+
+TEST_F(SurfaceStateTemplateTest, VerifiesFirstAndEveryNthHit)
+{
+    int       gmm = 0;
+    RenderHal hal = {false, false};
+    SsSurface   s   = MakeSurface(&gmm, 1, kFormatARGB, 640, 480);
+    SsParams    p   = MakeParams(false);
+
+    for (int i = 0; i < 130; i++)
+    {
+        CheckSame(hal, s, p, 0x1000);
+    }
+
+    // 1 miss, 129 hits: hits 0, 64 and 128 are built and compared
+    EXPECT_EQ(1u, m_cache.dwMisses);
+    EXPECT_EQ(129u, m_cache.dwHits);
+    EXPECT_EQ(3u, m_cache.dwVerified);
+    EXPECT_EQ(4u, g_builds);
+
+    m_cache.dwVerifyInterval = 1;
+    for (int i = 0; i < 10; i++)
+    {
+        CheckSame(hal, s, p, 0x1000);
+    }
+    EXPECT_EQ(13u, m_cache.dwVerified);
+}
+
+TEST_F(SurfaceStateTemplateTest, MismatchOnVerifyDisablesTemplates)
+{
+    int       gmm = 0;
+    RenderHal hal = {false, false};
+    SsSurface   s   = MakeSurface(&gmm, 1, kFormatARGB, 640, 480);
+    SsParams    p   = MakeParams(false);
+    StateSlots slots;
+
+    slots.Reset();
+    CachedSetupSurfaceState(&m_cache, hal, &s, p, 0x1000, &slots);
+
+    // Corrupt the template, as an input missing from the key would
+    m_cache.Template[0].SurfaceState[0][5] ^= 1;
+
+    slots.Reset();
+    CachedSetupSurfaceState(&m_cache, hal, &s, p, 0x1000, &slots);
+    EXPECT_TRUE(m_cache.bDisabled);
+
+    slots.Reset();
+    CachedSetupSurfaceState(&m_cache, hal, &s, p, 0x1000, &slots);
+    EXPECT_EQ(3u, g_builds);
+}
+
+TEST_F(SurfaceStateTemplateTest, TemplatePathCost)
+{
+    const int iterations = 200000;
+    int       gmm[4]     = {};
+    RenderHal hal        = {true, false};
+    SsSurface   in[4]      = {MakeSurface(&gmm[0], 1, kFormatNV12, 1920, 1080),
+                            MakeSurface(&gmm[1], 2, kFormatYV12, 720, 480),
+                            MakeSurface(&gmm[2], 3, kFormatARGB, 1920, 1080),
+                            MakeSurface(&gmm[3], 4, kFormatP010, 3840, 2160)};
+    SsParams    p          = MakeParams(true);
+    SsSurface   s;
+
+    m_cache.dwVerifyInterval = 0xffffffff;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        s = in[i & 3];
+        m_cachedSlots.Reset();
+        CachedSetupSurfaceState(&m_cache, hal, &s, p, 0x100000, &m_cachedSlots);
+    }
+    auto cachedTime = std::chrono::steady_clock::now() - start;
+
+    // One build per layout, plus the verified first hit of each template
+    EXPECT_EQ(8u, g_builds);
+
+    using ns = std::chrono::nanoseconds;
+    std::cout << "[ SSH      ] template path (key + lookup + copy back) "
+              << (double)std::chrono::duration_cast<ns>(cachedTime).count() / iterations
+              << " ns/surface over " << iterations << " surfaces" << std::endl;
+}
@@ -0,0 +1,389 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "vp_dump_staging_ring.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+using namespace vp;
+
+#define TEST_RING_SIZE  8
+
+typedef VpDumpStagingRing<std::mutex, TEST_RING_SIZE> TestRing;
+
+static std::vector<uint8_t> MakeDump(uint32_t seed, uint32_t size)
+{
+    std::vector<uint8_t> dump(size);
+    std::mt19937         rng(seed);
+    for (auto &byte : dump)
+    {
+        byte = (uint8_t)rng();
+    }
+    return dump;
+}
+
+static std::string DumpPath(const char *name, uint32_t index)
+{
+    const char *dir = getenv("TMPDIR");
+    return std::string(dir ? dir : "/tmp") + "/vp_dump_ring_" + std::to_string(getpid()) + "_" +
+           name + "_" + std::to_string(index) + ".yuv";
+}
+
+static bool ReadFile(const std::string &path, std::vector<uint8_t> &data)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    data.clear();
+    uint8_t buffer[4096];
+    size_t  read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + read);
+    }
+    fclose(file);
+    return true;
+}
+
+static bool WriteFile(const char *path, const uint8_t *data, uint32_t size)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool written = fwrite(data, 1, size, file) == size;
+    return (fclose(file) == 0) && written;
+}
+
+//!
+//! \brief  Same loop as VpDumpFileWriter::ProcessPendingWrites, with a counting semaphore
+//!         and a gate holding the writer back
+//!
+class TestWriter
+{
+public:
+    TestWriter(TestRing &ring, bool stalled) : m_ring(ring), m_open(!stalled)
+    {
+        m_thread = std::thread([this]() { Run(); });
+    }
+
+    ~TestWriter()
+    {
+        Exit();
+    }
+
+    MOS_STATUS Write(const char *path, const uint8_t *data, uint32_t size)
+    {
+        MOS_STATUS eStatus = m_ring.Push(path, data, size);
+        if (eStatus == MOS_STATUS_SUCCESS)
+        {
+            Post();
+        }
+        return eStatus;
+    }
+
+    //!
+    //! \brief  Let the writer go on, and wait until it holds back at the first dump
+    //!
+    void WaitStalled()
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_cv.wait(lock, [this]() { return m_stalled; });
+    }
+
+    void Open()
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_open = true;
+        m_cv.notify_all();
+    }
+
+    void Exit()
+    {
+        if (m_thread.joinable())
+        {
+            Open();
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+                m_exit = true;
+            }
+            Post();
+            m_thread.join();
+        }
+    }
+
+private:
+    void Post()
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_posts++;
+        m_cv.notify_all();
+    }
+
+    void Run()
+    {
+        const char    *path = nullptr;
+        const uint8_t *data = nullptr;
+        uint32_t      size  = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_cv.wait(lock, [this]() { return m_posts > 0; });
+                m_posts--;
+            }
+
+            if (!m_ring.Front(&path, &data, &size))
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+                if (m_exit)
+                {
+                    break;
+                }
+                continue;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_stalled = true;
+                m_cv.notify_all();
+                m_cv.wait(lock, [this]() { return m_open; });
+            }
+
+            EXPECT_TRUE(WriteFile(path, data, size)) << path;
+            m_ring.Pop();
+        }
+    }
+
+    TestRing                &m_ring;
+    std::thread             m_thread;
+    std::mutex              m_lock;
+    std::condition_variable m_cv;
+    uint32_t                m_posts   = 0;
+    bool                    m_open    = true;
+    bool                    m_stalled = false;
+    bool                    m_exit    = false;
+};
+
+TEST(VpDumpStagingRingTest, FullRingDropsAndReportsEveryDump)
+{
+    TestRing ring(64 * 1024 * 1024);
+    std::vector<MOS_STATUS> status;
+
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        std::vector<uint8_t> dump = MakeDump(i, 1000 + i);
+        status.push_back(ring.Push(DumpPath("full", i).c_str(), dump.data(), (uint32_t)dump.size()));
+    }
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        EXPECT_EQ(i < TEST_RING_SIZE ? MOS_STATUS_SUCCESS : MOS_STATUS_NO_SPACE, status[i]) << i;
+    }
+    EXPECT_EQ(20u - TEST_RING_SIZE, ring.GetDroppedCount());
+
+    // Queued dumps come out in order with their own data
+    for (uint32_t i = 0; i < TEST_RING_SIZE; i++)
+    {
+        const char    *path;
+        const uint8_t *data;
+        uint32_t      size;
+        ASSERT_TRUE(ring.Front(&path, &data, &size));
+        EXPECT_EQ(DumpPath("full", i), path);
+        EXPECT_EQ(MakeDump(i, 1000 + i), std::vector<uint8_t>(data, data + size));
+        ring.Pop();
+    }
+
+    const char    *path;
+    const uint8_t *data;
+    uint32_t      size;
+    EXPECT_FALSE(ring.Front(&path, &data, &size));
+
+    // Room again after draining
+    std::vector<uint8_t> dump = MakeDump(99, 10);
+    EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("again", dump.data(), (uint32_t)dump.size()));
+    EXPECT_EQ(20u - TEST_RING_SIZE, ring.GetDroppedCount());
+}
+
+TEST(VpDumpStagingRingTest, StagingLimitDropsAndBuffersAreReused)
+{
+    TestRing             ring(1000);
+    std::vector<uint8_t> big = MakeDump(1, 600), small = MakeDump(2, 300);
+    const char           *path;
+    const uint8_t        *data;
+    uint32_t             size;
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("a", big.data(), 600));
+    EXPECT_EQ(MOS_STATUS_NO_SPACE, ring.Push("b", big.data(), 600));
+    EXPECT_EQ(1u, ring.GetDroppedCount());
+    EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("c", small.data(), 300));
+    EXPECT_EQ(900u, ring.GetStagingSize());
+
+    // A zero size dump needs no staging memory
+    EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("empty", small.data(), 0));
+
+    while (ring.Front(&path, &data, &size))
+    {
+        ring.Pop();
+    }
+
+    // Drained slots keep their buffers for reuse, which still count against the limit
+    EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("d", small.data(), 100));
+    EXPECT_EQ(1000u, ring.GetStagingSize());
+    EXPECT_EQ(MOS_STATUS_NO_SPACE, ring.Push("e", small.data(), 100));
+    EXPECT_EQ(2u, ring.GetDroppedCount());
+    ring.Pop();
+
+    // Wrapping around reuses the 600 byte slot for a smaller dump
+    for (uint32_t i = 4; i < TEST_RING_SIZE; i++)
+    {
+        EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("f", small.data(), 0)) << i;
+        ring.Pop();
+    }
+    EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("g", big.data(), 500));
+    EXPECT_EQ(1000u, ring.GetStagingSize());
+    ASSERT_TRUE(ring.Front(&path, &data, &size));
+    EXPECT_STREQ("g", path);
+    EXPECT_EQ(std::vector<uint8_t>(big.begin(), big.begin() + 500), std::vector<uint8_t>(data, data + size));
+    ring.Pop();
+    EXPECT_EQ(2u, ring.GetDroppedCount());
+
+    EXPECT_EQ(MOS_STATUS_NULL_POINTER, ring.Push(nullptr, small.data(), 1));
+    EXPECT_EQ(MOS_STATUS_NULL_POINTER, ring.Push("e", nullptr, 1));
+}
+
+TEST(VpDumpStagingRingTest, GrowingSlotReplacesItsBuffer)
+{
+    TestRing             ring(10000);
+    std::vector<uint8_t> dump = MakeDump(3, 200);
+    const char           *path;
+    const uint8_t        *data;
+    uint32_t             size;
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("a", dump.data(), 100));
+    ring.Pop();
+    for (uint32_t i = 1; i < TEST_RING_SIZE; i++)
+    {
+        EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("b", dump.data(), 0));
+        ring.Pop();
+    }
+
+    EXPECT_EQ(MOS_STATUS_SUCCESS, ring.Push("c", dump.data(), 200));
+    EXPECT_EQ(200u, ring.GetStagingSize());
+    ASSERT_TRUE(ring.Front(&path, &data, &size));
+    EXPECT_EQ(dump, std::vector<uint8_t>(data, data + size));
+}
+
+TEST(VpDumpStagingRingTest, DumpsRoundTripThroughFilesAndDropsAreReported)
+{
+    TestRing ring(64 * 1024 * 1024);
+    std::vector<MOS_STATUS> status;
+    const uint32_t frames = 40;
+
+    {
+        // The writer holds back at the first dump, so the render thread fills the ring
+        // and must drop instead of waiting for it.
+        TestWriter writer(ring, true);
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            std::vector<uint8_t> dump = MakeDump(i, 4096 * (i % 5 + 1) + i);
+            status.push_back(writer.Write(DumpPath("trip", i).c_str(), dump.data(), (uint32_t)dump.size()));
+            if (i == 0)
+            {
+                writer.WaitStalled();
+            }
+        }
+        writer.Open();
+    }
+
+    uint32_t dropped = 0;
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        std::string          path = DumpPath("trip", i);
+        std::vector<uint8_t> data;
+        bool                 written = ReadFile(path, data);
+        if (status[i] == MOS_STATUS_SUCCESS)
+        {
+            ASSERT_TRUE(written) << path;
+            EXPECT_EQ(MakeDump(i, 4096 * (i % 5 + 1) + i), data) << path;
+        }
+        else
+        {
+            EXPECT_EQ(MOS_STATUS_NO_SPACE, status[i]);
+            EXPECT_FALSE(written) << path;
+            dropped++;
+        }
+        remove(path.c_str());
+    }
+
+    // The stalled writer holds one slot, the ring takes the rest
+    EXPECT_EQ(frames - TEST_RING_SIZE, dropped);
+    EXPECT_EQ(dropped, ring.GetDroppedCount());
+}
+
+TEST(VpDumpStagingRingTest, RenderThreadOverheadAgainstSyncWrite)
+{
+    // One 1080p NV12 frame
+    const uint32_t       frameSize = 1920 * 1080 * 3 / 2;
+    const uint32_t       frames    = 32;
+    std::vector<uint8_t> dump      = MakeDump(7, frameSize);
+    std::string          path      = DumpPath("overhead", 0);
+    TestRing             ring(64 * 1024 * 1024);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        ASSERT_TRUE(WriteFile(path.c_str(), dump.data(), frameSize));
+    }
+    auto syncTime = std::chrono::steady_clock::now() - start;
+
+    uint32_t queued = 0;
+    {
+        TestWriter writer(ring, false);
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            queued += (writer.Write(path.c_str(), dump.data(), frameSize) == MOS_STATUS_SUCCESS);
+        }
+        auto asyncTime = std::chrono::steady_clock::now() - start;
+
+        double syncUs  = std::chrono::duration<double, std::micro>(syncTime).count() / frames;
+        double asyncUs = std::chrono::duration<double, std::micro>(asyncTime).count() / frames;
+        RecordProperty("SyncWriteUsPerFrame", (int)syncUs);
+        RecordProperty("AsyncWriteUsPerFrame", (int)asyncUs);
+        printf("[ MEASURE  ] 1080p NV12 dump on render thread: sync write %.1f us, staged %.1f us, "
+               "%u of %u queued\n", syncUs, asyncUs, queued, frames);
+    }
+
+    EXPECT_EQ(frames - queued, ring.GetDroppedCount());
+    remove(path.c_str());
+}
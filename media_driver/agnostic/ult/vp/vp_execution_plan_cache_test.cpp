@@ -0,0 +1,128 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "vp_execution_plan_cache.h"
+#include <algorithm>
+#include <list>
+#include <random>
+
+using namespace vp;
+
+static std::vector<uint8_t> Signature(uint32_t id)
+{
+    std::vector<uint8_t> signature(1 + id % 7, (uint8_t)id);
+    signature.push_back((uint8_t)(id >> 8));
+    return signature;
+}
+
+TEST(VpExecutionPlanCacheTest, FindAfterAdd)
+{
+    VpExecutionPlanCache<uint32_t, 4> cache;
+
+    EXPECT_EQ(nullptr, cache.Find(Signature(1)));
+
+    cache.Add(Signature(1), 100);
+    cache.Add(Signature(2), 200);
+    ASSERT_NE(nullptr, cache.Find(Signature(1)));
+    EXPECT_EQ(100u, *cache.Find(Signature(1)));
+    ASSERT_NE(nullptr, cache.Find(Signature(2)));
+    EXPECT_EQ(200u, *cache.Find(Signature(2)));
+    EXPECT_EQ(nullptr, cache.Find(Signature(3)));
+
+    // Signatures which are prefixes of each other must not match
+    std::vector<uint8_t> prefix = Signature(1);
+    prefix.pop_back();
+    EXPECT_EQ(nullptr, cache.Find(prefix));
+    EXPECT_EQ(nullptr, cache.Find(std::vector<uint8_t>()));
+}
+
+TEST(VpExecutionPlanCacheTest, AddSameSignatureReplacesPlan)
+{
+    VpExecutionPlanCache<uint32_t, 4> cache;
+
+    cache.Add(Signature(1), 100);
+    cache.Add(Signature(1), 101);
+    EXPECT_EQ(1u, cache.GetCount());
+    ASSERT_NE(nullptr, cache.Find(Signature(1)));
+    EXPECT_EQ(101u, *cache.Find(Signature(1)));
+}
+
+TEST(VpExecutionPlanCacheTest, EvictsLeastRecentlyUsed)
+{
+    VpExecutionPlanCache<uint32_t, 4> cache;
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        cache.Add(Signature(i), uint32_t(i));
+    }
+    EXPECT_EQ(4u, cache.GetCount());
+
+    // Touch the oldest one, so signature 1 becomes least recently used
+    ASSERT_NE(nullptr, cache.Find(Signature(0)));
+    cache.Add(Signature(4), 4);
+
+    EXPECT_EQ(4u, cache.GetCount());
+    EXPECT_EQ(nullptr, cache.Find(Signature(1)));
+    for (uint32_t i : {0u, 2u, 3u, 4u})
+    {
+        ASSERT_NE(nullptr, cache.Find(Signature(i))) << "signature " << i;
+        EXPECT_EQ(i, *cache.Find(Signature(i)));
+    }
+
+    cache.Clear();
+    EXPECT_EQ(0u, cache.GetCount());
+    EXPECT_EQ(nullptr, cache.Find(Signature(0)));
+}
+
+TEST(VpExecutionPlanCacheTest, MatchesReferenceLru)
+{
+    VpExecutionPlanCache<uint32_t, 4> cache;
+    std::list<uint32_t>               reference;   // Most recently used first
+    std::mt19937                      rng(1);
+    std::uniform_int_distribution<uint32_t> idDist(0, 9);
+
+    for (int iter = 0; iter < 20000; iter++)
+    {
+        uint32_t id   = idDist(rng);
+        uint32_t *plan = cache.Find(Signature(id));
+
+        auto it = std::find(reference.begin(), reference.end(), id);
+        ASSERT_EQ(it != reference.end(), plan != nullptr) << "iteration " << iter;
+
+        if (plan)
+        {
+            EXPECT_EQ(id, *plan);
+            reference.erase(it);
+            reference.push_front(id);
+            continue;
+        }
+
+        cache.Add(Signature(id), uint32_t(id));
+        reference.push_front(id);
+        if (reference.size() > 4)
+        {
+            reference.pop_back();
+        }
+        ASSERT_EQ(reference.size(), cache.GetCount());
+    }
+}
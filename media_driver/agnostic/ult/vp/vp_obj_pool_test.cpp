@@ -0,0 +1,255 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "vp_obj_pool.h"
+#include <algorithm>
+#include <random>
+
+using namespace vp;
+
+//!
+//! \brief  Stand-ins for the pooled vp objects of one frame, created and released the way
+//!         SwFilterPipe, SwFilterSubPipe, the HwFilter and packet parameter factories and
+//!         PacketPipeFactory do
+//!
+struct FakeSwFilter         { uint32_t type; };
+struct FakeHwFilterParam    { uint32_t type; };
+struct FakePacketParam      { uint32_t type; };
+struct FakePacketPipe       { uint32_t packets; };
+struct FakeSwFilterSet      { std::vector<FakeSwFilter *> filters; };
+
+struct FakeSwFilterSubPipe
+{
+    FakeSwFilterSubPipe(VpObjPool<FakeSwFilterSet> &filterSetPool) : setPool(filterSetPool)
+    {
+    }
+    VpObjPool<FakeSwFilterSet>     &setPool;
+    std::vector<FakeSwFilterSet *> sets;
+};
+
+// Layer count and filters per layer of one frame
+struct FrameShape
+{
+    uint32_t layers;
+    uint32_t setsPerLayer;
+    uint32_t filtersPerSet;
+};
+
+class VpObjPoolTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        m_subPipes.Clear([](FakeSwFilterSubPipe *p) { delete p; });
+        m_sets.Clear([](FakeSwFilterSet *p) { delete p; });
+        m_filters.Clear([](FakeSwFilter *p) { delete p; });
+        m_hwParams.Clear([](FakeHwFilterParam *p) { delete p; });
+        m_packetParams.Clear([](FakePacketParam *p) { delete p; });
+        m_packetPipes.Clear([](FakePacketPipe *p) { delete p; });
+    }
+
+    // Mirrors VpPipeline::ExecuteVpPipeline: build, execute and release one frame
+    void Frame(const FrameShape &shape, std::mt19937 &rng)
+    {
+        std::vector<FakeSwFilterSubPipe *> pipes;
+        std::vector<FakeHwFilterParam *>   hwParams;
+        std::vector<FakePacketParam *>     packetParams;
+
+        // SwFilterPipe::Initialize, one sub pipe per input plus one for the output
+        for (uint32_t i = 0; i < shape.layers + 1; i++)
+        {
+            FakeSwFilterSubPipe *pipe = m_subPipes.Acquire([this]() {
+                m_heapAllocs++;
+                return new FakeSwFilterSubPipe(m_sets);
+            });
+            pipes.push_back(pipe);
+
+            // SwFilterSubPipe::AddSwFilterOrdered
+            for (uint32_t j = 0; j < shape.setsPerLayer; j++)
+            {
+                FakeSwFilterSet *set = pipe->setPool.Acquire([this]() {
+                    m_heapAllocs++;
+                    return new FakeSwFilterSet;
+                });
+                for (uint32_t k = 0; k < shape.filtersPerSet; k++)
+                {
+                    set->filters.push_back(m_filters.Acquire([this]() {
+                        m_heapAllocs++;
+                        return new FakeSwFilter;
+                    }));
+
+                    // PolicyFeatureHandler::CreateHwFilterParam and PacketParamFactory::GetPacketParameter
+                    FakeHwFilterParam *hwParam = m_hwParams.Acquire();
+                    if (hwParam == nullptr)
+                    {
+                        m_heapAllocs++;
+                        hwParam = new FakeHwFilterParam;
+                    }
+                    hwParams.push_back(hwParam);
+                    packetParams.push_back(m_packetParams.Acquire([this]() {
+                        m_heapAllocs++;
+                        return new FakePacketParam;
+                    }));
+                }
+                pipe->sets.push_back(set);
+            }
+        }
+
+        FakePacketPipe *packetPipe = m_packetPipes.Acquire([this]() {
+            m_heapAllocs++;
+            return new FakePacketPipe;
+        });
+
+        // Objects are released in whatever order the pipeline finishes with them
+        std::shuffle(hwParams.begin(), hwParams.end(), rng);
+        std::shuffle(pipes.begin(), pipes.end(), rng);
+
+        m_packetPipes.Release(packetPipe);
+        for (auto &p : packetParams)
+        {
+            m_packetParams.Release(p);
+        }
+        for (auto &p : hwParams)
+        {
+            m_hwParams.Release(p);
+        }
+        // SwFilterPipe::Clean
+        for (auto &pipe : pipes)
+        {
+            for (auto &set : pipe->sets)
+            {
+                for (auto &filter : set->filters)
+                {
+                    m_filters.Release(filter);
+                }
+                set->filters.clear();
+                pipe->setPool.Release(set);
+            }
+            pipe->sets.clear();
+            m_subPipes.Release(pipe);
+        }
+    }
+
+    VpObjPool<FakeSwFilterSubPipe> m_subPipes;
+    VpObjPool<FakeSwFilterSet>     m_sets;
+    VpObjPool<FakeSwFilter>        m_filters;
+    VpObjPool<FakeHwFilterParam>   m_hwParams;
+    VpObjPool<FakePacketParam>     m_packetParams;
+    VpObjPool<FakePacketPipe>      m_packetPipes;
+    int32_t                        m_heapAllocs = 0;
+};
+
+TEST_F(VpObjPoolTest, ReleasedObjectIsReused)
+{
+    int32_t traced = ObjAllocTrace::GetHeapAllocCount();
+
+    FakeSwFilter *filter = m_filters.Acquire();
+    EXPECT_EQ(nullptr, filter);
+    EXPECT_EQ(traced + 1, ObjAllocTrace::GetHeapAllocCount());
+
+    filter = m_filters.Acquire([]() { return new FakeSwFilter; });
+    ASSERT_NE(nullptr, filter);
+    EXPECT_EQ(traced + 2, ObjAllocTrace::GetHeapAllocCount());
+
+    FakeSwFilter *released = filter;
+    m_filters.Release(filter);
+    EXPECT_EQ(nullptr, filter);
+    EXPECT_EQ(1u, m_filters.GetFreeCount());
+
+    filter = m_filters.Acquire([]() { return new FakeSwFilter; });
+    EXPECT_EQ(released, filter);
+    EXPECT_EQ(0u, m_filters.GetFreeCount());
+    EXPECT_EQ(traced + 2, ObjAllocTrace::GetHeapAllocCount());
+
+    // Releasing nothing is allowed, as for the factories' Destory/Return functions
+    FakeSwFilter *none = nullptr;
+    m_filters.Release(none);
+    EXPECT_EQ(0u, m_filters.GetFreeCount());
+    m_filters.Release(filter);
+}
+
+TEST_F(VpObjPoolTest, ClearDeletesFreeObjects)
+{
+    uint32_t deleted = 0;
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        FakePacketPipe *pipe = new FakePacketPipe;
+        m_packetPipes.Release(pipe);
+    }
+    m_packetPipes.Clear([&deleted](FakePacketPipe *p) { deleted++; delete p; });
+    EXPECT_EQ(5u, deleted);
+    EXPECT_EQ(0u, m_packetPipes.GetFreeCount());
+}
+
+TEST_F(VpObjPoolTest, SteadyStateFramesAllocateNothing)
+{
+    std::mt19937 rng(7);
+    FrameShape   peak = {8, 3, 4};
+
+    // Warm up with the largest frame of the stream
+    int32_t traced = ObjAllocTrace::GetHeapAllocCount();
+    Frame(peak, rng);
+    int32_t warmUp = m_heapAllocs;
+    EXPECT_EQ(warmUp, ObjAllocTrace::GetHeapAllocCount() - traced);
+
+    // Per frame objects: 9 sub pipes, 27 sets, 108 sw filters, hw params and packet params,
+    // 1 packet pipe
+    EXPECT_EQ(9 + 27 + 3 * 108 + 1, warmUp);
+
+    // Layer count and feature set change from frame to frame, never above the peak
+    std::uniform_int_distribution<uint32_t> layers(1, peak.layers);
+    std::uniform_int_distribution<uint32_t> sets(1, peak.setsPerLayer);
+    std::uniform_int_distribution<uint32_t> filters(1, peak.filtersPerSet);
+    for (uint32_t frame = 0; frame < 300; frame++)
+    {
+        int32_t before = ObjAllocTrace::GetHeapAllocCount();
+        Frame({layers(rng), sets(rng), filters(rng)}, rng);
+        EXPECT_EQ(before, ObjAllocTrace::GetHeapAllocCount()) << "frame " << frame;
+    }
+    EXPECT_EQ(warmUp, m_heapAllocs);
+
+    // Everything is back in the pools at the end of each frame
+    EXPECT_EQ(9u, m_subPipes.GetFreeCount());
+    EXPECT_EQ(27u, m_sets.GetFreeCount());
+    EXPECT_EQ(108u, m_filters.GetFreeCount());
+    EXPECT_EQ(108u, m_hwParams.GetFreeCount());
+    EXPECT_EQ(108u, m_packetParams.GetFreeCount());
+    EXPECT_EQ(1u, m_packetPipes.GetFreeCount());
+}
+
+TEST_F(VpObjPoolTest, LargerFrameOnlyAllocatesTheDifference)
+{
+    std::mt19937 rng(11);
+
+    Frame({2, 1, 2}, rng);
+    int32_t before = ObjAllocTrace::GetHeapAllocCount();
+
+    // One more layer: one sub pipe, one set, two filters with their parameters
+    Frame({3, 1, 2}, rng);
+    EXPECT_EQ(before + 1 + 1 + 3 * 2, ObjAllocTrace::GetHeapAllocCount());
+
+    before = ObjAllocTrace::GetHeapAllocCount();
+    Frame({3, 1, 2}, rng);
+    Frame({1, 1, 1}, rng);
+    EXPECT_EQ(before, ObjAllocTrace::GetHeapAllocCount());
+}
@@ -0,0 +1,323 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "vp_surface_pool.h"
+#include <functional>
+
+using namespace vp;
+
+//!
+//! \brief  Stand-ins for VP_SURFACE_POOL_KEY and VP_SURFACE_POOL_FENCE
+//!
+struct FakeKey
+{
+    uint32_t format;
+    uint32_t width;
+    uint32_t height;
+
+    bool operator==(const FakeKey &key) const
+    {
+        return format == key.format && width == key.width && height == key.height;
+    }
+};
+
+struct FakeFence
+{
+    int32_t  gpuContext = -1;
+    uint32_t tag        = 0;
+};
+
+struct FakeSurface
+{
+    FakeKey  key;
+    uint64_t size;
+    uint32_t lastUseTag;    // Tag of the last frame referencing the surface
+};
+
+// Resolutions of a stream switching among several settings
+static const FakeKey s_1080p = {1, 1920, 1080};
+static const FakeKey s_720p  = {1, 1280, 720};
+static const FakeKey s_480p  = {1, 720, 480};
+static const FakeKey s_4k    = {1, 3840, 2160};
+
+class VpSurfacePoolTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        for (auto &surf : m_surfaces)
+        {
+            Return(surf, false);
+        }
+        m_pool.ReleaseDeferred(LastSubmitted());
+        m_pool.Trim(0, Destroyer());
+        EXPECT_EQ(m_allocs, m_destroys);
+    }
+
+    std::function<void(FakeSurface *)> Destroyer()
+    {
+        return [this](FakeSurface *surf) {
+            m_pool.Untrack(surf);
+            delete surf;
+            m_destroys++;
+        };
+    }
+
+    FakeFence LastSubmitted()
+    {
+        FakeFence fence;
+        fence.gpuContext = 0;
+        fence.tag        = m_submittedTag;
+        return fence;
+    }
+
+    bool IsCompleted(const FakeFence &fence)
+    {
+        return fence.gpuContext < 0 || VpIsStatusTagCompleted(m_completedTag, fence.tag);
+    }
+
+    // Mirrors VpAllocator::ReturnSurfaceToPool
+    void Return(FakeSurface *&surf, bool deferred)
+    {
+        if (nullptr == surf)
+        {
+            return;
+        }
+        if (deferred)
+        {
+            m_pool.Defer(surf, surf->size);
+        }
+        else
+        {
+            m_pool.Release(surf, surf->size, LastSubmitted());
+            m_pool.Trim(m_budget, Destroyer());
+        }
+        surf = nullptr;
+    }
+
+    // Mirrors VpAllocator::ReAllocateSurface
+    void ReAllocate(FakeSurface *&surf, const FakeKey &key, bool deferred)
+    {
+        if (surf && surf->key == key)
+        {
+            return;
+        }
+        Return(surf, deferred);
+
+        surf = m_pool.Acquire(key, [this](const FakeFence &fence) { return IsCompleted(fence); });
+        if (surf)
+        {
+            // GPU must be done with the surface before it is handed out again.
+            EXPECT_TRUE(VpIsStatusTagCompleted(m_completedTag, surf->lastUseTag));
+            m_reuses++;
+            return;
+        }
+
+        surf = new FakeSurface{key, (uint64_t)key.width * key.height * 3 / 2, 0};
+        m_pool.Track(surf, key);
+        m_allocs++;
+    }
+
+    // One frame using m_surfaces, submitted and completed by GPU latency frames later,
+    // then VpResourceManager::OnNewFrameProcessEnd calling CleanRecycler.
+    void Frame(const FakeKey &key, bool deferred)
+    {
+        for (auto &surf : m_surfaces)
+        {
+            ReAllocate(surf, key, deferred);
+        }
+
+        m_submittedTag++;
+        for (auto &surf : m_surfaces)
+        {
+            surf->lastUseTag = m_submittedTag;
+        }
+        m_completedTag = m_submittedTag - m_latency;
+
+        m_pool.ReleaseDeferred(LastSubmitted());
+        m_pool.Trim(m_budget, Destroyer());
+        EXPECT_LE(m_pool.GetFreeSize(), m_budget);
+    }
+
+    VpSurfacePool<FakeSurface, FakeKey, FakeFence> m_pool;
+    FakeSurface *m_surfaces[2]  = {};     // Vebox output surfaces
+    uint64_t     m_budget       = 64 * 1024 * 1024;
+    uint32_t     m_submittedTag = 0;
+    uint32_t     m_completedTag = 0;
+    uint32_t     m_latency      = 2;      // Frames submitted but not completed by GPU
+    uint32_t     m_allocs       = 0;
+    uint32_t     m_destroys     = 0;
+    uint32_t     m_reuses       = 0;
+};
+
+TEST_F(VpSurfacePoolTest, ResolutionSwitchTraceOnlyAllocatesDuringWarmUp)
+{
+    // Start close to the wrap around of the status tag.
+    m_submittedTag = m_completedTag = 0xfffffff0;
+
+    const FakeKey trace[] = {s_1080p, s_720p, s_480p, s_720p};
+    const uint32_t framesPerSwitch[] = {1, 3, 8};
+    for (uint32_t deferred = 0; deferred < 2; deferred++)
+    {
+        for (auto n : framesPerSwitch)
+        {
+            uint32_t warmUpAllocs = 0;
+            for (uint32_t frame = 0; frame < 300; frame++)
+            {
+                if (30 == frame)
+                {
+                    warmUpAllocs = m_allocs;
+                }
+                Frame(trace[frame / n % 4], deferred);
+            }
+            EXPECT_EQ(warmUpAllocs, m_allocs) << "frames per switch " << n << ", deferred " << deferred;
+            EXPECT_GT(m_reuses, 0u);
+        }
+    }
+    // Each resolution needs no more surfaces than the frames in flight can hold.
+    EXPECT_LE(m_allocs, 3 * 2 * (m_latency + 2));
+}
+
+TEST_F(VpSurfacePoolTest, InFlightSurfaceIsNotReused)
+{
+    FakeSurface *surf = nullptr;
+    ReAllocate(surf, s_1080p, false);
+    FakeSurface *first = surf;
+
+    // Submitted but not completed by GPU.
+    m_submittedTag++;
+    surf->lastUseTag = m_submittedTag;
+
+    ReAllocate(surf, s_720p, false);
+    ReAllocate(surf, s_1080p, false);
+    EXPECT_NE(first, surf);
+    EXPECT_EQ(3u, m_allocs);
+    EXPECT_EQ(0u, m_reuses);
+
+    // Reused once GPU has completed the frame.
+    m_completedTag = m_submittedTag;
+    FakeSurface *other = nullptr;
+    ReAllocate(other, s_1080p, false);
+    EXPECT_EQ(first, other);
+    EXPECT_EQ(3u, m_allocs);
+    EXPECT_EQ(1u, m_reuses);
+    Return(surf, false);
+    Return(other, false);
+}
+
+TEST_F(VpSurfacePoolTest, DeferredSurfaceWaitsForReleaseDeferred)
+{
+    FakeSurface *surf = nullptr;
+    ReAllocate(surf, s_1080p, true);
+    ReAllocate(surf, s_720p, true);
+    EXPECT_EQ(1u, m_pool.GetPendingCount());
+    EXPECT_EQ(0u, m_pool.GetFreeCount());
+
+    // Still referenced by the frame being built, though its fence is completed.
+    ReAllocate(surf, s_1080p, true);
+    EXPECT_EQ(3u, m_allocs);
+
+    m_pool.ReleaseDeferred(LastSubmitted());
+    EXPECT_EQ(0u, m_pool.GetPendingCount());
+    EXPECT_EQ(2u, m_pool.GetFreeCount());
+    ReAllocate(surf, s_720p, false);
+    EXPECT_EQ(3u, m_allocs);
+    EXPECT_EQ(1u, m_reuses);
+    Return(surf, false);
+}
+
+TEST_F(VpSurfacePoolTest, MostRecentCompletedSurfaceWithKeyIsReused)
+{
+    FakeSurface *a = nullptr, *b = nullptr, *c = nullptr;
+    ReAllocate(a, s_1080p, false);
+    ReAllocate(b, s_1080p, false);
+    ReAllocate(c, s_720p, false);
+    FakeSurface *first = a, *second = b;
+    Return(a, false);
+    Return(c, false);
+    Return(b, false);
+
+    EXPECT_EQ(nullptr, m_pool.Acquire(s_480p, [this](const FakeFence &fence) { return IsCompleted(fence); }));
+    ReAllocate(a, s_1080p, false);
+    EXPECT_EQ(second, a);
+    ReAllocate(b, s_1080p, false);
+    EXPECT_EQ(first, b);
+    ReAllocate(c, s_1080p, false);
+    EXPECT_EQ(4u, m_allocs);
+    Return(a, false);
+    Return(b, false);
+    Return(c, false);
+}
+
+TEST_F(VpSurfacePoolTest, BudgetEvictsLeastRecentlyReturned)
+{
+    const uint64_t size1080p = 1920 * 1080 * 3 / 2;
+    m_budget = 2 * size1080p;
+
+    FakeSurface *surf[3] = {};
+    ReAllocate(surf[0], s_1080p, false);
+    ReAllocate(surf[1], s_720p, false);
+    ReAllocate(surf[2], s_1080p, false);
+    FakeSurface *kept = surf[2];
+    for (auto &s : surf)
+    {
+        Return(s, false);
+    }
+    // 1080p + 720p + 1080p exceeds the budget, so the first 1080p one is destroyed.
+    EXPECT_EQ(1u, m_destroys);
+    EXPECT_EQ(2u, m_pool.GetFreeCount());
+    EXPECT_EQ((uint64_t)size1080p + 1280 * 720 * 3 / 2, m_pool.GetFreeSize());
+
+    // Surface bigger than budget is destroyed right away, along with all older ones.
+    FakeSurface *big = nullptr;
+    ReAllocate(big, s_4k, false);
+    Return(big, false);
+    EXPECT_EQ(4u, m_destroys);
+    EXPECT_EQ(0u, m_pool.GetFreeCount());
+    EXPECT_EQ(0u, m_pool.GetFreeSize());
+    EXPECT_FALSE(m_pool.IsTracked(kept));
+}
+
+TEST_F(VpSurfacePoolTest, ZeroBudgetDestroysZeroSizedSurfaces)
+{
+    FakeSurface *surf = new FakeSurface{s_480p, 0, 0};
+    m_pool.Track(surf, s_480p);
+    m_allocs++;
+    m_pool.Release(surf, 0, LastSubmitted());
+    m_pool.Trim(m_budget, Destroyer());
+    EXPECT_EQ(1u, m_pool.GetFreeCount());
+
+    m_pool.Trim(0, Destroyer());
+    EXPECT_EQ(0u, m_pool.GetFreeCount());
+    EXPECT_EQ(1u, m_destroys);
+}
+
+TEST(VpSurfacePoolTagTest, CompletionHandlesWrapAround)
+{
+    EXPECT_TRUE(VpIsStatusTagCompleted(5, 5));
+    EXPECT_TRUE(VpIsStatusTagCompleted(6, 5));
+    EXPECT_FALSE(VpIsStatusTagCompleted(4, 5));
+    EXPECT_TRUE(VpIsStatusTagCompleted(2, 0xfffffffe));
+    EXPECT_FALSE(VpIsStatusTagCompleted(0xfffffffe, 2));
+    EXPECT_TRUE(VpIsStatusTagCompleted(0, 0xffffffff));
+}
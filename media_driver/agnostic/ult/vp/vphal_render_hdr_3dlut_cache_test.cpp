@@ -0,0 +1,226 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "vphal_render_hdr_3dlut_cache.h"
+#include <vector>
+
+//!
+//! \brief  Mirror of Hdr3DLutGenerator::Hdr3DLutKey
+//!
+struct LutKey
+{
+    uint32_t maxDLL;
+    uint32_t maxCLL;
+    uint32_t hdrMode;
+
+    bool operator==(const LutKey &key) const
+    {
+        return maxDLL == key.maxDLL && maxCLL == key.maxCLL && hdrMode == key.hdrMode;
+    }
+};
+
+static const uint32_t s_lutSize      = 4096;
+static const uint32_t s_lutCacheSize = 4;
+
+static const LutKey s_h2s1000  = {1000, 1000, 1};
+static const LutKey s_h2s4000  = {1000, 4000, 1};
+static const LutKey s_h2h4000  = {600, 4000, 2};
+static const LutKey s_h2s10000 = {1000, 10000, 1};
+static const LutKey s_h2h1000  = {600, 1000, 2};
+
+//!
+//! \brief  Content of the 3DLut generated for key
+//!
+static std::vector<uint8_t> Expected3DLut(const LutKey &key)
+{
+    std::vector<uint8_t> lut(s_lutSize);
+    for (uint32_t i = 0; i < s_lutSize; i++)
+    {
+        lut[i] = (uint8_t)(key.maxDLL * 7 + key.maxCLL * 13 + key.hdrMode * 31 + i * 3 + (i >> 8));
+    }
+    return lut;
+}
+
+//!
+//! \brief  Mirrors Hdr3DLutGenerator::Render with the kernel, the CM 3DLut surface and the
+//!         vebox 3DLut buffer replaced by system memory
+//!
+class Hdr3DLutCacheTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        m_cache.Clear([this](uint8_t *lut) {
+            m_frees++;
+            delete[] lut;
+        });
+        EXPECT_EQ(m_allocs, m_frees);
+    }
+
+    void Render(const LutKey &key)
+    {
+        if (m_savedValid && key == m_saved)
+        {
+            return;
+        }
+        m_saved      = key;
+        m_savedValid = true;
+
+        uint8_t *lut = m_cache.Get(key, [&]() {
+            m_launches++;
+            m_surface = Expected3DLut(key);
+        }, [&](uint8_t *dst) {
+            m_surfaceReads++;
+            memcpy(dst, m_surface.data(), s_lutSize);
+        }, [&]() -> uint8_t * {
+            if (m_allocs >= m_allocLimit)
+            {
+                return nullptr;
+            }
+            m_allocs++;
+            return new uint8_t[s_lutSize];
+        });
+
+        m_uploads++;
+        std::fill(m_vebox.begin(), m_vebox.end(), 0xcd);
+        m_cache.Upload(m_vebox.data(), lut, [&](uint8_t *dst) {
+            m_surfaceReads++;
+            m_fallbackReads++;
+            memcpy(dst, m_surface.data(), s_lutSize);
+        });
+    }
+
+    // Renders frames of keys, checking the vebox 3DLut of every frame
+    uint32_t Play(const std::vector<LutKey> &trace)
+    {
+        uint32_t changes = 0;
+        for (auto &key : trace)
+        {
+            changes += !(m_savedValid && key == m_saved);
+            Render(key);
+            EXPECT_EQ(Expected3DLut(key), m_vebox);
+        }
+        return changes;
+    }
+
+    VphalHdr3DLutCache<LutKey> m_cache{s_lutSize, s_lutCacheSize};
+    std::vector<uint8_t>       m_surface = std::vector<uint8_t>(s_lutSize);
+    std::vector<uint8_t>       m_vebox   = std::vector<uint8_t>(s_lutSize);
+    LutKey                     m_saved         = {};
+    bool                       m_savedValid    = false;
+    uint32_t                   m_allocLimit    = UINT32_MAX;
+    uint32_t                   m_allocs        = 0;
+    uint32_t                   m_frees         = 0;
+    uint32_t                   m_launches      = 0;
+    uint32_t                   m_surfaceReads  = 0;
+    uint32_t                   m_fallbackReads = 0;
+    uint32_t                   m_uploads       = 0;
+};
+
+TEST_F(Hdr3DLutCacheTest, ThreeHundredFramesOnlyGenerateDistinctParameters)
+{
+    // HDR metadata changing with the scene every 10 frames among three settings.
+    const LutKey scenes[] = {s_h2s1000, s_h2s4000, s_h2s1000, s_h2h4000, s_h2s4000};
+    std::vector<LutKey> trace;
+    for (uint32_t frame = 0; frame < 300; frame++)
+    {
+        trace.push_back(scenes[frame / 10 % 5]);
+    }
+
+    uint32_t changes = Play(trace);
+    EXPECT_EQ(30u, changes);
+    EXPECT_EQ(changes, m_uploads);
+    EXPECT_EQ(3u, m_launches);
+    EXPECT_EQ(3u, m_cache.GetGenerateCount());
+    EXPECT_EQ(3u, m_allocs);
+    // The 3DLut surface is only read back once per generation, uploads copy the cached one.
+    EXPECT_EQ(3u, m_surfaceReads);
+    EXPECT_EQ(0u, m_fallbackReads);
+}
+
+TEST_F(Hdr3DLutCacheTest, LeastRecentlyUsedIsRegenerated)
+{
+    Play({s_h2s1000, s_h2s4000, s_h2h4000, s_h2s10000, s_h2s1000});
+    EXPECT_EQ(4u, m_launches);
+
+    // s_h2s4000 is the least recently used one, whose buffer is reused for s_h2h1000.
+    Play({s_h2h1000, s_h2s1000, s_h2h4000, s_h2s10000});
+    EXPECT_EQ(5u, m_launches);
+    EXPECT_EQ(4u, m_allocs);
+    Play({s_h2s4000});
+    EXPECT_EQ(6u, m_launches);
+    EXPECT_EQ(4u, m_allocs);
+}
+
+TEST_F(Hdr3DLutCacheTest, CyclingMoreParametersThanCachedGeneratesEveryChange)
+{
+    std::vector<LutKey> trace;
+    const LutKey keys[] = {s_h2s1000, s_h2s4000, s_h2h4000, s_h2s10000, s_h2h1000};
+    for (uint32_t frame = 0; frame < 300; frame++)
+    {
+        trace.push_back(keys[frame % 5]);
+    }
+    EXPECT_EQ(300u, Play(trace));
+    EXPECT_EQ(300u, m_launches);
+    EXPECT_EQ(s_lutCacheSize, m_allocs);
+}
+
+TEST_F(Hdr3DLutCacheTest, AllocFailureReadsSurfaceIntoVebox)
+{
+    m_allocLimit = 0;
+
+    std::vector<LutKey> trace;
+    const LutKey scenes[] = {s_h2s1000, s_h2s4000, s_h2s1000};
+    for (uint32_t frame = 0; frame < 300; frame++)
+    {
+        trace.push_back(scenes[frame / 10 % 3]);
+    }
+    uint32_t changes = Play(trace);
+
+    // Nothing is cached, so every change generates and reads the surface into the vebox buffer.
+    EXPECT_EQ(changes, m_launches);
+    EXPECT_EQ(changes, m_fallbackReads);
+    EXPECT_EQ(changes, m_surfaceReads);
+    EXPECT_EQ(0u, m_allocs);
+}
+
+TEST_F(Hdr3DLutCacheTest, CachedLutIsUsedAfterAllocFailure)
+{
+    m_allocLimit = 2;
+    Play({s_h2s1000, s_h2s4000});
+    EXPECT_EQ(0u, m_fallbackReads);
+
+    // Not cached, the surface now holds s_h2h4000.
+    Play({s_h2h4000});
+    EXPECT_EQ(3u, m_launches);
+    EXPECT_EQ(1u, m_fallbackReads);
+
+    // Cached ones are uploaded from the cache, not the surface.
+    Play({s_h2s1000, s_h2s4000});
+    EXPECT_EQ(3u, m_launches);
+    EXPECT_EQ(1u, m_fallbackReads);
+
+    Play({s_h2h4000});
+    EXPECT_EQ(4u, m_launches);
+    EXPECT_EQ(2u, m_fallbackReads);
+}
@@ -0,0 +1,306 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "vphal_render_hdr_table_cache.h"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+//!
+//! \brief  Mirror of VPHAL_HDR_CCM_CACHE_KEY_G9, VPHAL_HDR_CCM_G9 and VPHAL_HDR_OETF_LUT_G9
+//!
+struct CcmKey
+{
+    int32_t  CCMType;
+    uint16_t display_primaries_x[3];
+    uint16_t display_primaries_y[3];
+    uint16_t white_point_x;
+    uint16_t white_point_y;
+
+    bool operator==(const CcmKey &Key) const
+    {
+        return CCMType                == Key.CCMType                &&
+               display_primaries_x[0] == Key.display_primaries_x[0] &&
+               display_primaries_x[1] == Key.display_primaries_x[1] &&
+               display_primaries_x[2] == Key.display_primaries_x[2] &&
+               display_primaries_y[0] == Key.display_primaries_y[0] &&
+               display_primaries_y[1] == Key.display_primaries_y[1] &&
+               display_primaries_y[2] == Key.display_primaries_y[2] &&
+               white_point_x          == Key.white_point_x          &&
+               white_point_y          == Key.white_point_y;
+    }
+};
+
+struct Ccm
+{
+    float Matrix[12];
+};
+
+struct OetfLut
+{
+    uint16_t Lut[256];
+};
+
+typedef VphalHdrTableCache<CcmKey, Ccm, 8>    CcmCache;
+typedef VphalHdrTableCache<float, OetfLut, 1> OetfLutCache;
+
+//!
+//! \brief  Stand-in of the monitor gamut CCM calculation. Every key field changes the result,
+//!         and negative zero, NaN payloads and denormals check the tables are copied bit by bit.
+//!
+static void CalcCcm(const CcmKey &Key, Ccm &Table)
+{
+    float xr = Key.display_primaries_x[2] / 50000.0f, yr = Key.display_primaries_y[2] / 50000.0f;
+    float xg = Key.display_primaries_x[0] / 50000.0f, yg = Key.display_primaries_y[0] / 50000.0f;
+    float xb = Key.display_primaries_x[1] / 50000.0f, yb = Key.display_primaries_y[1] / 50000.0f;
+    float xn = Key.white_point_x / 50000.0f, yn = Key.white_point_y / 50000.0f;
+    float s  = (float)(Key.CCMType + 1);
+
+    Table.Matrix[0]  = s * xr / yr;
+    Table.Matrix[1]  = s * xg / yg;
+    Table.Matrix[2]  = s * xb / yb;
+    Table.Matrix[3]  = -0.0f;
+    Table.Matrix[4]  = (1.0f - xr - yr) * s;
+    Table.Matrix[5]  = (1.0f - xg - yg) * s;
+    Table.Matrix[6]  = (1.0f - xb - yb) * s;
+    Table.Matrix[7]  = std::numeric_limits<float>::denorm_min() * (float)Key.white_point_x;
+    Table.Matrix[8]  = xn / yn;
+    Table.Matrix[9]  = (1.0f - xn - yn) / yn;
+    Table.Matrix[10] = xr * yg * xb - yr * xg * yb;
+    uint32_t nan     = 0x7fc00000 | Key.white_point_y;
+    memcpy(&Table.Matrix[11], &nan, sizeof(nan));
+}
+
+//!
+//! \brief  Same segments as VpHal_Generate2SegmentsOETFLUT, with a truncating half float
+//!
+static void CalcOetfLut(float fStretchFactor, OetfLut &Table)
+{
+    for (int i = 0; i < 16; ++i)
+    {
+        for (int j = 0; j < 16; ++j)
+        {
+            int   idx = j + i * 15;
+            float a   = (idx < 32) ? ((1.0f / 1024.0f) * idx) : ((1.0f / 32.0f) * (idx - 31));
+            a         = (a > 1.0f ? 1.0f : a) * fStretchFactor;
+            float v   = (float)pow(a, 0.1593017578125);
+            uint32_t bits;
+            memcpy(&bits, &v, sizeof(bits));
+            Table.Lut[i * 16 + j] = (uint16_t)(((bits >> 16) & 0x8000) | ((bits >> 13) & 0x7fff));
+        }
+    }
+}
+
+static CcmKey MakeKey(int32_t type, uint16_t gx, uint16_t gy, uint16_t bx, uint16_t by,
+    uint16_t rx, uint16_t ry, uint16_t wx, uint16_t wy)
+{
+    CcmKey key = {};
+    key.CCMType                = type;
+    key.display_primaries_x[0] = gx;
+    key.display_primaries_y[0] = gy;
+    key.display_primaries_x[1] = bx;
+    key.display_primaries_y[1] = by;
+    key.display_primaries_x[2] = rx;
+    key.display_primaries_y[2] = ry;
+    key.white_point_x          = wx;
+    key.white_point_y          = wy;
+    return key;
+}
+
+//!
+//! \brief  Display gamuts in SEI mastering display units of 0.00002, green, blue, red order,
+//!         for each CCM type, plus random displays
+//!
+static std::vector<CcmKey> CcmCorpus(uint32_t randomDisplays)
+{
+    const uint16_t displays[][8] = {
+        {15000, 30000, 7500, 3000, 32000, 16500, 15635, 16450},     // BT.709
+        {13250, 34500, 7500, 3000, 34000, 16000, 15635, 16450},     // Display P3
+        {13250, 34500, 7500, 3000, 34000, 16000, 15700, 17550},     // DCI-P3
+        {8500, 39850, 6550, 2300, 35400, 14600, 15635, 16450},      // BT.2020
+        {10500, 35500, 7500, 3000, 32000, 16500, 15635, 16450},     // Adobe RGB
+    };
+    std::vector<CcmKey> corpus;
+    std::mt19937        rng(2026);
+    std::uniform_int_distribution<int> coord(1000, 40000);
+    for (int32_t type = 0; type < 3; type++)
+    {
+        for (auto &d : displays)
+        {
+            corpus.push_back(MakeKey(type, d[0], d[1], d[2], d[3], d[4], d[5], d[6], d[7]));
+        }
+        for (uint32_t i = 0; i < randomDisplays; i++)
+        {
+            corpus.push_back(MakeKey(type, coord(rng), coord(rng), coord(rng), coord(rng),
+                coord(rng), coord(rng), coord(rng), coord(rng)));
+        }
+    }
+    return corpus;
+}
+
+template<class Table>
+static void ExpectBitIdentical(const Table &cached, const Table &calculated)
+{
+    EXPECT_EQ(0, memcmp(&cached, &calculated, sizeof(Table)));
+}
+
+TEST(VphalHdrTableCacheTest, CcmCorpusIsBitIdenticalToCalculation)
+{
+    CcmCache            cache;
+    std::vector<CcmKey> corpus = CcmCorpus(20);
+    std::mt19937        rng(7);
+
+    // A stream mostly stays on a few displays, and sometimes switches to any other.
+    std::uniform_int_distribution<size_t> hot(0, 3), any(0, corpus.size() - 1), pick(0, 9);
+    for (uint32_t i = 0; i < 3000; i++)
+    {
+        const CcmKey &key = corpus[pick(rng) ? hot(rng) : any(rng)];
+        Ccm cached, calculated;
+        memset(&cached, 0xcd, sizeof(cached));
+        cache.Get(key, cached, CalcCcm);
+        CalcCcm(key, calculated);
+        ExpectBitIdentical(cached, calculated);
+    }
+    EXPECT_LT(cache.GetCalcCount(), 3000u / 2);
+}
+
+TEST(VphalHdrTableCacheTest, EveryKeyFieldMisses)
+{
+    CcmCache cache;
+    Ccm      table;
+    CcmKey   base = CcmCorpus(0)[3];
+    cache.Get(base, table, CalcCcm);
+    ASSERT_EQ(1u, cache.GetCalcCount());
+
+    uint32_t calcs = 1;
+    for (uint32_t field = 0; field < 9; field++)
+    {
+        CcmKey key = base;
+        uint16_t *fields[] = {&key.display_primaries_x[0], &key.display_primaries_x[1], &key.display_primaries_x[2],
+            &key.display_primaries_y[0], &key.display_primaries_y[1], &key.display_primaries_y[2],
+            &key.white_point_x, &key.white_point_y, nullptr};
+        if (fields[field])
+        {
+            (*fields[field])++;
+        }
+        else
+        {
+            key.CCMType++;
+        }
+
+        Ccm calculated;
+        cache.Get(key, table, CalcCcm);
+        CalcCcm(key, calculated);
+        EXPECT_EQ(++calcs, cache.GetCalcCount()) << "field " << field;
+        ExpectBitIdentical(table, calculated);
+
+        // The cache keeps the base table, which is not overwritten by its neighbours.
+        Ccm baseTable;
+        cache.Get(base, table, CalcCcm);
+        CalcCcm(base, baseTable);
+        EXPECT_EQ(calcs, cache.GetCalcCount());
+        ExpectBitIdentical(table, baseTable);
+    }
+}
+
+TEST(VphalHdrTableCacheTest, LeastRecentlyUsedIsReplaced)
+{
+    CcmCache            cache;
+    std::vector<CcmKey> corpus = CcmCorpus(10);
+    Ccm                 table;
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        cache.Get(corpus[i], table, CalcCcm);
+    }
+    cache.Get(corpus[0], table, CalcCcm);
+    EXPECT_EQ(8u, cache.GetCalcCount());
+
+    // corpus[1] is the least recently used one now.
+    cache.Get(corpus[8], table, CalcCcm);
+    cache.Get(corpus[0], table, CalcCcm);
+    cache.Get(corpus[2], table, CalcCcm);
+    EXPECT_EQ(9u, cache.GetCalcCount());
+    cache.Get(corpus[1], table, CalcCcm);
+    EXPECT_EQ(10u, cache.GetCalcCount());
+}
+
+TEST(VphalHdrTableCacheTest, OetfLutIsBitIdenticalToCalculation)
+{
+    OetfLutCache cache;
+    const float  stretchFactors[] = {0.01f, 0.01f, 0.5f, 0.01f, 1.0f, 1.0f, 0.01f};
+    uint32_t     calcs            = 0;
+    float        last             = 0.0f;
+    for (uint32_t frame = 0; frame < 300; frame++)
+    {
+        // Inverse tone mapping of every frame, with other stretch factors in between.
+        float   stretch = stretchFactors[frame % 7];
+        OetfLut cached, calculated;
+        cache.Get(stretch, cached, CalcOetfLut);
+        CalcOetfLut(stretch, calculated);
+        ExpectBitIdentical(cached, calculated);
+        calcs += (stretch != last);
+        last = stretch;
+    }
+    EXPECT_EQ(calcs, cache.GetCalcCount());
+
+    OetfLutCache itm;
+    OetfLut      lut;
+    for (uint32_t frame = 0; frame < 300; frame++)
+    {
+        itm.Get(0.01f, lut, CalcOetfLut);
+    }
+    EXPECT_EQ(1u, itm.GetCalcCount());
+}
+
+TEST(VphalHdrTableCacheTest, ConcurrentInstancesGetCalculatedTables)
+{
+    CcmCache            cache;
+    std::vector<CcmKey> corpus = CcmCorpus(4);
+    std::vector<std::thread> threads;
+    std::vector<int>         mismatches(4, 0);
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(t);
+            std::uniform_int_distribution<size_t> any(0, corpus.size() - 1);
+            for (uint32_t i = 0; i < 2000; i++)
+            {
+                const CcmKey &key = corpus[any(rng)];
+                Ccm cached, calculated;
+                cache.Get(key, cached, CalcCcm);
+                CalcCcm(key, calculated);
+                mismatches[t] += memcmp(&cached, &calculated, sizeof(Ccm)) != 0;
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    for (int t = 0; t < 4; t++)
+    {
+        EXPECT_EQ(0, mismatches[t]);
+    }
+}
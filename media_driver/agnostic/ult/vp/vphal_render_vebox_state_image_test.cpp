@@ -0,0 +1,335 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "vphal_render_vebox_state_image.h"
+#include <random>
+#include <vector>
+
+//!
+//! \brief  Stand-in of VPHAL_VEBOX_STATE_IMAGE_KEY, zeroed before being filled
+//!
+struct FakeStateKey
+{
+    bool     bDndi;
+    bool     bIecp;
+    bool     bHdr3DLut;
+    bool     bBT2020TosRGB;
+    uint32_t dwDenoiseFactor;
+    uint8_t  bDeinterlace;
+    float    fAceLevel;
+    uint16_t wSaturation;
+    int32_t  iGamutMatrix[9];
+};
+
+//!
+//! \brief  Render params of one frame
+//!
+struct FrameParams
+{
+    bool     bDndi;
+    uint32_t dwDenoiseFactor;
+    bool     bDeinterlace;
+    bool     bIecp;
+    float    fAceLevel;
+    uint16_t wSaturation;
+    bool     bHdr3DLut;
+    bool     bBT2020TosRGB;
+    int32_t  iGamutScale;
+    bool     bLut;          //!< Refers to a system memory table, so it is not cacheable
+};
+
+#define FAKE_INSTANCE_SIZE  256
+#define FAKE_INSTANCES      3
+
+//!
+//! \brief  Vebox heap ring like MhwVeboxInterface, AssignVeboxState zeroes the instance
+//!
+class FakeVeboxHeap
+{
+public:
+    FakeVeboxHeap(uint32_t instanceSize = FAKE_INSTANCE_SIZE) :
+        m_instanceSize(instanceSize), m_mem(instanceSize * FAKE_INSTANCES, 0xee) {}
+
+    uint8_t *AssignVeboxState()
+    {
+        m_cur  = m_next;
+        m_next = (m_next + 1) % FAKE_INSTANCES;
+        memset(Instance(), 0, m_instanceSize);
+        return Instance();
+    }
+
+    uint8_t *Instance()
+    {
+        return m_mem.data() + m_cur * m_instanceSize;
+    }
+
+    uint32_t m_instanceSize;
+
+private:
+    std::vector<uint8_t> m_mem;
+    uint32_t             m_cur  = 0;
+    uint32_t             m_next = 0;
+};
+
+//!
+//! \brief  Stand-in of the MHW Add*State calls, each writes its own section of the instance
+//!
+static MOS_STATUS AddIndirectStates(const FrameParams &params, uint8_t *instance, uint32_t *buildCount)
+{
+    (*buildCount)++;
+    if (params.bDndi)
+    {
+        for (uint32_t i = 0; i < 48; i++)
+        {
+            instance[i] = (uint8_t)(params.dwDenoiseFactor * (i + 1) + (params.bDeinterlace ? 0x80 : 0));
+        }
+    }
+    if (params.bIecp)
+    {
+        memcpy(instance + 48, &params.fAceLevel, sizeof(float));
+        memcpy(instance + 52, &params.wSaturation, sizeof(uint16_t));
+        for (uint32_t i = 56; i < 112; i++)
+        {
+            instance[i] = (uint8_t)(params.wSaturation ^ i);
+        }
+    }
+    if (params.bLut)
+    {
+        for (uint32_t i = 112; i < 160; i++)
+        {
+            instance[i] = (uint8_t)(i * 7);
+        }
+    }
+    if (params.bHdr3DLut)
+    {
+        for (uint32_t i = 160; i < 200; i++)
+        {
+            instance[i] = (uint8_t)(params.iGamutScale + i);
+        }
+    }
+    if (params.bBT2020TosRGB)
+    {
+        for (uint32_t i = 200; i < FAKE_INSTANCE_SIZE; i++)
+        {
+            instance[i] = (uint8_t)(params.iGamutScale * 3 - i);
+        }
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
+//!
+//! \brief  Same flow as VeboxBuildStateImageKey
+//!
+static bool BuildKey(const FrameParams &params, FakeStateKey *key)
+{
+    memset(key, 0, sizeof(*key));
+    if (params.bLut)
+    {
+        return false;
+    }
+    if (params.bDndi)
+    {
+        key->bDndi           = true;
+        key->dwDenoiseFactor = params.dwDenoiseFactor;
+        key->bDeinterlace    = params.bDeinterlace;
+    }
+    if (params.bIecp)
+    {
+        key->bIecp       = true;
+        key->fAceLevel   = params.fAceLevel;
+        key->wSaturation = params.wSaturation;
+    }
+    key->bHdr3DLut     = params.bHdr3DLut;
+    key->bBT2020TosRGB = params.bBT2020TosRGB;
+    if (params.bHdr3DLut || params.bBT2020TosRGB)
+    {
+        for (int32_t i = 0; i < 9; i++)
+        {
+            key->iGamutMatrix[i] = params.iGamutScale * (i + 1);
+        }
+    }
+    return true;
+}
+
+//!
+//! \brief  Same flow as VeboxSetupIndirectStates, returns the instance the vebox command points to
+//!
+static std::vector<uint8_t> SetupFrame(
+    FakeVeboxHeap &heap, VphalVeboxStateImage<FakeStateKey> *image, const FrameParams &params,
+    uint32_t *buildCount)
+{
+    uint8_t     *instance = heap.AssignVeboxState();
+    FakeStateKey key;
+
+    if (image)
+    {
+        bool cacheable = BuildKey(params, &key);
+        EXPECT_EQ(MOS_STATUS_SUCCESS, image->Setup(cacheable ? &key : nullptr, instance, heap.m_instanceSize,
+            [&]() { return AddIndirectStates(params, instance, buildCount); }));
+    }
+    else
+    {
+        EXPECT_EQ(MOS_STATUS_SUCCESS, AddIndirectStates(params, instance, buildCount));
+    }
+    return std::vector<uint8_t>(instance, instance + heap.m_instanceSize);
+}
+
+static FrameParams DefaultParams()
+{
+    FrameParams params = {};
+    params.bDndi           = true;
+    params.dwDenoiseFactor = 32;
+    params.bIecp           = true;
+    params.fAceLevel       = 0.5f;
+    params.wSaturation     = 100;
+    params.iGamutScale     = 3;
+    return params;
+}
+
+TEST(VphalVeboxStateImageTest, ReplayedFramesAreByteIdenticalToBuiltFrames)
+{
+    FakeVeboxHeap                      builtHeap, replayedHeap;
+    VphalVeboxStateImage<FakeStateKey> image;
+    FrameParams                        params = DefaultParams();
+    std::mt19937                       rng(2026);
+    std::uniform_int_distribution<int> change(0, 39);
+    uint32_t                           builds = 0, replayBuilds = 0;
+
+    // Playback mostly keeps its params, and sometimes toggles or tunes one of them.
+    for (uint32_t frame = 0; frame < 2000; frame++)
+    {
+        switch (change(rng))
+        {
+        case 0: params.bDndi           = !params.bDndi;              break;
+        case 1: params.dwDenoiseFactor = (params.dwDenoiseFactor + 5) % 64; break;
+        case 2: params.bDeinterlace    = !params.bDeinterlace;       break;
+        case 3: params.bIecp           = !params.bIecp;              break;
+        case 4: params.fAceLevel       = -params.fAceLevel;          break;
+        case 5: params.wSaturation    += 3;                          break;
+        case 6: params.bHdr3DLut       = !params.bHdr3DLut;          break;
+        case 7: params.bBT2020TosRGB   = !params.bBT2020TosRGB;      break;
+        case 8: params.iGamutScale++;                                break;
+        case 9: params.bLut            = !params.bLut;               break;
+        default:                                                     break;
+        }
+
+        std::vector<uint8_t> built    = SetupFrame(builtHeap, nullptr, params, &builds);
+        std::vector<uint8_t> replayed = SetupFrame(replayedHeap, &image, params, &replayBuilds);
+        ASSERT_EQ(built, replayed) << "frame " << frame;
+    }
+
+    EXPECT_EQ(2000u, builds);
+    EXPECT_EQ(2000u, replayBuilds + image.GetReplayCount());
+    // LUT frames are about half of them and never replayed
+    EXPECT_GT(image.GetReplayCount(), 2000u / 3);
+}
+
+TEST(VphalVeboxStateImageTest, EveryKeyFieldRebuilds)
+{
+    FakeVeboxHeap                      heap;
+    VphalVeboxStateImage<FakeStateKey> image;
+    FrameParams                        base = DefaultParams();
+    uint32_t                           builds = 0;
+
+    SetupFrame(heap, &image, base, &builds);
+    SetupFrame(heap, &image, base, &builds);
+    ASSERT_EQ(1u, builds);
+
+    for (uint32_t field = 0; field < 8; field++)
+    {
+        FrameParams params = base;
+        switch (field)
+        {
+        case 0: params.bDndi           = false; break;
+        case 1: params.dwDenoiseFactor = 33;    break;
+        case 2: params.bDeinterlace    = true;  break;
+        case 3: params.bIecp           = false; break;
+        case 4: params.fAceLevel       = 0.25f; break;
+        case 5: params.wSaturation     = 101;   break;
+        case 6: params.bHdr3DLut       = true;  break;
+        case 7: params.bBT2020TosRGB   = true;  break;
+        }
+        SetupFrame(heap, &image, params, &builds);
+        EXPECT_EQ(2 + 2 * field, builds) << "field " << field;
+        SetupFrame(heap, &image, base, &builds);
+        EXPECT_EQ(3 + 2 * field, builds) << "field " << field;
+    }
+}
+
+TEST(VphalVeboxStateImageTest, UncacheableFrameDropsTheImage)
+{
+    FakeVeboxHeap                      heap;
+    VphalVeboxStateImage<FakeStateKey> image;
+    FrameParams                        params = DefaultParams();
+    uint32_t                           builds = 0;
+
+    SetupFrame(heap, &image, params, &builds);
+    params.bLut = true;
+    SetupFrame(heap, &image, params, &builds);
+    SetupFrame(heap, &image, params, &builds);
+    EXPECT_EQ(3u, builds);
+
+    // The last image holds the LUT section, it must not be replayed for the params without LUT
+    params.bLut = false;
+    std::vector<uint8_t> frame = SetupFrame(heap, &image, params, &builds);
+    EXPECT_EQ(4u, builds);
+    EXPECT_EQ(0, frame[120]);
+    EXPECT_EQ(0u, image.GetReplayCount());
+}
+
+TEST(VphalVeboxStateImageTest, FailedBuildIsNotReplayed)
+{
+    FakeVeboxHeap                      heap;
+    VphalVeboxStateImage<FakeStateKey> image;
+    FakeStateKey                       key;
+    FrameParams                        params = DefaultParams();
+    uint32_t                           builds = 0;
+
+    BuildKey(params, &key);
+    uint8_t *instance = heap.AssignVeboxState();
+    EXPECT_EQ(MOS_STATUS_NO_SPACE, image.Setup(&key, instance, heap.m_instanceSize, [&]() {
+        instance[0] = 0x5a;
+        builds++;
+        return MOS_STATUS_NO_SPACE;
+    }));
+
+    std::vector<uint8_t> frame = SetupFrame(heap, &image, params, &builds);
+    EXPECT_EQ(2u, builds);
+    EXPECT_NE(0x5a, frame[0]);
+    EXPECT_EQ(0u, image.GetReplayCount());
+}
+
+TEST(VphalVeboxStateImageTest, InstanceSizeChangeRebuilds)
+{
+    FakeVeboxHeap                      small(FAKE_INSTANCE_SIZE), large(FAKE_INSTANCE_SIZE * 2);
+    VphalVeboxStateImage<FakeStateKey> image;
+    FrameParams                        params = DefaultParams();
+    uint32_t                           builds = 0;
+
+    SetupFrame(small, &image, params, &builds);
+    SetupFrame(large, &image, params, &builds);
+    EXPECT_EQ(2u, builds);
+    SetupFrame(large, &image, params, &builds);
+    EXPECT_EQ(2u, builds);
+    EXPECT_EQ(1u, image.GetReplayCount());
+}
@@ -20,6 +20,8 @@
 * OTHER DEALINGS IN THE SOFTWARE.
 */
 #include <cstring>
+#include "mos_defs.h"
+#include "mos_util_debug.h"
 
 using namespace std;
 
@@ -35,6 +37,33 @@ void MOS_ZeroMemory(void *pDestination, size_t stLength)
     }
 }
 
+void MOS_FillMemory(void *pDestination, size_t stLength, uint8_t bFill)
+{
+    if(pDestination != nullptr)
+    {
+        memset(pDestination, bFill, stLength);
+    }
+}
+
+MOS_STATUS MOS_SecureMemcpy(void *pDestination, size_t dstLength, const void *pSource, size_t srcLength)
+{
+    if ((pDestination == nullptr) || (pSource == nullptr) || (dstLength < srcLength))
+    {
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+    if (pDestination != pSource)
+    {
+        memcpy(pDestination, pSource, srcLength);
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
+#if MOS_ASSERT_ENABLED
+void _MOS_Assert(MOS_COMPONENT_ID compID, uint8_t subCompID)
+{
+}
+#endif
+
 #ifdef __cplusplus
     } // extern "C" 
 #endif
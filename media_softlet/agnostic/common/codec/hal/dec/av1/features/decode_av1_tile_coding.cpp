@@ -25,6 +25,7 @@
 //!
 
 #include "decode_av1_tile_coding.h"
+#include "decode_av1_tile_layout.h"
 #include "decode_av1_basic_feature.h"
 #include "codec_def_common.h"
 #include "mhw_vdbox_avp_g12_X.h"
@@ -35,11 +36,8 @@ namespace decode
     Av1DecodeTile::~Av1DecodeTile()
     {
         // tile descriptors
-        if (m_tileDesc)
-        {
-            delete m_tileDesc;
-            m_tileDesc = nullptr;
-        }
+        MOS_FreeMemAndSetNull(m_tileDesc);
+        m_tileDescNum = 0;
     }
 
     MOS_STATUS Av1DecodeTile::Init(Av1BasicFeature *basicFeature, CodechalSetting *codecSettings)
@@ -82,21 +80,7 @@ namespace decode
         }
 
         uint16_t tileNumLimit = (picParams.m_picInfoFlags.m_fields.m_largeScaleTile) ? av1MaxTileNum : (picParams.m_tileCols * picParams.m_tileRows);
-        if (nullptr != m_tileDesc &&
-            (m_prevFrmTileNum < tileNumLimit))
-        {
-            delete m_tileDesc;
-            m_tileDesc = nullptr;
-        }
-        if (nullptr == m_tileDesc)
-        {
-            m_tileDesc = (TileDesc *)malloc(sizeof(TileDesc) * tileNumLimit);
-            if (nullptr != m_tileDesc)
-            {
-                memset(m_tileDesc, 0, (sizeof(TileDesc) * tileNumLimit));
-            }
-        }
-        m_prevFrmTileNum = tileNumLimit;
+        DECODE_CHK_STATUS(AllocateTileDesc(tileNumLimit));
 
         //Calculate tile info for max tile
         DECODE_CHK_STATUS(CalcTileInfoMaxTile(picParams));
@@ -104,6 +88,27 @@ namespace decode
         return MOS_STATUS_SUCCESS;
     }
 
+    MOS_STATUS Av1DecodeTile::AllocateTileDesc(uint16_t tileNum)
+    {
+        DECODE_FUNC_CALL();
+
+        // Tile descriptors are fully rewritten by ParseTileInfo for every received tile,
+        // so the storage only grows and is reused across frames.
+        if (m_tileDesc != nullptr && m_tileDescNum >= tileNum)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+
+        MOS_FreeMemAndSetNull(m_tileDesc);
+        m_tileDescNum = 0;
+
+        m_tileDesc = (TileDesc *)MOS_AllocAndZeroMemory(sizeof(TileDesc) * tileNum);
+        DECODE_CHK_NULL(m_tileDesc);
+        m_tileDescNum = tileNum;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
     MOS_STATUS Av1DecodeTile::ParseTileInfo(const CodecAv1PicParams & picParams, CodecAv1TileParams *tileParams)
     {
         DECODE_FUNC_CALL();
@@ -177,20 +182,7 @@ namespace decode
         DECODE_FUNC_CALL();
 
         int32_t mibSizeLog2 = picParams.m_seqInfoFlags.m_fields.m_use128x128Superblock ? av1MaxMibSizeLog2 : av1MinMibSizeLog2;
-        int32_t miCols = MOS_ALIGN_CEIL(m_miCols, 1 << mibSizeLog2);
-        int32_t sbCols = miCols >> mibSizeLog2;
-
-        //calc tile col start for all the tiles except the last one
-        uint16_t i, start_sb = 0;
-        for (i = 0, start_sb = 0; i < picParams.m_tileCols - 1; i++)
-        {
-            m_tileColStartSb[i] = start_sb;//calc tile col start
-            start_sb += picParams.m_widthInSbsMinus1[i] + 1;
-        }
-
-        //calc for the last tile
-        m_tileColStartSb[i] = start_sb;
-        picParams.m_widthInSbsMinus1[i] = sbCols - start_sb - 1;
+        Av1TileLayout::CalcTileStartSb(m_miCols, mibSizeLog2, picParams.m_tileCols, picParams.m_widthInSbsMinus1, m_tileColStartSb);
 
         return MOS_STATUS_SUCCESS;
     }
@@ -200,20 +192,7 @@ namespace decode
         DECODE_FUNC_CALL();
 
         int32_t mibSizeLog2 = picParams.m_seqInfoFlags.m_fields.m_use128x128Superblock ? av1MaxMibSizeLog2 : av1MinMibSizeLog2;
-        int32_t miRows = MOS_ALIGN_CEIL(m_miRows, 1 << mibSizeLog2);
-        int32_t sbRows = miRows >> mibSizeLog2;
-
-        //calc tile row start for all the tiles except the last one
-        uint16_t i, start_sb;
-        for (i = 0, start_sb = 0; i < picParams.m_tileRows - 1; i++)
-        {
-            m_tileRowStartSb[i] = start_sb;//calc tile Row start
-            start_sb += picParams.m_heightInSbsMinus1[i] + 1;
-        }
-
-        //calc for the last tile
-        m_tileRowStartSb[i] = start_sb;
-        picParams.m_heightInSbsMinus1[i] = sbRows - start_sb - 1;
+        Av1TileLayout::CalcTileStartSb(m_miRows, mibSizeLog2, picParams.m_tileRows, picParams.m_heightInSbsMinus1, m_tileRowStartSb);
 
         return MOS_STATUS_SUCCESS;
     }
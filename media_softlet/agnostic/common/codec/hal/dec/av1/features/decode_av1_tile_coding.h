@@ -59,7 +59,7 @@ namespace decode
         //multiple tiles enabling
         int16_t         m_curTile                = -1;           //!< tile ID currently decoding
         int16_t         m_lastTileId             = -1;           //!< tile ID of the last tile parsed in the current execute() call
-        uint16_t        m_prevFrmTileNum         = 0;            //!< record the tile numbers in previous frame.
+        uint16_t        m_tileDescNum            = 0;            //!< number of tile descriptors allocated in m_tileDesc
         uint16_t        m_firstTileInTg          = 0;            //!< tile ID of the first tile in the current tile group
         uint16_t        m_tileGroupId            = 0;            //!< record the last tile group ID
         bool            m_isTruncatedTile        = false;        //!< flag to indicate if the last tile is truncated tile
@@ -152,6 +152,13 @@ namespace decode
         //!
         MOS_STATUS CalculateTileRows(CodecAv1PicParams & picParams);
 
+        //!
+        //! \brief    Make sure tile descriptor storage can hold the required tile number
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS AllocateTileDesc(uint16_t tileNum);
+
         //!
         //! \brief    Parse tile params to get each tile info
         //! \return   MOS_STATUS
@@ -0,0 +1,79 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     decode_av1_tile_layout.h
+//! \brief    Defines tile column/row layout arithmetic for av1 decode
+//!
+#ifndef __DECODE_AV1_TILE_LAYOUT_H__
+#define __DECODE_AV1_TILE_LAYOUT_H__
+
+#include "mos_defs.h"
+
+namespace decode
+{
+    //!
+    //! \class  Av1TileLayout
+    //! \brief  Tile start superblocks of one frame dimension
+    //!
+    class Av1TileLayout
+    {
+    public:
+        //!
+        //! \brief    Calculate tile start superblocks along a frame dimension
+        //! \details  Sizes of all tiles but the last one come from the app, the
+        //!           last tile takes the remaining superblocks of the frame
+        //! \param    [in] miNum
+        //!           Frame width or height in MI units (4x4)
+        //! \param    [in] mibSizeLog2
+        //!           Log2 of MI units per superblock
+        //! \param    [in] tileNum
+        //!           Number of tile columns or rows
+        //! \param    [in, out] sizeInSbsMinus1
+        //!           Tile sizes in superblocks minus 1, the last one is written
+        //! \param    [out] startSb
+        //!           Start superblock of each tile
+        //!
+        static void CalcTileStartSb(
+            int32_t  miNum,
+            int32_t  mibSizeLog2,
+            uint16_t tileNum,
+            uint16_t *sizeInSbsMinus1,
+            uint16_t *startSb)
+        {
+            int32_t sbNum = MOS_ALIGN_CEIL(miNum, 1 << mibSizeLog2) >> mibSizeLog2;
+
+            //calc tile start for all the tiles except the last one
+            uint16_t i, start_sb;
+            for (i = 0, start_sb = 0; i < tileNum - 1; i++)
+            {
+                startSb[i] = start_sb;
+                start_sb += sizeInSbsMinus1[i] + 1;
+            }
+
+            //calc for the last tile
+            startSb[i]         = start_sb;
+            sizeInSbsMinus1[i] = sbNum - start_sb - 1;
+        }
+    };
+}  // namespace decode
+
+#endif  // __DECODE_AV1_TILE_LAYOUT_H__
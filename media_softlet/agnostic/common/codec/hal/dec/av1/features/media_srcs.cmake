@@ -34,6 +34,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/decode_av1_feature_manager.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_av1_basic_feature.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_av1_tile_coding.h
+    ${CMAKE_CURRENT_LIST_DIR}/decode_av1_tile_layout.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_av1_temporal_buffers.h
 )
 endif()
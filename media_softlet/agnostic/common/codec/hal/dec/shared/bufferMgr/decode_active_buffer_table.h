@@ -0,0 +1,112 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     decode_active_buffer_table.h
+//! \brief    Defines the table of active reference associated buffers
+//! \details  Buffers are indexed by frame index for constant time lookup, and
+//!           the active frame indices are kept in ascending order.
+//!
+
+#ifndef __DECODE_ACTIVE_BUFFER_TABLE_H__
+#define __DECODE_ACTIVE_BUFFER_TABLE_H__
+#include <algorithm>
+#include <vector>
+#include "mos_defs.h"
+
+namespace decode
+{
+
+//!
+//! \class  ActiveBufferTable
+//! \brief  Active buffers indexed by frame index, iterated in ascending frame index order
+//!
+template <class T>
+class ActiveBufferTable
+{
+public:
+    //!
+    //! \brief    Get the buffer of a frame index
+    //! \return   T*
+    //!           Buffer of the frame index, nullptr if not active
+    //!
+    T *Get(const uint32_t frameIdx) const
+    {
+        if (frameIdx >= m_buffers.size())
+        {
+            return nullptr;
+        }
+        return m_buffers[frameIdx];
+    }
+
+    //!
+    //! \brief    Activate the buffer for a frame index
+    //! \details  The frame index must not be active.
+    //!
+    void Add(const uint32_t frameIdx, T *buffer)
+    {
+        if (frameIdx >= m_buffers.size())
+        {
+            m_buffers.resize(frameIdx + 1, nullptr);
+        }
+        m_buffers[frameIdx] = buffer;
+
+        auto pos = std::lower_bound(m_frameIndices.begin(), m_frameIndices.end(), frameIdx);
+        m_frameIndices.insert(pos, frameIdx);
+    }
+
+    //!
+    //! \brief    Deactivate the buffer at a position of the ascending frame indices
+    //! \return   T*
+    //!           The deactivated buffer
+    //!
+    T *RemoveAt(const uint32_t pos)
+    {
+        uint32_t frameIdx   = m_frameIndices[pos];
+        T       *buffer     = m_buffers[frameIdx];
+        m_buffers[frameIdx] = nullptr;
+        m_frameIndices.erase(m_frameIndices.begin() + pos);
+        return buffer;
+    }
+
+    //!
+    //! \brief    Get the frame index at a position of the ascending frame indices
+    //!
+    uint32_t GetFrameIndex(const uint32_t pos) const { return m_frameIndices[pos]; }
+
+    //!
+    //! \brief    Get the number of active buffers
+    //!
+    uint32_t GetCount() const { return (uint32_t)m_frameIndices.size(); }
+
+    void Clear()
+    {
+        m_buffers.clear();
+        m_frameIndices.clear();
+    }
+
+private:
+    std::vector<T *>      m_buffers;        //!< Active buffers indexed by frame index, nullptr if not active
+    std::vector<uint32_t> m_frameIndices;   //!< Frame indices of active buffers in ascending order
+};
+
+}  // namespace decode
+#endif  // !__DECODE_ACTIVE_BUFFER_TABLE_H__
@@ -29,6 +29,7 @@
 #include "decode_allocator.h"
 #include "decode_utils.h"
 #include "decode_resource_array.h"
+#include "media_status_report.h"
 
 namespace decode {
 
@@ -44,6 +45,7 @@ DecodeAllocator::DecodeAllocator(PMOS_INTERFACE osInterface, bool limitedLMemBar
 
 DecodeAllocator::~DecodeAllocator()
 {
+    TrimBufferPool(0);
     MOS_Delete(m_allocator);
 }
 
@@ -55,21 +57,25 @@ MOS_BUFFER* DecodeAllocator::AllocateBuffer(
     if (!m_allocator)
         return nullptr;
 
-    MOS_ALLOC_GFXRES_PARAMS allocParams;
-    MOS_ZeroMemory(&allocParams, sizeof(MOS_ALLOC_GFXRES_PARAMS));
-    allocParams.Type            = MOS_GFXRES_BUFFER;
-    allocParams.TileType        = MOS_TILE_LINEAR;
-    allocParams.Format          = Format_Buffer;
-    allocParams.dwBytes         = sizeOfBuffer;
-    allocParams.pBufName        = nameOfBuffer;
-    allocParams.bIsPersistent   = bPersistent;
-    allocParams.ResUsageType    = static_cast<MOS_HW_RESOURCE_DEF>(resUsageType);
-    SetAccessRequirement(accessReq, allocParams);
-
-    MOS_BUFFER* buffer = m_allocator->AllocateBuffer(allocParams, false, COMPONENT_Decode);
+    MOS_BUFFER* buffer = AcquirePooledBuffer(sizeOfBuffer, resUsageType, bPersistent);
     if (buffer == nullptr)
     {
-        return nullptr;
+        MOS_ALLOC_GFXRES_PARAMS allocParams;
+        MOS_ZeroMemory(&allocParams, sizeof(MOS_ALLOC_GFXRES_PARAMS));
+        allocParams.Type            = MOS_GFXRES_BUFFER;
+        allocParams.TileType        = MOS_TILE_LINEAR;
+        allocParams.Format          = Format_Buffer;
+        allocParams.dwBytes         = sizeOfBuffer;
+        allocParams.pBufName        = nameOfBuffer;
+        allocParams.bIsPersistent   = bPersistent;
+        allocParams.ResUsageType    = static_cast<MOS_HW_RESOURCE_DEF>(resUsageType);
+        SetAccessRequirement(accessReq, allocParams);
+
+        buffer = m_allocator->AllocateBuffer(allocParams, false, COMPONENT_Decode);
+        if (buffer == nullptr)
+        {
+            return nullptr;
+        }
     }
 
     if (initOnAllocate)
@@ -406,6 +412,13 @@ MOS_STATUS DecodeAllocator::Destroy(MOS_BUFFER* & buffer)
         return MOS_STATUS_SUCCESS;
     }
 
+    if (ReleaseToPool(buffer))
+    {
+        buffer = nullptr;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    m_bufferPool.Remove(buffer);
     DECODE_CHK_STATUS(m_allocator->DestroyBuffer(buffer));
     buffer = nullptr;
     return MOS_STATUS_SUCCESS;
@@ -503,9 +516,78 @@ MOS_STATUS DecodeAllocator::DestroyAllResources()
 {
     DECODE_CHK_NULL(m_allocator);
 
+    // Pooled buffers are still tracked by allocator and get destroyed together
+    m_bufferPool.Clear();
+
     return m_allocator->DestroyAllResources();
 }
 
+void DecodeAllocator::SetStatusReport(MediaStatusReport *statusReport)
+{
+    m_statusReport = statusReport;
+}
+
+MOS_STATUS DecodeAllocator::SetBufferPoolBudget(const uint32_t budget)
+{
+    m_bufferPoolBudget = budget;
+    return TrimBufferPool(budget);
+}
+
+MOS_BUFFER* DecodeAllocator::AcquirePooledBuffer(const uint32_t size, ResourceUsage resUsageType, bool bPersistent)
+{
+    if (m_statusReport == nullptr)
+    {
+        return nullptr;
+    }
+
+    return m_bufferPool.Acquire(size, resUsageType, bPersistent, m_statusReport->GetCompletedCount());
+}
+
+bool DecodeAllocator::ReleaseToPool(MOS_BUFFER* buffer)
+{
+    // Resource placement depends on access requirement with limited LMem bar config,
+    // which cannot be recovered from a buffer, so recycling is skipped there.
+    if (m_statusReport == nullptr || m_limitedLMemBar || buffer == nullptr ||
+        buffer->OsResource.pGmmResInfo == nullptr)
+    {
+        return false;
+    }
+
+    // Frame under construction reports submitted count + 1 when it is completed
+    if (!m_bufferPool.Release(
+            buffer,
+            buffer->size,
+            ConvertGmmResourceUsage(buffer->OsResource.pGmmResInfo->GetCachePolicyUsage()),
+            buffer->bPersistent,
+            m_statusReport->GetSubmittedCount() + 1,
+            m_bufferPoolBudget))
+    {
+        return false;
+    }
+
+    // Released buffer fits the budget alone, so only older buffers are evicted.
+    // It is owned by the pool now and must not be destroyed by caller.
+    if (TrimBufferPool(m_bufferPoolBudget) != MOS_STATUS_SUCCESS)
+    {
+        DECODE_ASSERTMESSAGE("Failed to trim buffer pool");
+    }
+
+    return true;
+}
+
+MOS_STATUS DecodeAllocator::TrimBufferPool(const uint32_t budget)
+{
+    DECODE_CHK_NULL(m_allocator);
+
+    MOS_BUFFER *buffer = nullptr;
+    while ((buffer = m_bufferPool.Evict(budget)) != nullptr)
+    {
+        DECODE_CHK_STATUS(m_allocator->DestroyBuffer(buffer));
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS DecodeAllocator::SyncOnResource(MOS_RESOURCE* resource, bool IsWriteOperation)
 {
     DECODE_CHK_NULL(resource);
@@ -29,8 +29,12 @@
 #ifndef __DECODE_ALLOCATOR_H__
 #define __DECODE_ALLOCATOR_H__
 
+#include <vector>
 #include "media_allocator.h"
 #include "mhw_utilities.h"
+#include "decode_buffer_pool.h"
+
+class MediaStatusReport;
 
 namespace decode {
 
@@ -504,7 +508,66 @@ public:
     //!
     ResourceUsage ConvertGmmResourceUsage(const GMM_RESOURCE_USAGE_TYPE gmmResUsage);
 
+    //!
+    //! \brief  Set status report used to track GPU completion of destroyed buffers
+    //! \details Destroyed buffers are kept in a recycle pool and reused by later buffer
+    //!          allocations once the frames submitted before their release are completed.
+    //!          Pass nullptr to stop recycling, buffers are destroyed immediately then.
+    //! \param  [in] statusReport
+    //!         Pointer to status report
+    //! \return void
+    //!
+    void SetStatusReport(MediaStatusReport *statusReport);
+
+    //!
+    //! \brief  Set upper memory budget of buffer recycle pool
+    //! \param  [in] budget
+    //!         Max total size in bytes of buffers kept in pool, 0 disables recycling
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS SetBufferPoolBudget(const uint32_t budget);
+
+    //!
+    //! \brief  Get total size of buffers kept in recycle pool
+    //! \return uint32_t
+    //!         Total allocation size in bytes
+    //!
+    uint32_t GetBufferPoolSize() { return m_bufferPool.GetSize(); }
+
 protected:
+    //!
+    //! \brief    Take one completed buffer which can hold the requested size from recycle pool
+    //! \param    [in] size
+    //!           Requested buffer size
+    //! \param    [in] resUsageType
+    //!           Requested resource usage
+    //! \param    [in] bPersistent
+    //!           Requested persistent flag
+    //! \return   MOS_BUFFER*
+    //!           Recycled buffer, nullptr if no buffer matches
+    //!
+    MOS_BUFFER* AcquirePooledBuffer(const uint32_t size, ResourceUsage resUsageType, bool bPersistent);
+
+    //!
+    //! \brief    Keep buffer in recycle pool instead of destroying it
+    //! \param    [in] buffer
+    //!           Buffer to be released
+    //! \return   bool
+    //!           true if buffer is kept in pool, false if caller should destroy it
+    //!
+    bool ReleaseToPool(MOS_BUFFER* buffer);
+
+    //!
+    //! \brief    Destroy pooled buffers until pool size is not larger than budget
+    //! \param    [in] budget
+    //!           Pool size limitation in bytes
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS TrimBufferPool(const uint32_t budget);
+
+
     //!
     //! \brief    Apply resource access requirement to allocate parameters
     //! \details  Apply resource access requirement to allocate parameters
@@ -520,6 +583,12 @@ protected:
     Allocator *m_allocator = nullptr;
     bool m_limitedLMemBar = false; //!< Indicate if running with limited LMem bar config
 
+    static const uint32_t m_defaultBufferPoolBudget = 32 * 1024 * 1024; //!< Default budget of buffer recycle pool
+
+    MediaStatusReport                     *m_statusReport    = nullptr;                   //!< Status report to track GPU completion
+    BufferPool<MOS_BUFFER, ResourceUsage> m_bufferPool;                                   //!< Buffers kept for recycle
+    uint32_t                              m_bufferPoolBudget = m_defaultBufferPoolBudget; //!< Max total allocation size of pooled buffers
+
 #if (_DEBUG || _RELEASE_INTERNAL)
     bool m_forceLockable = false;
 #endif
@@ -0,0 +1,236 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     decode_buffer_pool.h
+//! \brief    Defines the recycle pool of destroyed decode buffers
+//! \details  Released buffers are kept with their allocation size and the
+//!           submitted count at release time, and are handed out again once
+//!           the GPU completed that count.
+//!
+
+#ifndef __DECODE_BUFFER_POOL_H__
+#define __DECODE_BUFFER_POOL_H__
+#include <map>
+#include <vector>
+#include "mos_defs.h"
+
+namespace decode
+{
+
+//!
+//! \class  BufferPool
+//! \brief  Recycle pool of buffers matched by size class, usage and persistent flag
+//!
+template <class T, class Usage>
+class BufferPool
+{
+public:
+    //!
+    //! \brief    Take one completed buffer which can hold the requested size
+    //! \param    [in] size
+    //!           Requested buffer size
+    //! \param    [in] usage
+    //!           Requested resource usage
+    //! \param    [in] persistent
+    //!           Requested persistent flag
+    //! \param    [in] completedCount
+    //!           Count of frames completed by GPU
+    //! \return   T*
+    //!           Recycled buffer, nullptr if no buffer matches
+    //!
+    T *Acquire(const uint32_t size, const Usage usage, const bool persistent, const uint32_t completedCount)
+    {
+        uint32_t sizeClass = GetSizeClass(size);
+
+        for (auto iter = m_entries.begin(); iter != m_entries.end(); iter++)
+        {
+            if (iter->sizeClass != sizeClass || iter->allocSize < size ||
+                iter->usage != usage || iter->persistent != persistent)
+            {
+                continue;
+            }
+
+            // Reuse only after GPU completed the frames which may still access this buffer
+            if ((int32_t)(completedCount - iter->releaseCount) < 0)
+            {
+                continue;
+            }
+
+            T *buffer = iter->buffer;
+            m_size -= iter->allocSize;
+            // Caller may shrink the buffer size to the request, keep the real one
+            m_allocSizes[buffer] = iter->allocSize;
+            m_entries.erase(iter);
+            return buffer;
+        }
+
+        return nullptr;
+    }
+
+    //!
+    //! \brief    Keep buffer in pool instead of destroying it
+    //! \details  Buffers previously taken from pool are recorded with their
+    //!           original allocation size instead of the reported one
+    //! \param    [in] buffer
+    //!           Buffer to be released
+    //! \param    [in] size
+    //!           Reported buffer size
+    //! \param    [in] usage
+    //!           Resource usage of buffer
+    //! \param    [in] persistent
+    //!           Persistent flag of buffer
+    //! \param    [in] releaseCount
+    //!           Completed count after which buffer can be reused
+    //! \param    [in] budget
+    //!           Pool size limitation in bytes
+    //! \return   bool
+    //!           true if buffer is kept in pool, false if caller should destroy it
+    //!
+    bool Release(
+        T             *buffer,
+        const uint32_t size,
+        const Usage    usage,
+        const bool     persistent,
+        const uint32_t releaseCount,
+        const uint32_t budget)
+    {
+        uint32_t allocSize = size;
+        auto     iter      = m_allocSizes.find(buffer);
+        if (iter != m_allocSizes.end())
+        {
+            allocSize = iter->second;
+            m_allocSizes.erase(iter);
+        }
+
+        if (allocSize == 0 || allocSize > budget)
+        {
+            return false;
+        }
+
+        Entry entry;
+        entry.buffer       = buffer;
+        entry.allocSize    = allocSize;
+        entry.usage        = usage;
+        entry.persistent   = persistent;
+        entry.sizeClass    = GetSizeClass(allocSize);
+        entry.releaseCount = releaseCount;
+
+        m_entries.push_back(entry);
+        m_size += allocSize;
+        return true;
+    }
+
+    //!
+    //! \brief    Stop tracking buffer destroyed outside of pool
+    //! \param    [in] buffer
+    //!           Buffer to be destroyed
+    //!
+    void Remove(T *buffer)
+    {
+        m_allocSizes.erase(buffer);
+    }
+
+    //!
+    //! \brief    Take out the oldest buffer while pool size exceeds budget
+    //! \details  The newest buffer is never evicted by its own release since
+    //!           it fits the budget alone
+    //! \param    [in] budget
+    //!           Pool size limitation in bytes
+    //! \return   T*
+    //!           Buffer to be destroyed by caller, nullptr if pool fits budget
+    //!
+    T *Evict(const uint32_t budget)
+    {
+        if (m_size <= budget || m_entries.empty())
+        {
+            return nullptr;
+        }
+
+        T *buffer = m_entries.front().buffer;
+        m_size -= m_entries.front().allocSize;
+        m_entries.erase(m_entries.begin());
+        return buffer;
+    }
+
+    //!
+    //! \brief    Forget all buffers without destroying them
+    //!
+    void Clear()
+    {
+        m_entries.clear();
+        m_allocSizes.clear();
+        m_size = 0;
+    }
+
+    //!
+    //! \brief    Get total allocation size of buffers kept in pool
+    //! \return   uint32_t
+    //!           Total size in bytes
+    //!
+    uint32_t GetSize() const { return m_size; }
+
+    //!
+    //! \brief    Get number of buffers kept in pool
+    //! \return   uint32_t
+    //!           Number of buffers
+    //!
+    uint32_t GetCount() const { return (uint32_t)m_entries.size(); }
+
+    //!
+    //! \brief    Get size class of buffer
+    //! \param    [in] size
+    //!           Buffer size
+    //! \return   uint32_t
+    //!           Log2 of buffer size rounded up to power of two
+    //!
+    static uint32_t GetSizeClass(const uint32_t size)
+    {
+        uint32_t sizeClass = 0;
+        while (sizeClass < 32 && (1ull << sizeClass) < size)
+        {
+            sizeClass++;
+        }
+        return sizeClass;
+    }
+
+protected:
+    //!
+    //! \struct Entry
+    //! \brief  Buffer kept in pool
+    //!
+    struct Entry
+    {
+        T        *buffer;           //!< Recycled buffer
+        uint32_t allocSize;         //!< Allocation size of buffer
+        Usage    usage;             //!< Resource usage of buffer
+        bool     persistent;        //!< Persistent flag of buffer
+        uint32_t sizeClass;         //!< Size class of allocation size
+        uint32_t releaseCount;      //!< Submitted count when released, reusable after completed
+    };
+
+    std::vector<Entry>     m_entries;       //!< Buffers kept for recycle, oldest first
+    std::map<T *, uint32_t> m_allocSizes;   //!< Allocation size of buffers taken from pool
+    uint32_t               m_size = 0;      //!< Total allocation size of pooled buffers
+};
+
+}  // namespace decode
+#endif  // !__DECODE_BUFFER_POOL_H__
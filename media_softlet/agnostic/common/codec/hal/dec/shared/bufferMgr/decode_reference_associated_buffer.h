@@ -29,6 +29,8 @@
 #ifndef __DECODE_REFRENCE_ASSOCIATED_BUFFER_H__
 #define __DECODE_REFRENCE_ASSOCIATED_BUFFER_H__
 
+#include <vector>
+#include "decode_active_buffer_table.h"
 #include "decode_allocator.h"
 #include "decode_utils.h"
 #include "codechal_hw.h"
@@ -76,11 +78,12 @@ public:
     {
         DECODE_FUNC_CALL();
 
-        for (auto& buf : m_activeBuffers)
+        for (uint32_t i = 0; i < m_activeBuffers.GetCount(); i++)
         {
-            m_bufferOp.Destroy(buf.second);
+            BufferType *buffer = m_activeBuffers.Get(m_activeBuffers.GetFrameIndex(i));
+            m_bufferOp.Destroy(buffer);
         }
-        m_activeBuffers.clear();
+        m_activeBuffers.Clear();
 
         for (auto& buf : m_availableBuffers)
         {
@@ -110,7 +113,7 @@ public:
         DECODE_CHK_STATUS(m_bufferOp.Init(hwInterface, allocator, basicFeature));
 
         DECODE_ASSERT(m_availableBuffers.empty());
-        DECODE_ASSERT(m_activeBuffers.empty());
+        DECODE_ASSERT(m_activeBuffers.GetCount() == 0);
 
         for (uint32_t i = 0; i < initialAllocNum; i++)
         {
@@ -185,14 +188,7 @@ public:
     {
         DECODE_FUNC_CALL();
 
-        auto iter = m_activeBuffers.find(frameIndex);
-        if (iter != m_activeBuffers.end())
-        {
-            DECODE_ASSERT(iter->second != nullptr);
-            return iter->second;
-        }
-
-        return nullptr;
+        return m_activeBuffers.Get(frameIndex);
     }
 
     //!
@@ -237,15 +233,10 @@ protected:
     {
         DECODE_FUNC_CALL();
 
-        m_currentBuffer = nullptr;
-
-        for (auto iter = m_activeBuffers.begin(); iter != m_activeBuffers.end(); iter++)
+        m_currentBuffer = GetBufferByFrameIndex(curFrameIdx);
+        if (m_currentBuffer != nullptr)
         {
-            if (curFrameIdx == iter->first)
-            {
-                m_currentBuffer = iter->second;
-                return MOS_STATUS_SUCCESS;
-            }
+            return MOS_STATUS_SUCCESS;
         }
 
         // The function UpdateRefList always attach the retired buffers to end of
@@ -268,10 +259,7 @@ protected:
         }
         m_bufferOp.Resize(m_currentBuffer);
 
-        auto ret = m_activeBuffers.insert(std::make_pair(curFrameIdx, m_currentBuffer));
-        DECODE_CHK_COND(ret.second == false,
-            "Failed to acitve reference associated buffer with index %d, maybe it is already existed",
-            ret.first->first);
+        m_activeBuffers.Add(curFrameIdx, m_currentBuffer);
 
         return MOS_STATUS_SUCCESS;
     }
@@ -291,26 +279,27 @@ protected:
     {
         DECODE_FUNC_CALL();
 
-        auto iter = m_activeBuffers.begin();
-        while (iter != m_activeBuffers.end())
+        // Buffers are retired in ascending frame index order
+        uint32_t pos = 0;
+        while (pos < m_activeBuffers.GetCount())
         {
-            if (iter->first == fixedFrameIdx)
+            uint32_t frameIdx = m_activeBuffers.GetFrameIndex(pos);
+            if (frameIdx == fixedFrameIdx)
             {
-                ++iter;
+                ++pos;
                 continue;
             }
 
-            if (!IsReference(iter->first, curFrameIdx, refFrameList))
+            if (!IsReference(frameIdx, curFrameIdx, refFrameList))
             {
-                auto buffer = iter->second;
-                iter = m_activeBuffers.erase(iter);
+                auto buffer = m_activeBuffers.RemoveAt(pos);
 
                 m_availableBuffers.push_back(buffer);
                 DECODE_CHK_STATUS(m_bufferOp.Deactive(buffer));
             }
             else
             {
-                ++iter;
+                ++pos;
             }
         }
 
@@ -349,7 +338,7 @@ protected:
     }
 
     BufferOp                        m_bufferOp;                //!< Buffer operation
-    std::map<uint32_t, BufferType*> m_activeBuffers;           //!< Active buffers corresponding to current reference frame list
+    ActiveBufferTable<BufferType>   m_activeBuffers;           //!< Active buffers indexed by frame index
     std::vector<BufferType*>        m_availableBuffers;        //!< Buffers in idle
     BufferType*                     m_currentBuffer = nullptr; //!< Point to buffer of current picture
 };
@@ -25,8 +25,10 @@ set(TMP_SOURCES_
 set(TMP_HEADERS_
     ${TMP_HEADERS_}
     ${CMAKE_CURRENT_LIST_DIR}/decode_allocator.h
+    ${CMAKE_CURRENT_LIST_DIR}/decode_buffer_pool.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_resource_array.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_resource_auto_lock.h
+    ${CMAKE_CURRENT_LIST_DIR}/decode_active_buffer_table.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_reference_associated_buffer.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_internal_target.h
 )
@@ -166,6 +166,7 @@ MOS_STATUS DecodePipeline::Initialize(void *settings)
     DECODE_CHK_NULL(m_allocator);
 
     DECODE_CHK_STATUS(CreateStatusReport());
+    m_allocator->SetStatusReport(m_statusReport);
 
     m_decodecp = Create_DecodeCpInterface(codecSettings, m_hwInterface);
     if (m_decodecp)
@@ -190,6 +191,11 @@ MOS_STATUS DecodePipeline::Uninitialize()
 
     MOS_Delete(m_mediaContext);
 
+    // Buffers destroyed after status report is gone cannot be tracked for recycle
+    if (m_allocator != nullptr)
+    {
+        m_allocator->SetStatusReport(nullptr);
+    }
     MOS_Delete(m_statusReport);
 
     MOS_Delete(m_featureManager);
@@ -38,10 +38,22 @@ VpAllocator::VpAllocator(PMOS_INTERFACE osInterface, MediaMemComp *mmc) :
 {
     m_allocator = MOS_New(Allocator, m_osInterface);
     VP_PUBLIC_CHK_NULL_NO_STATUS_RETURN(m_allocator);
+
+    MOS_USER_FEATURE_VALUE_DATA userFeatureData;
+    MOS_ZeroMemory(&userFeatureData, sizeof(userFeatureData));
+    MOS_USER_FEATURE_INVALID_KEY_ASSERT(MOS_UserFeature_ReadValue_ID(
+        nullptr,
+        __VPHAL_SURFACE_POOL_BUDGET_ID,
+        &userFeatureData,
+        m_osInterface ? m_osInterface->pOsContext : nullptr));
+    m_surfacePoolBudget = (uint64_t)userFeatureData.u32Data * 1024 * 1024;
 }
 
 VpAllocator::~VpAllocator()
 {
+    CleanRecycler();
+    TrimSurfacePool(0);
+
     if (m_allocator)
     {
         m_allocator->DestroyAllResources();
@@ -470,6 +482,7 @@ MOS_STATUS VpAllocator::DestroyVpSurface(VP_SURFACE* &surface, bool deferredDest
         MOS_Delete(surface->osSurface);
     }
 
+    m_surfacePool.Untrack(surface);
     MOS_Delete(surface);
     return status;
 }
@@ -759,6 +772,7 @@ MOS_STATUS VpAllocator::ReAllocateSurface(
     MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
     MOS_ALLOC_GFXRES_PARAMS allocParams = {};
     MOS_GFXRES_FREE_FLAGS   resFreeFlags = {0};
+    VP_SURFACE_POOL_KEY     key;
 
     allocated = false;
 
@@ -804,7 +818,16 @@ MOS_STATUS VpAllocator::ReAllocateSurface(
         resFreeFlags.SynchronousDestroy = 1;
         VP_PUBLIC_NORMALMESSAGE("Set SynchronousDestroy flag for compressed resource %s", surfaceName);
     }
-    VP_PUBLIC_CHK_STATUS_RETURN(DestroyVpSurface(surface, deferredDestroyed, resFreeFlags));
+
+    if (surface && m_surfacePool.IsTracked(surface))
+    {
+        // Keep the surface for reuse instead of destroying it.
+        ReturnSurfaceToPool(surface, deferredDestroyed);
+    }
+    else
+    {
+        VP_PUBLIC_CHK_STATUS_RETURN(DestroyVpSurface(surface, deferredDestroyed, resFreeFlags));
+    }
 
     AllocParamsInitType(allocParams, surface, defaultResType, defaultTileType);
 
@@ -820,13 +843,164 @@ MOS_STATUS VpAllocator::ReAllocateSurface(
     allocParams.dwMemType       = memType;
     allocParams.Flags.bNotLockable = isNotLockable;
 
-    surface = AllocateVpSurface(allocParams, zeroOnAllocate);
-    VP_PUBLIC_CHK_NULL_RETURN(surface);
+    MOS_ZeroMemory(&key, sizeof(key));
+    key.format          = format;
+    key.resType         = allocParams.Type;
+    key.tileType        = allocParams.TileType;
+    key.width           = width;
+    key.height          = height;
+    key.compressible    = compressible;
+    key.compressionMode = compressionMode;
+    key.resUsageType    = resUsageType;
+    key.tileModeByForce = tileModeByForce;
+    key.memType         = memType;
+    key.isNotLockable   = isNotLockable;
+
+    // Surface in pool is not cleared, so always allocate new one for zeroOnAllocate case.
+    if (!zeroOnAllocate)
+    {
+        surface = GetSurfaceFromPool(key);
+    }
+
+    if (nullptr == surface)
+    {
+        surface = AllocateVpSurface(allocParams, zeroOnAllocate);
+        VP_PUBLIC_CHK_NULL_RETURN(surface);
+
+        if (m_surfacePoolBudget > 0)
+        {
+            m_surfacePool.Track(surface, key);
+        }
+    }
 
     allocated = true;
     return MOS_STATUS_SUCCESS;
 }
 
+VP_SURFACE *VpAllocator::GetSurfaceFromPool(VP_SURFACE_POOL_KEY &key)
+{
+    VP_FUNC_CALL();
+
+    // Surface still referenced by submitted commands is skipped, which is only reused after
+    // GPU being done with it.
+    VP_SURFACE *surf = m_surfacePool.Acquire(key, [this](const VP_SURFACE_POOL_FENCE &fence) {
+        return IsSurfacePoolFenceCompleted(fence);
+    });
+
+    if (nullptr == surf)
+    {
+        return nullptr;
+    }
+
+    // Reset the surface to the state of a new allocated one.
+    MOS_SURFACE *osSurface    = surf->osSurface;
+    uint32_t    bufferWidth   = surf->bufferWidth;
+    uint32_t    bufferHeight  = surf->bufferHeight;
+    MOS_ZeroMemory(surf, sizeof(VP_SURFACE));
+
+    surf->osSurface         = osSurface;
+    surf->isResourceOwner   = true;
+    surf->ColorSpace        = CSpace_None;
+    surf->SampleType        = SAMPLE_PROGRESSIVE;
+    surf->rcSrc.right       = osSurface->dwWidth;
+    surf->rcSrc.bottom      = osSurface->dwHeight;
+    surf->rcDst             = surf->rcSrc;
+    surf->rcMaxSrc          = surf->rcSrc;
+    surf->bufferWidth       = bufferWidth;
+    surf->bufferHeight      = bufferHeight;
+
+    VP_PUBLIC_NORMALMESSAGE("Reuse surface in pool: format %d, width %d, height %d.", key.format, key.width, key.height);
+    return surf;
+}
+
+void VpAllocator::ReturnSurfaceToPool(VP_SURFACE *&surface, bool deferredReturned)
+{
+    VP_FUNC_CALL();
+
+    if (nullptr == surface)
+    {
+        return;
+    }
+
+    if (deferredReturned)
+    {
+        // Surface may still be referenced in current DDI call.
+        m_surfacePool.Defer(surface, surface->osSurface->dwSize);
+    }
+    else
+    {
+        // Surface not referenced in current DDI call, but may still be in use by GPU.
+        m_surfacePool.Release(surface, surface->osSurface->dwSize, GetSurfacePoolFence());
+        TrimSurfacePool(m_surfacePoolBudget);
+    }
+
+    surface = nullptr;
+}
+
+void VpAllocator::TrimSurfacePool(uint64_t budget)
+{
+    VP_FUNC_CALL();
+
+    m_surfacePool.Trim(budget, [this](VP_SURFACE *surf) {
+        MOS_GFXRES_FREE_FLAGS resFreeFlags = {};
+        //if free the compressed surface, need set the sync dealloc flag as 1 for sync dealloc for aux table update
+        if (IsSyncFreeNeededForMMCSurface(surf->osSurface))
+        {
+            resFreeFlags.SynchronousDestroy = 1;
+        }
+        DestroyVpSurface(surf, false, resFreeFlags);
+    });
+}
+
+VP_SURFACE_POOL_FENCE VpAllocator::GetSurfacePoolFence()
+{
+    VP_FUNC_CALL();
+
+    VP_SURFACE_POOL_FENCE fence = {};
+    if (nullptr == m_osInterface || nullptr == m_osInterface->pfnGetGpuStatusTag)
+    {
+        return fence;
+    }
+
+    // Same as VpStatusReport, the last tag submitted to current GPU context marks the
+    // completion of the frame, whose packets on other GPU contexts are synchronized before it.
+    fence.gpuContext = m_osInterface->CurrentGpuContextOrdinal;
+    fence.tag        = m_osInterface->pfnGetGpuStatusTag(m_osInterface, fence.gpuContext) - 1;
+    return fence;
+}
+
+bool VpAllocator::IsSurfacePoolFenceCompleted(const VP_SURFACE_POOL_FENCE &fence)
+{
+    VP_FUNC_CALL();
+
+    if (MOS_GPU_CONTEXT_INVALID_HANDLE == fence.gpuContext)
+    {
+        return true;
+    }
+
+    PMOS_CONTEXT osContext = m_osInterface ? m_osInterface->pOsContext : nullptr;
+    if (nullptr == osContext)
+    {
+        return false;
+    }
+
+#if (_DEBUG || _RELEASE_INTERNAL)
+    MOS_NULL_RENDERING_FLAGS nullRender = m_osInterface->pfnGetNullHWRenderFlags(m_osInterface);
+    if (nullRender.Value != 0)
+    {
+        return true;
+    }
+#endif
+
+#if (LINUX || ANDROID)
+    uint32_t gpuTag = osContext->GetGPUTag(m_osInterface, fence.gpuContext);
+#else
+    uint32_t gpuTag = osContext->GetGPUTag(osContext->GetGpuContextHandle(fence.gpuContext, m_osInterface->streamIndex));
+#endif
+
+    return VpIsStatusTagCompleted(gpuTag, fence.tag);
+}
+
 // for debug purpose
 #if (_DEBUG || _RELEASE_INTERNAL)
 MOS_STATUS VpAllocator::ReAllocateSurface(
@@ -1170,6 +1344,11 @@ void VpAllocator::CleanRecycler()
         }
         DestroyVpSurface(surf, false, resFreeFlags);
     }
+
+    // Surfaces returned during the frame are not referenced by the frame any more, but are
+    // only reused after GPU being done with the frame submitted.
+    m_surfacePool.ReleaseDeferred(GetSurfacePoolFence());
+    TrimSurfacePool(m_surfacePoolBudget);
 }
 
 bool VP_SURFACE::IsEmpty()
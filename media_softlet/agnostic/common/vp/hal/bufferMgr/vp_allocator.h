@@ -33,9 +33,53 @@
 #include "vp_mem_compression.h"
 #include "vp_vebox_common.h"
 #include "vp_pipeline_common.h"
+#include "vp_surface_pool.h"
 
 namespace vp {
 
+//!
+//! \brief  Allocation parameters of the surface allocated by ReAllocateSurface.
+//!         Free surfaces in surface pool are only reused for same parameters.
+//!
+struct VP_SURFACE_POOL_KEY
+{
+    MOS_FORMAT              format;
+    MOS_GFXRES_TYPE         resType;
+    MOS_TILE_TYPE           tileType;
+    uint32_t                width;
+    uint32_t                height;
+    bool                    compressible;
+    MOS_RESOURCE_MMC_MODE   compressionMode;
+    MOS_HW_RESOURCE_DEF     resUsageType;
+    MOS_TILE_MODE_GMM       tileModeByForce;
+    Mos_MemPool             memType;
+    bool                    isNotLockable;
+
+    bool operator==(const VP_SURFACE_POOL_KEY &key) const
+    {
+        return format           == key.format           &&
+               resType          == key.resType          &&
+               tileType         == key.tileType         &&
+               width            == key.width            &&
+               height           == key.height           &&
+               compressible     == key.compressible     &&
+               compressionMode  == key.compressionMode  &&
+               resUsageType     == key.resUsageType     &&
+               tileModeByForce  == key.tileModeByForce  &&
+               memType          == key.memType          &&
+               isNotLockable    == key.isNotLockable;
+    }
+};
+
+//!
+//! rief  Last submission which may reference a surface returned to surface pool.
+//!
+struct VP_SURFACE_POOL_FENCE
+{
+    MOS_GPU_CONTEXT         gpuContext  = MOS_GPU_CONTEXT_INVALID_HANDLE;
+    uint32_t                tag         = 0;    // Last status tag submitted to gpuContext.
+};
+
 class VpAllocator
 {
 public:
@@ -567,6 +611,48 @@ public:
     void CleanRecycler();
 
 protected:
+    //!
+    //! \brief    Get free surface from surface pool
+    //! \param    [in] key
+    //!           Allocation parameters of the surface
+    //! \return   VP_SURFACE*
+    //!           Surface allocated with same parameters, nullptr if not found
+    //!
+    VP_SURFACE *GetSurfaceFromPool(VP_SURFACE_POOL_KEY &key);
+
+    //!
+    //! \brief    Return surface allocated by ReAllocateSurface to surface pool for reuse
+    //! \param    [in,out] surface
+    //!           Surface to be returned, which is set to nullptr after being returned
+    //! \param    [in] deferredReturned
+    //!           Keep the surface out of surface pool until CleanRecycler being called
+    //! \return   void
+    //!
+    void ReturnSurfaceToPool(VP_SURFACE *&surface, bool deferredReturned);
+
+    //!
+    //! \brief    Destroy least recently returned surfaces until pool size within budget
+    //! \param    [in] budget
+    //!           Max size in bytes of surfaces kept in surface pool
+    //! \return   void
+    //!
+    void TrimSurfacePool(uint64_t budget);
+
+    //!
+    //! \brief    Get fence of the last submission on current GPU context
+    //! \return   VP_SURFACE_POOL_FENCE
+    //!
+    VP_SURFACE_POOL_FENCE GetSurfacePoolFence();
+
+    //!
+    //! \brief    Check whether GPU has completed the submission of fence
+    //! \param    [in] fence
+    //!           Fence of the surface in surface pool
+    //! \return   bool
+    //!           true if the surface is not referenced by GPU any more
+    //!
+    bool IsSurfacePoolFenceCompleted(const VP_SURFACE_POOL_FENCE &fence);
+
     //!
     //! \brief    Set mmc flags to surface
     //! \details  Set mmc flags to surface
@@ -589,6 +675,11 @@ protected:
     Allocator       *m_allocator    = nullptr;
     MediaMemComp    *m_mmc          = nullptr;
     std::vector<VP_SURFACE *> m_recycler;   // Container for delayed destroyed surface.
+
+    // Free surfaces kept for ReAllocateSurface, which avoids reallocation when surface
+    // parameters switch among several settings, e.g. resolution switching.
+    VpSurfacePool<VP_SURFACE, VP_SURFACE_POOL_KEY, VP_SURFACE_POOL_FENCE> m_surfacePool;
+    uint64_t m_surfacePoolBudget = 0;    // Max size in bytes of surfaces in m_surfacePool.
 };
 
 typedef VpAllocator* PVpAllocator;
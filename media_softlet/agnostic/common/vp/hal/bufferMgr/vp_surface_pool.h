@@ -0,0 +1,197 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     vp_surface_pool.h
+//! \brief    Free surfaces kept by VpAllocator for reuse with same allocation parameters.
+//! \details  Only depends on MOS definitions, surface destruction and GPU completion are
+//!           passed in by VpAllocator, so reuse, fencing and trimming can be tested on their own.
+//!
+#ifndef __VP_SURFACE_POOL_H__
+#define __VP_SURFACE_POOL_H__
+
+#include <iterator>
+#include <map>
+#include <vector>
+#include "mos_defs.h"
+
+namespace vp
+{
+//!
+//! \brief  Check whether the GPU has passed a status tag
+//! \param  [in] gpuTag
+//!         Status tag last completed by the GPU context
+//! \param  [in] fenceTag
+//!         Status tag to be checked, which is allowed to wrap around
+//! \return bool
+//!         true if fenceTag has been completed
+//!
+inline bool VpIsStatusTagCompleted(uint32_t gpuTag, uint32_t fenceTag)
+{
+    return (int32_t)(gpuTag - fenceTag) >= 0;
+}
+
+//!
+//! \brief  Free surfaces keyed by their allocation parameters. A returned surface carries the
+//!         fence of the last submission which may reference it, and is only handed out again
+//!         after the fence has been completed by GPU. Free surfaces are destroyed in least
+//!         recently returned order once their total size exceeds the budget.
+//!
+template<class Surface, class Key, class Fence>
+class VpSurfacePool
+{
+public:
+    //!
+    //! \brief  Record key of a surface allocated for the pool
+    //!
+    void Track(Surface *surf, const Key &key)
+    {
+        m_keys[surf] = key;
+    }
+
+    //!
+    //! \brief  Forget a surface being destroyed
+    //!
+    void Untrack(Surface *surf)
+    {
+        m_keys.erase(surf);
+    }
+
+    bool IsTracked(Surface *surf) const
+    {
+        return m_keys.end() != m_keys.find(surf);
+    }
+
+    //!
+    //! \brief  Take a free surface allocated with key
+    //! \param  [in] key
+    //!         Allocation parameters of the surface
+    //! \param  [in] isCompleted
+    //!         Returns true if GPU has completed the fence
+    //! \return Surface *
+    //!         The most recently returned surface with key whose fence has been completed,
+    //!         nullptr if not found, in which case the caller allocates a new one
+    //!
+    template<class IsCompleted>
+    Surface *Acquire(const Key &key, IsCompleted isCompleted)
+    {
+        for (auto it = m_free.rbegin(); it != m_free.rend(); ++it)
+        {
+            auto itKey = m_keys.find(it->surface);
+            if (m_keys.end() == itKey || !(itKey->second == key) || !isCompleted(it->fence))
+            {
+                continue;
+            }
+            Surface *surf = it->surface;
+            m_size -= it->size;
+            m_free.erase(std::next(it).base());
+            return surf;
+        }
+        return nullptr;
+    }
+
+    //!
+    //! \brief  Give a surface back to the pool
+    //! \param  [in] fence
+    //!         Last submission which may reference the surface
+    //!
+    void Release(Surface *surf, uint64_t size, const Fence &fence)
+    {
+        m_free.push_back({surf, size, fence});
+        m_size += size;
+    }
+
+    //!
+    //! \brief  Keep a surface, which may still be referenced by the submission being built,
+    //!         out of the pool until ReleaseDeferred
+    //!
+    void Defer(Surface *surf, uint64_t size)
+    {
+        m_pending.push_back({surf, size, Fence()});
+    }
+
+    //!
+    //! \brief  Give deferred surfaces back to the pool after their submission
+    //!
+    void ReleaseDeferred(const Fence &fence)
+    {
+        for (auto &entry : m_pending)
+        {
+            entry.fence = fence;
+            m_free.push_back(entry);
+            m_size += entry.size;
+        }
+        m_pending.clear();
+    }
+
+    //!
+    //! \brief  Destroy least recently returned surfaces until size of free ones within budget.
+    //!         All free surfaces are destroyed for 0 == budget, including zero sized ones.
+    //!         Surfaces not completed by GPU are destroyed too, whose memory is released
+    //!         by MOS after GPU being done with it.
+    //! \param  [in] budget
+    //!         Max size in bytes of free surfaces
+    //! \param  [in] destroy
+    //!         Destroys a surface evicted from the pool
+    //!
+    template<class Destroy>
+    void Trim(uint64_t budget, Destroy destroy)
+    {
+        while (!m_free.empty() && (m_size > budget || 0 == budget))
+        {
+            Entry entry = m_free.front();
+            m_free.erase(m_free.begin());
+            m_size -= entry.size;
+            destroy(entry.surface);
+        }
+    }
+
+    size_t GetFreeCount() const
+    {
+        return m_free.size();
+    }
+
+    size_t GetPendingCount() const
+    {
+        return m_pending.size();
+    }
+
+    uint64_t GetFreeSize() const
+    {
+        return m_size;
+    }
+
+private:
+    struct Entry
+    {
+        Surface  *surface;
+        uint64_t size;
+        Fence    fence;
+    };
+
+    std::map<Surface *, Key> m_keys;        // Keys of surfaces allocated for the pool.
+    std::vector<Entry>       m_free;        // Free surfaces, least recently returned first.
+    std::vector<Entry>       m_pending;     // Surfaces added to m_free by ReleaseDeferred.
+    uint64_t                 m_size = 0;    // Size in bytes of surfaces in m_free.
+};
+}
+
+#endif // !__VP_SURFACE_POOL_H__
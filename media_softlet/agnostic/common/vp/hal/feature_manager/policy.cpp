@@ -369,11 +369,200 @@ MOS_STATUS Policy::BuildExecutionEngines(SwFilterSubPipe& swFilterPipe)
 {
     VP_FUNC_CALL();
 
+    std::vector<uint8_t> signature;
+
+    // Engine selection only depends on the feature parameters and hw caps, so the
+    // assignment made for previous frames with same parameters can be replayed.
+    bool planCacheable = GetExecutionPlanSignature(swFilterPipe, signature);
+    if (planCacheable && ApplyExecutionPlan(swFilterPipe, signature))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
     SwFilter* feature = nullptr;
     for (auto filterID : m_featurePool)
     {
         VP_PUBLIC_CHK_STATUS_RETURN(GetExecutionCapsForSingleFeature(filterID, swFilterPipe));
     }
+
+    if (planCacheable)
+    {
+        VP_PUBLIC_CHK_STATUS_RETURN(AddExecutionPlan(swFilterPipe, signature));
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
+//!
+//! \brief  Get the parameters of a feature which engine selection depends on
+//! \param  [in] featureType
+//!         Feature type in m_featurePool
+//! \param  [in] feature
+//!         Feature on primary pipe
+//! \param  [out] size
+//!         Size of the parameters, 0 if the feature has no known parameters
+//! \return uint8_t*
+//!         Pointer to the parameters
+//!
+static uint8_t *GetExecutionPlanParams(FeatureType featureType, SwFilter *feature, uint32_t &size)
+{
+    size = 0;
+
+    switch (featureType)
+    {
+    case FeatureTypeCsc:
+        size = sizeof(FeatureParamCsc);
+        return (uint8_t *)&((SwFilterCsc *)feature)->GetSwFilterParams();
+    case FeatureTypeScaling:
+        size = sizeof(FeatureParamScaling);
+        return (uint8_t *)&((SwFilterScaling *)feature)->GetSwFilterParams();
+    case FeatureTypeRotMir:
+        size = sizeof(FeatureParamRotMir);
+        return (uint8_t *)&((SwFilterRotMir *)feature)->GetSwFilterParams();
+    case FeatureTypeDn:
+        size = sizeof(FeatureParamDenoise);
+        return (uint8_t *)&((SwFilterDenoise *)feature)->GetSwFilterParams();
+    case FeatureTypeSte:
+        size = sizeof(FeatureParamSte);
+        return (uint8_t *)&((SwFilterSte *)feature)->GetSwFilterParams();
+    case FeatureTypeTcc:
+        size = sizeof(FeatureParamTcc);
+        return (uint8_t *)&((SwFilterTcc *)feature)->GetSwFilterParams();
+    case FeatureTypeProcamp:
+        size = sizeof(FeatureParamProcamp);
+        return (uint8_t *)&((SwFilterProcamp *)feature)->GetSwFilterParams();
+    case FeatureTypeHdr:
+        size = sizeof(FeatureParamHdr);
+        return (uint8_t *)&((SwFilterHdr *)feature)->GetSwFilterParams();
+    default:
+        return nullptr;
+    }
+}
+
+static void AppendExecutionPlanSignature(std::vector<uint8_t> &signature, const void *data, uint32_t size)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    signature.insert(signature.end(), p, p + size);
+}
+
+bool Policy::GetExecutionPlanSignature(SwFilterSubPipe &swFilterPipe, std::vector<uint8_t> &signature)
+{
+    VP_FUNC_CALL();
+
+    signature.clear();
+
+    for (auto filterID : m_featurePool)
+    {
+        SwFilter *feature = swFilterPipe.GetSwFilter(filterID);
+        if (nullptr == feature)
+        {
+            continue;
+        }
+
+        // Deinterlace engine selection depends on the reference state of resource manager.
+        if (FeatureTypeDi == filterID)
+        {
+            return false;
+        }
+
+        uint32_t        size    = 0;
+        uint8_t         *params = GetExecutionPlanParams(filterID, feature, size);
+        VP_EngineEntry  caps    = feature->GetFilterEngineCaps();
+
+        AppendExecutionPlanSignature(signature, &filterID, sizeof(filterID));
+        AppendExecutionPlanSignature(signature, &caps.value, sizeof(caps.value));
+        if (params)
+        {
+            AppendExecutionPlanSignature(signature, params, size);
+        }
+
+        // Parameters referenced by pointer, which are only compared by address above.
+        if (FeatureTypeCsc == filterID)
+        {
+            FeatureParamCsc &cscParams = ((SwFilterCsc *)feature)->GetSwFilterParams();
+            if (cscParams.pAlphaParams)
+            {
+                AppendExecutionPlanSignature(signature, cscParams.pAlphaParams, sizeof(VPHAL_ALPHA_PARAMS));
+            }
+        }
+        else if (FeatureTypeScaling == filterID)
+        {
+            FeatureParamScaling &scalingParams = ((SwFilterScaling *)feature)->GetSwFilterParams();
+            if (scalingParams.pCompAlpha)
+            {
+                AppendExecutionPlanSignature(signature, scalingParams.pCompAlpha, sizeof(VPHAL_ALPHA_PARAMS));
+            }
+            if (scalingParams.pColorFillParams)
+            {
+                AppendExecutionPlanSignature(signature, scalingParams.pColorFillParams, sizeof(VPHAL_COLORFILL_PARAMS));
+            }
+        }
+    }
+
+    return true;
+}
+
+bool Policy::ApplyExecutionPlan(SwFilterSubPipe &swFilterPipe, std::vector<uint8_t> &signature)
+{
+    VP_FUNC_CALL();
+
+    VP_EXECUTION_PLAN *plan = m_executionPlans.Find(signature);
+    if (nullptr == plan)
+    {
+        return false;
+    }
+
+    for (auto &planFeature : plan->features)
+    {
+        SwFilter *feature = swFilterPipe.GetSwFilter(planFeature.type);
+        if (nullptr == feature)
+        {
+            // Signature matched, so the feature set cannot differ.
+            VP_PUBLIC_ASSERTMESSAGE("Feature %d missing for matched execution plan.", planFeature.type);
+            return false;
+        }
+
+        uint32_t size   = 0;
+        uint8_t *params = GetExecutionPlanParams(planFeature.type, feature, size);
+        if (params && size == planFeature.params.size())
+        {
+            MOS_SecureMemcpy(params, size, planFeature.params.data(), size);
+        }
+        feature->GetFilterEngineCaps() = planFeature.engineCaps;
+    }
+
+    VP_PUBLIC_NORMALMESSAGE("Engine selection replayed from execution plan.");
+    return true;
+}
+
+MOS_STATUS Policy::AddExecutionPlan(SwFilterSubPipe &swFilterPipe, std::vector<uint8_t> &signature)
+{
+    VP_FUNC_CALL();
+
+    VP_EXECUTION_PLAN plan;
+
+    for (auto filterID : m_featurePool)
+    {
+        SwFilter *feature = swFilterPipe.GetSwFilter(filterID);
+        if (nullptr == feature)
+        {
+            continue;
+        }
+
+        VP_EXECUTION_PLAN::FEATURE planFeature;
+        uint32_t size   = 0;
+        uint8_t *params = GetExecutionPlanParams(filterID, feature, size);
+
+        planFeature.type        = filterID;
+        planFeature.engineCaps  = feature->GetFilterEngineCaps();
+        if (params)
+        {
+            planFeature.params.assign(params, params + size);
+        }
+        plan.features.push_back(std::move(planFeature));
+    }
+
+    m_executionPlans.Add(signature, std::move(plan));
+
     return MOS_STATUS_SUCCESS;
 }
 
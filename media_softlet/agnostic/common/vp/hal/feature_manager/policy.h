@@ -38,7 +38,9 @@
 #include "hw_filter.h"
 #include "sw_filter_pipe.h"
 #include "vp_resource_manager.h"
+#include "vp_execution_plan_cache.h"
 #include <map>
+#include <vector>
 
 namespace vp
 {
@@ -49,6 +51,21 @@ namespace vp
 
 class VpInterface;
 
+//!
+//! \brief  Engine assignment decided for a primary pipe by BuildExecutionEngines
+//!
+struct VP_EXECUTION_PLAN
+{
+    struct FEATURE
+    {
+        FeatureType             type;
+        VP_EngineEntry          engineCaps;     //!< Engine caps after engine selection
+        std::vector<uint8_t>    params;         //!< Feature parameters after engine selection
+    };
+
+    std::vector<FEATURE>        features;
+};
+
 class Policy
 {
 public:
@@ -75,6 +92,9 @@ protected:
     virtual MOS_STATUS BuildVeboxSecureFilters(SwFilterPipe& featurePipe, VP_EXECUTE_CAPS& caps, HW_FILTER_PARAMS& params);
 
     MOS_STATUS BuildExecutionEngines(SwFilterSubPipe &swFilterPipe);
+    bool GetExecutionPlanSignature(SwFilterSubPipe &swFilterPipe, std::vector<uint8_t> &signature);
+    bool ApplyExecutionPlan(SwFilterSubPipe &swFilterPipe, std::vector<uint8_t> &signature);
+    MOS_STATUS AddExecutionPlan(SwFilterSubPipe &swFilterPipe, std::vector<uint8_t> &signature);
     MOS_STATUS GetHwFilterParam(SwFilterPipe& subSwFilterPipe, HW_FILTER_PARAMS& params);
     MOS_STATUS ReleaseHwFilterParam(HW_FILTER_PARAMS &params);
     MOS_STATUS GetExecuteCaps(SwFilterPipe& subSwFilterPipe, HW_FILTER_PARAMS& params);
@@ -137,6 +157,7 @@ protected:
     std::map<FeatureType, PolicyFeatureHandler*> m_VeboxSfcFeatureHandlers;
     std::map<FeatureType, PolicyFeatureHandler*> m_RenderFeatureHandlers;
     std::vector<FeatureType> m_featurePool;
+    VpExecutionPlanCache<VP_EXECUTION_PLAN, 4> m_executionPlans;   //!< Keyed by feature parameters and engine caps before engine selection
 
     VpInterface         &m_vpInterface;
     VP_HW_CAPS          m_hwCaps = {};
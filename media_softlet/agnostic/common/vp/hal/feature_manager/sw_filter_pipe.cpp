@@ -37,7 +37,7 @@ using namespace vp;
 /*                                      SwFilterSubPipe                                             */
 /****************************************************************************************************/
 
-SwFilterSubPipe::SwFilterSubPipe()
+SwFilterSubPipe::SwFilterSubPipe(VpObjPool<SwFilterSet> &filterSetPool) : m_FilterSetPool(filterSetPool)
 {
 }
 
@@ -56,7 +56,8 @@ MOS_STATUS SwFilterSubPipe::Clean()
         {
             // Loop orderred feature set.
             VP_PUBLIC_CHK_STATUS_RETURN(filterSet->Clean());
-            MOS_Delete(filterSet);
+            filterSet->SetLocation(nullptr);
+            m_FilterSetPool.Release(filterSet);
         }
     }
     m_OrderedFilters.clear();
@@ -119,7 +120,7 @@ MOS_STATUS SwFilterSubPipe::AddSwFilterOrdered(SwFilter *swFilter, bool useNewSw
 
     if (useNewSwFilterSet || pipe.empty())
     {
-        swFilterSet = MOS_New(SwFilterSet);
+        swFilterSet = m_FilterSetPool.Acquire([]() { return MOS_New(SwFilterSet); });
         useNewSwFilterSet = true;
     }
     else
@@ -134,7 +135,7 @@ MOS_STATUS SwFilterSubPipe::AddSwFilterOrdered(SwFilter *swFilter, bool useNewSw
     {
         if (useNewSwFilterSet)
         {
-            MOS_Delete(swFilterSet);
+            m_FilterSetPool.Release(swFilterSet);
         }
         return status;
     }
@@ -165,6 +166,9 @@ SwFilterPipe::SwFilterPipe(VpInterface &vpInterface) : m_vpInterface(vpInterface
 SwFilterPipe::~SwFilterPipe()
 {
     Clean();
+
+    m_SubPipePool.Clear([](SwFilterSubPipe *p) { MOS_Delete(p); });
+    m_FilterSetPool.Clear([](SwFilterSet *p) { MOS_Delete(p); });
 }
 
 MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &featureRule)
@@ -204,7 +208,7 @@ MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &fea
         m_futureSurface.push_back(futureSurface);
 
         // Initialize m_InputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -229,7 +233,7 @@ MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &fea
         m_OutputSurfaces.push_back(surf);
 
         // Initialize m_OutputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -279,7 +283,7 @@ MOS_STATUS SwFilterPipe::Initialize(VEBOX_SFC_PARAMS &params)
         m_futureSurface.push_back(nullptr);
 
         // Initialize m_InputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -310,7 +314,7 @@ MOS_STATUS SwFilterPipe::Initialize(VEBOX_SFC_PARAMS &params)
         m_OutputSurfaces.push_back(output);
 
         // Initialize m_OutputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -370,7 +374,7 @@ MOS_STATUS SwFilterPipe::Clean()
         while (!pipe->empty())
         {
             auto p = pipe->back();
-            MOS_Delete(p);
+            DestroySwFilterSubPipe(p);
             pipe->pop_back();
         }
     }
@@ -699,7 +703,7 @@ MOS_STATUS SwFilterPipe::RemoveSwFilter(SwFilter *swFilter)
         }
         swFilterSet->SetLocation(nullptr);
 
-        MOS_Delete(swFilterSet);
+        m_FilterSetPool.Release(swFilterSet);
     }
     return MOS_STATUS_SUCCESS;
 }
@@ -866,7 +870,7 @@ MOS_STATUS SwFilterPipe::AddSurface(VP_SURFACE *&surf, bool isInputSurface, uint
 
     if (nullptr == pipes[index])
     {
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         VP_PUBLIC_CHK_NULL_RETURN(pipe);
         pipes[index] = pipe;
     }
@@ -942,7 +946,7 @@ MOS_STATUS SwFilterPipe::RemoveUnusedLayers(bool bUpdateInput)
             {
                 auto pipe = *itPipe;
                 pipes.erase(itPipe);
-                MOS_Delete(pipe);
+                DestroySwFilterSubPipe(pipe);
                 break;
             }
         }
@@ -951,6 +955,31 @@ MOS_STATUS SwFilterPipe::RemoveUnusedLayers(bool bUpdateInput)
     return MOS_STATUS_SUCCESS;
 }
 
+SwFilterSubPipe *SwFilterPipe::CreateSwFilterSubPipe()
+{
+    VP_FUNC_CALL();
+
+    return m_SubPipePool.Acquire([this]() { return MOS_New(SwFilterSubPipe, m_FilterSetPool); });
+}
+
+void SwFilterPipe::DestroySwFilterSubPipe(SwFilterSubPipe *&pipe)
+{
+    VP_FUNC_CALL();
+
+    if (nullptr == pipe)
+    {
+        return;
+    }
+
+    if (MOS_FAILED(pipe->Clean()))
+    {
+        MOS_Delete(pipe);
+        return;
+    }
+
+    m_SubPipePool.Release(pipe);
+}
+
 MOS_STATUS SwFilterPipe::Update()
 {
     VP_FUNC_CALL();
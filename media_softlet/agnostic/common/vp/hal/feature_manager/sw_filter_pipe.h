@@ -64,7 +64,7 @@ struct FeatureRule
 class SwFilterSubPipe
 {
 public:
-    SwFilterSubPipe();
+    SwFilterSubPipe(VpObjPool<SwFilterSet> &filterSetPool);
     virtual ~SwFilterSubPipe();
     MOS_STATUS Clean();
     MOS_STATUS Update(VP_SURFACE *inputSurf, VP_SURFACE *outputSurf);
@@ -101,6 +101,7 @@ public:
 private:
     std::vector<SwFilterSet *> m_OrderedFilters;    // For features in featureRule
     SwFilterSet m_UnorderedFilters;                 // For features not in featureRule
+    VpObjPool<SwFilterSet> &m_FilterSetPool;        // Free swFilterSets owned by swFilterPipe
 };
 
 enum SwFilterPipeType
@@ -199,9 +200,15 @@ protected:
     MOS_STATUS CleanFeaturesFromPipe(bool isInputPipe);
     MOS_STATUS CleanFeatures();
     MOS_STATUS RemoveUnusedLayers(bool bUpdateInput);
+    SwFilterSubPipe *CreateSwFilterSubPipe();
+    void DestroySwFilterSubPipe(SwFilterSubPipe *&pipe);
 
     std::vector<SwFilterSubPipe *>      m_InputPipes;       // For features on input surfaces.
     std::vector<SwFilterSubPipe *>      m_OutputPipes;      // For features on output surfaces.
+    // Free swFilterSubPipes and swFilterSets, which are reused across frames instead of being
+    // allocated for each frame.
+    VpObjPool<SwFilterSubPipe>          m_SubPipePool;
+    VpObjPool<SwFilterSet>              m_FilterSetPool;
 
     std::vector<VP_SURFACE *>           m_InputSurfaces;
     std::vector<VP_SURFACE *>           m_OutputSurfaces;
@@ -0,0 +1,119 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//!
+//! \file     vp_execution_plan_cache.h
+//! \brief    Most recently used cache of engine selection plans keyed by feature signature
+//! \details  Only depends on the standard library, the signature and plan content are
+//!           defined by Policy.
+//!
+#ifndef __VP_EXECUTION_PLAN_CACHE_H__
+#define __VP_EXECUTION_PLAN_CACHE_H__
+
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace vp
+{
+template <class Plan, uint32_t MaxCount>
+class VpExecutionPlanCache
+{
+public:
+    //!
+    //! \brief  Find the plan stored for the signature
+    //! \details Matched plan becomes the most recently used one.
+    //! \param  [in] signature
+    //!         Signature of the feature parameters the plan was decided for
+    //! \return Plan*
+    //!         Pointer to the plan, nullptr if not found. Valid until next Add or Clear
+    //!
+    Plan *Find(const std::vector<uint8_t> &signature)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if (it->signature != signature)
+            {
+                continue;
+            }
+
+            if (it != m_entries.begin())
+            {
+                Entry entry = std::move(*it);
+                m_entries.erase(it);
+                m_entries.insert(m_entries.begin(), std::move(entry));
+            }
+            return &m_entries.front().plan;
+        }
+        return nullptr;
+    }
+
+    //!
+    //! \brief  Store the plan for the signature as the most recently used one
+    //! \details Replaces the plan already stored for the signature, otherwise evicts
+    //!          the least recently used plan if the cache is full.
+    //! \param  [in] signature
+    //!         Signature of the feature parameters the plan was decided for
+    //! \param  [in] plan
+    //!         Plan to store
+    //!
+    void Add(const std::vector<uint8_t> &signature, Plan &&plan)
+    {
+        if (Find(signature))
+        {
+            m_entries.front().plan = std::move(plan);
+            return;
+        }
+
+        if (m_entries.size() >= MaxCount)
+        {
+            m_entries.pop_back();
+        }
+
+        Entry entry;
+        entry.signature = signature;
+        entry.plan      = std::move(plan);
+        m_entries.insert(m_entries.begin(), std::move(entry));
+    }
+
+    void Clear()
+    {
+        m_entries.clear();
+    }
+
+    uint32_t GetCount() const
+    {
+        return (uint32_t)m_entries.size();
+    }
+
+private:
+    struct Entry
+    {
+        std::vector<uint8_t>    signature;
+        Plan                    plan;
+    };
+
+    std::vector<Entry> m_entries;   //!< Most recently used first
+};
+}  // namespace vp
+
+#endif  // !__VP_EXECUTION_PLAN_CACHE_H__
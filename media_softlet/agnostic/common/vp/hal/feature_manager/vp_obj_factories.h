@@ -48,31 +48,12 @@ public:
 
     virtual ~VpObjAllocator()
     {
-        while (!m_Pool.empty())
-        {
-            Type *p = m_Pool.back();
-            m_Pool.pop_back();
-            MOS_Delete(p);
-        }
+        m_Pool.Clear([](Type *p) { MOS_Delete(p); });
     }
 
     virtual Type *Create()
     {
-        Type *obj = nullptr;
-        if (m_Pool.empty())
-        {
-            obj = MOS_New(Type, m_vpInterface);
-        }
-        else
-        {
-            obj = m_Pool.back();
-            if (obj)
-            {
-                m_Pool.pop_back();
-            }
-        }
-
-        return obj;
+        return m_Pool.Acquire([this]() { return MOS_New(Type, m_vpInterface); });
     }
 
     virtual MOS_STATUS Destory(Type *&obj)
@@ -82,13 +63,12 @@ public:
             return MOS_STATUS_SUCCESS;
         }
         obj->Clean();
-        m_Pool.push_back(obj);
-        obj = nullptr; 
+        m_Pool.Release(obj);
         return MOS_STATUS_SUCCESS;
     }
 
 private:
-    std::vector<Type *> m_Pool;
+    VpObjPool<Type>  m_Pool;
     VpInterface      &m_vpInterface;
 };
 
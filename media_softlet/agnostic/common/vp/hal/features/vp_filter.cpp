@@ -90,12 +90,7 @@ PolicyFeatureHandler::PolicyFeatureHandler(VP_HW_CAPS &hwCaps) : m_hwCaps(hwCaps
 
 PolicyFeatureHandler::~PolicyFeatureHandler()
 {
-    while(!m_Pool.empty())
-    {
-        HwFilterParameter *p = m_Pool.back();
-        m_Pool.pop_back();
-        MOS_Delete(p);
-    }
+    m_Pool.Clear([](HwFilterParameter *p) { MOS_Delete(p); });
 }
 
 bool PolicyFeatureHandler::IsFeatureEnabled(SwFilterPipe &swFilterPipe)
@@ -139,13 +134,8 @@ HwFilterParameter *PolicyFeatureHandler::GetHwFeatureParameterFromPool()
 {
     VP_FUNC_CALL();
 
-    if (m_Pool.empty())
-    {
-        return nullptr;
-    }
-    HwFilterParameter *p = m_Pool.back();
-    m_Pool.pop_back();
-    return p;
+    // Caller creates a new parameter from heap if pool is empty.
+    return m_Pool.Acquire();
 }
 
 MOS_STATUS PolicyFeatureHandler::ReleaseHwFeatureParameter(HwFilterParameter *&pParam)
@@ -153,8 +143,7 @@ MOS_STATUS PolicyFeatureHandler::ReleaseHwFeatureParameter(HwFilterParameter *&p
     VP_FUNC_CALL();
 
     VP_PUBLIC_CHK_NULL_RETURN(pParam);
-    m_Pool.push_back(pParam);
-    pParam = nullptr;
+    m_Pool.Release(pParam);
     return MOS_STATUS_SUCCESS;
 }
 
@@ -167,12 +156,7 @@ PacketParamFactoryBase::PacketParamFactoryBase()
 
 PacketParamFactoryBase::~PacketParamFactoryBase()
 {
-    while (!m_Pool.empty())
-    {
-        VpPacketParameter *p = m_Pool.back();
-        m_Pool.pop_back();
-        MOS_Delete(p);
-    }
+    m_Pool.Clear([](VpPacketParameter *p) { MOS_Delete(p); });
 }
 
 VpPacketParameter *PacketParamFactoryBase::GetPacketParameter(PVP_MHWINTERFACE pHwInterface)
@@ -186,9 +170,5 @@ void PacketParamFactoryBase::ReturnPacketParameter(VpPacketParameter *&p)
 {
     VP_FUNC_CALL();
 
-    if (p)
-    {
-        m_Pool.push_back(p);
-        p = nullptr;
-    }
+    m_Pool.Release(p);
 }
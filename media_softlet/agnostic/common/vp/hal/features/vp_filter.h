@@ -461,7 +461,7 @@ public:
     MOS_STATUS ReleaseHwFeatureParameter(HwFilterParameter *&pParam);
 protected:
     FeatureType m_Type = FeatureTypeInvalid;
-    std::vector<HwFilterParameter *> m_Pool;
+    VpObjPool<HwFilterParameter> m_Pool;
     VP_HW_CAPS  &m_hwCaps;
 };
 
@@ -473,7 +473,7 @@ public:
     virtual VpPacketParameter *GetPacketParameter(PVP_MHWINTERFACE pHwInterface) = 0;
     void ReturnPacketParameter(VpPacketParameter *&p);
 protected:
-    std::vector<VpPacketParameter *> m_Pool;
+    VpObjPool<VpPacketParameter> m_Pool;
 };
 
 template<class T>
@@ -492,28 +492,25 @@ public:
         {
             return nullptr;
         }
-        if (m_Pool.empty())
+        VpPacketParameter *pBase = m_Pool.Acquire();
+        if (pBase)
         {
-            T *p = MOS_New(T, pHwInterface, this);
-            if (nullptr == p)
-            {
-                return nullptr;
-            }
-
-            VpPacketParameter *pBase = dynamic_cast<VpPacketParameter *>(p);
-
-            if (nullptr == pBase)
-            {
-                MOS_Delete(p);
-            }
             return pBase;
         }
-        else
+
+        T *p = MOS_New(T, pHwInterface, this);
+        if (nullptr == p)
+        {
+            return nullptr;
+        }
+
+        pBase = dynamic_cast<VpPacketParameter *>(p);
+
+        if (nullptr == pBase)
         {
-            VpPacketParameter *p = m_Pool.back();
-            m_Pool.pop_back();
-            return p;
+            MOS_Delete(p);
         }
+        return pBase;
     }
 };
 
@@ -314,22 +314,16 @@ PacketPipeFactory::PacketPipeFactory(PacketFactory &pPacketFactory) : m_pPacketF
 
 PacketPipeFactory::~PacketPipeFactory()
 {
-    while (!m_Pool.empty())
-    {
-        PacketPipe *p = m_Pool.back();
-        m_Pool.pop_back();
-        MOS_Delete(p);
-    }
+    m_Pool.Clear([](PacketPipe *p) { MOS_Delete(p); });
 }
 
 PacketPipe *PacketPipeFactory::CreatePacketPipe()
 {
     VP_FUNC_CALL();
 
-    if (!m_Pool.empty())
+    PacketPipe *p = m_Pool.Acquire();
+    if (p)
     {
-        PacketPipe *p = m_Pool.back();
-        m_Pool.pop_back();
         p->Clean();
         return p;
     }
@@ -345,6 +339,5 @@ void PacketPipeFactory::ReturnPacketPipe(PacketPipe *&pPipe)
         return;
     }
     pPipe->Clean();
-    m_Pool.push_back(pPipe);
-    pPipe = nullptr;
+    m_Pool.Release(pPipe);
 }
\ No newline at end of file
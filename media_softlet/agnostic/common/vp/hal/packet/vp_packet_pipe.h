@@ -111,7 +111,7 @@ public:
 
 private:
     PacketFactory &m_pPacketFactory;
-    std::vector<PacketPipe *> m_Pool;
+    VpObjPool<PacketPipe> m_Pool;
 };
 
 }
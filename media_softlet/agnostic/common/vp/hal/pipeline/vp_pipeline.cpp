@@ -250,6 +250,9 @@ MOS_STATUS VpPipeline::ExecuteVpPipeline()
     PacketPipe                 *pPacketPipe = nullptr;
     std::vector<SwFilterPipe*> swFilterPipes;
     VpFeatureManagerNext       *featureManagerNext = dynamic_cast<VpFeatureManagerNext *>(m_featureManager);
+#if MOS_MESSAGES_ENABLED
+    int32_t                    heapAllocCount = ObjAllocTrace::GetHeapAllocCount();
+#endif
 
     VP_PUBLIC_CHK_NULL_RETURN(featureManagerNext);
     VP_PUBLIC_CHK_NULL_RETURN(m_pPacketPipeFactory);
@@ -315,6 +318,12 @@ finish:
     m_statusReport->UpdateStatusTableAfterSubmit(eStatus);
     // Notify resourceManager for end of new frame processing.
     m_resourceManager->OnNewFrameProcessEnd();
+#if MOS_MESSAGES_ENABLED
+    // Vp objects are pooled, so no heap allocation is expected once the pools are warmed up.
+    // The count is process wide, which may include objects of other vp instances running in parallel.
+    VP_PUBLIC_NORMALMESSAGE("Frame %d: %d vp objects allocated from heap.",
+        m_frameCounter, ObjAllocTrace::GetHeapAllocCount() - heapAllocCount);
+#endif
     m_frameCounter++;
     return eStatus;
 }
@@ -26,6 +26,8 @@ set(TMP_SOURCES_
 
 set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/vp_dumper.h
+    ${CMAKE_CURRENT_LIST_DIR}/vp_dump_staging_ring.h
+    ${CMAKE_CURRENT_LIST_DIR}/vp_obj_pool.h
     ${CMAKE_CURRENT_LIST_DIR}/vp_utils.h
     ${CMAKE_CURRENT_LIST_DIR}/vp_debug_interface.h
     ${CMAKE_CURRENT_LIST_DIR}/vp_debug_config_manager.h
@@ -0,0 +1,203 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     vp_dump_staging_ring.h
+//! \brief    Bounded staging ring of dump files pending for writing.
+//! \details  Only depends on MOS definitions, the mutex is passed in by the user,
+//!           so dropping and round-tripping of dumps can be tested.
+//!
+#ifndef __VP_DUMP_STAGING_RING_H__
+#define __VP_DUMP_STAGING_RING_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mos_defs.h"
+
+namespace vp
+{
+//!
+//! \brief  Ring of Size staging slots, filled by one thread and drained by another.
+//! \details Push copies the dump into the slot at tail and never blocks, the dump is
+//!          dropped and counted if all slots are pending or the staging memory would
+//!          exceed maxStagingSize. Front and Pop hand the oldest slot to the writer.
+//!          Mutex needs lock() and unlock().
+//!
+template<class Mutex, uint32_t Size>
+class VpDumpStagingRing
+{
+public:
+    VpDumpStagingRing(uint32_t maxStagingSize) : m_maxStagingSize(maxStagingSize)
+    {
+    }
+
+    virtual ~VpDumpStagingRing()
+    {
+        for (uint32_t i = 0; i < Size; i++)
+        {
+            free(m_ring[i].buffer);
+            m_ring[i].buffer = nullptr;
+        }
+    }
+
+    //!
+    //! \brief    Copy a dump into the ring
+    //! \param    [in] path
+    //!           Os file path to write
+    //! \param    [in] data
+    //!           Data to write, which is copied before return
+    //! \param    [in] size
+    //!           Size of data
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if queued, MOS_STATUS_NO_SPACE if dropped,
+    //!           MOS_STATUS_NULL_POINTER if path or data is null
+    //!
+    MOS_STATUS Push(const char *path, const uint8_t *data, uint32_t size)
+    {
+        if (path == nullptr || data == nullptr)
+        {
+            return MOS_STATUS_NULL_POINTER;
+        }
+
+        m_mutex.lock();
+        bool     full = m_count >= Size;
+        uint32_t tail = (m_head + m_count) % Size;
+        m_mutex.unlock();
+
+        // Slot at tail is only accessed by the pushing thread before being queued.
+        Slot &slot = m_ring[tail];
+        if (!full && size > slot.capacity)
+        {
+            full = m_stagingSize - slot.capacity + size > m_maxStagingSize;
+            if (!full)
+            {
+                free(slot.buffer);
+                m_stagingSize -= slot.capacity;
+                slot.capacity  = 0;
+                slot.buffer    = (uint8_t *)malloc(size);
+                full           = (slot.buffer == nullptr);
+                if (!full)
+                {
+                    slot.capacity  = size;
+                    m_stagingSize += size;
+                }
+            }
+        }
+
+        if (full)
+        {
+            m_mutex.lock();
+            m_droppedCount++;
+            m_mutex.unlock();
+            return MOS_STATUS_NO_SPACE;
+        }
+
+        snprintf(slot.path, sizeof(slot.path), "%s", path);
+        if (size)
+        {
+            memcpy(slot.buffer, data, size);
+        }
+        slot.size = size;
+
+        m_mutex.lock();
+        m_count++;
+        m_mutex.unlock();
+        return MOS_STATUS_SUCCESS;
+    }
+
+    //!
+    //! \brief    Get the oldest queued dump
+    //! \details  The dump stays valid until Pop
+    //! \return   bool
+    //!           false if no dump is queued
+    //!
+    bool Front(const char **path, const uint8_t **data, uint32_t *size)
+    {
+        m_mutex.lock();
+        bool empty = (m_count == 0);
+        m_mutex.unlock();
+        if (empty)
+        {
+            return false;
+        }
+
+        // Slot at head is only accessed by the writing thread until being popped.
+        Slot &slot = m_ring[m_head];
+        *path = slot.path;
+        *data = slot.buffer;
+        *size = slot.size;
+        return true;
+    }
+
+    //!
+    //! \brief    Release the oldest queued dump after it is written
+    //!
+    void Pop()
+    {
+        m_mutex.lock();
+        if (m_count)
+        {
+            m_head = (m_head + 1) % Size;
+            m_count--;
+        }
+        m_mutex.unlock();
+    }
+
+    //!
+    //! \brief    Number of dumps dropped since the ring being created
+    //!
+    uint32_t GetDroppedCount()
+    {
+        m_mutex.lock();
+        uint32_t dropped = m_droppedCount;
+        m_mutex.unlock();
+        return dropped;
+    }
+
+    //!
+    //! \brief    Total capacity of the staging buffers
+    //!
+    uint32_t GetStagingSize()
+    {
+        return m_stagingSize;
+    }
+
+protected:
+    struct Slot
+    {
+        char     path[MAX_PATH];
+        uint8_t  *buffer;
+        uint32_t capacity;
+        uint32_t size;
+    };
+
+    Slot     m_ring[Size]     = {};
+    uint32_t m_head           = 0;      //!< Slot to be written by the writing thread
+    uint32_t m_count          = 0;      //!< Slots pending for writing
+    uint32_t m_stagingSize    = 0;      //!< Only accessed by the pushing thread
+    uint32_t m_maxStagingSize = 0;
+    uint32_t m_droppedCount   = 0;
+    Mutex    m_mutex;
+};
+}  // namespace vp
+
+#endif // __VP_DUMP_STAGING_RING_H__
@@ -835,6 +835,132 @@ MOS_STATUS VpSurfaceDumper::GetPlaneDefs(
     return eStatus;
 }
 
+VpDumpFileWriter::VpDumpFileWriter()
+{
+}
+
+VpDumpFileWriter::~VpDumpFileWriter()
+{
+    if (m_thread)
+    {
+        // Worker thread exits after all pending dump files written.
+        MOS_LockMutex(m_mutex);
+        m_exit = true;
+        MOS_UnlockMutex(m_mutex);
+        MOS_PostSemaphore(m_semaphore, 1);
+        MOS_WaitThread(m_thread);
+        m_thread = 0;
+    }
+
+    if (m_ring.GetDroppedCount())
+    {
+        VPHAL_DEBUG_NORMALMESSAGE("%d dump files dropped for staging ring full.", m_ring.GetDroppedCount());
+    }
+
+    if (m_semaphore)
+    {
+        MOS_DestroySemaphore(m_semaphore);
+        m_semaphore = nullptr;
+    }
+    if (m_mutex)
+    {
+        MOS_DestroyMutex(m_mutex);
+        m_mutex = nullptr;
+    }
+}
+
+MOS_STATUS VpDumpFileWriter::Initialize()
+{
+    VP_FUNC_CALL();
+
+    m_mutex = MOS_CreateMutex();
+    VP_PUBLIC_CHK_NULL_RETURN(m_mutex);
+
+    // One post for each queued dump, and one more for exit.
+    m_semaphore = MOS_CreateSemaphore(0, VPHAL_DUMP_ASYNC_RING_SIZE + 1);
+    VP_PUBLIC_CHK_NULL_RETURN(m_semaphore);
+
+    m_thread = MOS_CreateThread((void *)WorkerThread, this);
+    if (0 == m_thread)
+    {
+        VPHAL_DEBUG_ASSERTMESSAGE("Failed to create thread for async dump.");
+        return MOS_STATUS_UNKNOWN;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpDumpFileWriter::Write(const char *path, const uint8_t *data, uint32_t size)
+{
+    VP_FUNC_CALL();
+
+    MOS_STATUS eStatus = m_ring.Push(path, data, size);
+    if (MOS_STATUS_NO_SPACE == eStatus)
+    {
+        // Drop the dump rather than stalling the render thread.
+        VPHAL_DEBUG_NORMALMESSAGE("Staging ring full, %s dropped.", path);
+        return eStatus;
+    }
+    VP_PUBLIC_CHK_STATUS_RETURN(eStatus);
+
+    MOS_PostSemaphore(m_semaphore, 1);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void VpDumpFileWriter::WorkerThread(void *writer)
+{
+    if (writer)
+    {
+        ((VpDumpFileWriter *)writer)->ProcessPendingWrites();
+    }
+}
+
+void VpDumpFileWriter::ProcessPendingWrites()
+{
+    const char      *path = nullptr;
+    const uint8_t   *data = nullptr;
+    uint32_t        size  = 0;
+
+    while (MOS_STATUS_SUCCESS == MOS_WaitSemaphore(m_semaphore, INFINITE))
+    {
+        if (!m_ring.Front(&path, &data, &size))
+        {
+            MOS_LockMutex(m_mutex);
+            bool exit = m_exit;
+            MOS_UnlockMutex(m_mutex);
+            if (exit)
+            {
+                break;
+            }
+            continue;
+        }
+
+        if (MOS_FAILED(MOS_WriteFileFromPtr(path, (void *)data, size)))
+        {
+            VPHAL_DEBUG_ASSERTMESSAGE("Failed to write %s.", path);
+        }
+        m_ring.Pop();
+    }
+}
+
+MOS_STATUS VpSurfaceDumper::WriteDumpFile(
+    const char                      *path,
+    uint8_t                         *data,
+    uint32_t                        size)
+{
+    VP_FUNC_CALL();
+
+    if (nullptr == m_fileWriter)
+    {
+        return MOS_WriteFileFromPtr(path, data, size);
+    }
+
+    MOS_STATUS eStatus = m_fileWriter->Write(path, data, size);
+    // Dropped dump is not treated as failure.
+    return (MOS_STATUS_NO_SPACE == eStatus) ? MOS_STATUS_SUCCESS : eStatus;
+}
+
 bool VpSurfaceDumper::HasAuxSurf(
     PMOS_RESOURCE    osResource)
 {
@@ -1087,7 +1213,7 @@ MOS_STATUS VpSurfaceDumper::DumpSurfaceToFile(
 
                 VpDumperTool::GetOsFilePath(sPlanePath, sPlaneOsPath);
 
-                VPHAL_DEBUG_CHK_STATUS(MOS_WriteFileFromPtr(sPlaneOsPath, pDst + dstPlaneOffset[j], dstPlaneOffset[j + 1]));
+                VPHAL_DEBUG_CHK_STATUS(WriteDumpFile(sPlaneOsPath, pDst + dstPlaneOffset[j], dstPlaneOffset[j + 1]));
             }
             else
             {
@@ -1096,7 +1222,7 @@ MOS_STATUS VpSurfaceDumper::DumpSurfaceToFile(
         }
     }
 
-    VPHAL_DEBUG_CHK_STATUS(MOS_WriteFileFromPtr(sOsPath, pDst, dwSize));
+    VPHAL_DEBUG_CHK_STATUS(WriteDumpFile(sOsPath, pDst, dwSize));
 
 #if !EMUL
     // Dump Aux surface data
@@ -1156,7 +1282,7 @@ MOS_STATUS VpSurfaceDumper::DumpSurfaceToFile(
             auxDataY,
             auxSizeY);
 
-        VPHAL_DEBUG_CHK_STATUS(MOS_WriteFileFromPtr(sOsPath, pDstAux, auxSizeY));
+        VPHAL_DEBUG_CHK_STATUS(WriteDumpFile(sOsPath, pDstAux, auxSizeY));
         MOS_SafeFreeMemory(pDstAux);
 
         if (auxSizeUV && isPlanar)
@@ -1184,7 +1310,7 @@ MOS_STATUS VpSurfaceDumper::DumpSurfaceToFile(
                 auxDataUV,
                 auxSizeUV);
 
-            VPHAL_DEBUG_CHK_STATUS(MOS_WriteFileFromPtr(sOsPath, pDstUVAux, auxSizeUV));
+            VPHAL_DEBUG_CHK_STATUS(WriteDumpFile(sOsPath, pDstUVAux, auxSizeUV));
             MOS_SafeFreeMemory(pDstUVAux);
         }
     }
@@ -1380,7 +1506,7 @@ MOS_STATUS VpSurfaceDumper::DumpSurfaceToFile(
 
                 VpDumperTool::GetOsFilePath(sPlanePath, sPlaneOsPath);
 
-                VPHAL_DEBUG_CHK_STATUS(MOS_WriteFileFromPtr(sPlaneOsPath, pDst + dstPlaneOffset[j], dstPlaneOffset[j + 1]));
+                VPHAL_DEBUG_CHK_STATUS(WriteDumpFile(sPlaneOsPath, pDst + dstPlaneOffset[j], dstPlaneOffset[j + 1]));
             }
             else
             {
@@ -1389,7 +1515,7 @@ MOS_STATUS VpSurfaceDumper::DumpSurfaceToFile(
         }
     }
 
-    VPHAL_DEBUG_CHK_STATUS(MOS_WriteFileFromPtr(sOsPath, pDst, dwSize));
+    VPHAL_DEBUG_CHK_STATUS(WriteDumpFile(sOsPath, pDst, dwSize));
 
 finish:
     MOS_SafeFreeMemory(pDst);
@@ -1834,6 +1960,25 @@ void VpSurfaceDumper::GetSurfaceDumpSpec()
         m_osInterface->pOsContext));
     pDumpSpec->enablePlaneDump = UserFeatureData.u32Data;
 
+    // Get async dump enabled flag
+    MOS_ZeroMemory(&UserFeatureData, sizeof(UserFeatureData));
+    MOS_USER_FEATURE_INVALID_KEY_ASSERT(MOS_UserFeature_ReadValue_ID(
+        nullptr,
+        __VPHAL_DBG_SURF_DUMP_ENABLE_ASYNC_DUMP_ID,
+        &UserFeatureData,
+        m_osInterface->pOsContext));
+    pDumpSpec->enableAsyncDump = UserFeatureData.u32Data;
+
+    if (bDumpEnabled && pDumpSpec->enableAsyncDump && nullptr == m_fileWriter)
+    {
+        m_fileWriter = MOS_New(VpDumpFileWriter);
+        if (m_fileWriter && MOS_FAILED(m_fileWriter->Initialize()))
+        {
+            // Fall back to write dump files directly.
+            MOS_Delete(m_fileWriter);
+        }
+    }
+
 finish:
     if ((eStatus != MOS_STATUS_SUCCESS) || (!bDumpEnabled))
     {
@@ -1845,6 +1990,8 @@ finish:
 
 VpSurfaceDumper::~VpSurfaceDumper()
 {
+    // Pending dump files are written before writer destroyed.
+    MOS_Delete(m_fileWriter);
     MOS_SafeFreeMemory(m_dumpSpec.pDumpLocations);
 }
 
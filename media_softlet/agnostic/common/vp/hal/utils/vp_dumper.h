@@ -35,6 +35,7 @@
 #include "mhw_vebox.h"
 #include "vphal_common.h"       // Common interfaces and structures
 #include "vp_pipeline_common.h"
+#include "vp_dump_staging_ring.h"
 
 #if !defined(LINUX) && !defined(ANDROID)
 #include "UmdStateSeparation.h"
@@ -194,6 +195,7 @@ struct VPHAL_SURF_DUMP_SPEC
     int32_t                       iNumDumpLocs;                                 //!< Number of pipe stage dump locations
     bool                          enableAuxDump;                                //!< Enable aux data dump for compressed surface
     bool                          enablePlaneDump;                              //!< Enable surface dump by plane
+    bool                          enableAsyncDump;                              //!< Write dump files in background thread
 };
 
 //!
@@ -225,6 +227,106 @@ struct VPHAL_PARAMS_DUMP_SPEC
     uint32_t                   enableSkuWaDump;                                   // Enable sku and wa info dump
 };
 
+#define VPHAL_DUMP_ASYNC_RING_SIZE              8                           //!< Max number of dump files pending for writing
+#define VPHAL_DUMP_ASYNC_MAX_STAGING_SIZE       (256 * 1024 * 1024)         //!< Max size of staging memory for async dump
+
+//!
+//! Class VpDumpMutex
+//! \brief MOS mutex with the lock and unlock of VpDumpStagingRing
+//!
+class VpDumpMutex
+{
+public:
+    VpDumpMutex()
+    {
+        m_mutex = MOS_CreateMutex();
+    }
+
+    virtual ~VpDumpMutex()
+    {
+        if (m_mutex)
+        {
+            MOS_DestroyMutex(m_mutex);
+            m_mutex = nullptr;
+        }
+    }
+
+    VpDumpMutex(const VpDumpMutex &) = delete;
+    VpDumpMutex &operator=(const VpDumpMutex &) = delete;
+
+    void lock()
+    {
+        MOS_LockMutex(m_mutex);
+    }
+
+    void unlock()
+    {
+        MOS_UnlockMutex(m_mutex);
+    }
+
+private:
+    PMOS_MUTEX                  m_mutex = nullptr;
+};
+
+//!
+//! Class VpDumpFileWriter
+//! \brief VP dump file writer running in background thread
+//! \details Dump data is copied to a bounded staging ring and written to file by
+//!          a worker thread, which keeps file io out of the render thread. Dump
+//!          is dropped instead of blocking the caller when the ring is full.
+//!
+class VpDumpFileWriter
+{
+public:
+    VpDumpFileWriter();
+
+    //!
+    //! \brief    VpDumpFileWriter destuctor
+    //! \details  Wait for all pending dump files written
+    //!
+    virtual ~VpDumpFileWriter();
+
+    //!
+    //! \brief    Start the worker thread
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS Initialize();
+
+    //!
+    //! \brief    Queue data to be written to file
+    //! \param    [in] path
+    //!           Os file path to write
+    //! \param    [in] data
+    //!           Data to write, which is copied to staging ring before return
+    //! \param    [in] size
+    //!           Size of data
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if queued, MOS_STATUS_NO_SPACE if dropped
+    //!           for ring full, otherwise failed
+    //!
+    MOS_STATUS Write(const char *path, const uint8_t *data, uint32_t size);
+
+    //!
+    //! \brief    Get the number of dump files dropped for ring full
+    //! \return   uint32_t
+    //!
+    uint32_t GetDroppedCount()
+    {
+        return m_ring.GetDroppedCount();
+    }
+
+protected:
+    static void WorkerThread(void *writer);
+    void ProcessPendingWrites();
+
+    vp::VpDumpStagingRing<VpDumpMutex, VPHAL_DUMP_ASYNC_RING_SIZE> m_ring{VPHAL_DUMP_ASYNC_MAX_STAGING_SIZE};
+    bool                        m_exit          = false;
+    PMOS_MUTEX                  m_mutex         = nullptr;  //!< Guards m_exit
+    PMOS_SEMAPHORE              m_semaphore     = nullptr;  //!< Posted for each queued dump and exit
+    MOS_THREADHANDLE            m_thread        = 0;
+};
+
 //==<FUNCTIONS>=================================================================
 //!
 //! Class VpSurfaceDumper
@@ -387,7 +489,26 @@ protected:
     bool HasAuxSurf(
         PMOS_RESOURCE                   osResource);
 
+    //!
+    //! \brief    Write dump data to file
+    //! \details  Queue the data to background writer if async dump enabled,
+    //!           otherwise write the file directly
+    //! \param    [in] path
+    //!           Os file path to write
+    //! \param    [in] data
+    //!           Data to write
+    //! \param    [in] size
+    //!           Size of data
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS WriteDumpFile(
+        const char                      *path,
+        uint8_t                         *data,
+        uint32_t                        size);
+
     PMOS_INTERFACE              m_osInterface;
+    VpDumpFileWriter            *m_fileWriter = nullptr;    //!< Background file writer for async dump
     char                        m_dumpPrefix[MAX_PATH];     // Called frequently, so avoid repeated stack resizing with member data
     char                        m_dumpLoc[MAX_PATH];        // to avoid recursive call from diff owner but sharing the same buffer
 
@@ -0,0 +1,140 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     vp_obj_pool.h
+//! \brief    Free list of vp objects reused across frames.
+//! \details  Only depends on MOS definitions, object creation and deletion are passed in by
+//!           the owner, so pooling and its heap allocation trace can be tested on their own.
+//!
+#ifndef __VP_OBJ_POOL_H__
+#define __VP_OBJ_POOL_H__
+
+#include <atomic>
+#include <vector>
+#include "mos_defs.h"
+
+namespace vp
+{
+//!
+//! \brief  Counts vp objects allocated from heap because their object pool was empty.
+//!         Pools are filled during the first frames, so steady state frames are expected
+//!         to report no heap allocation.
+//!
+class ObjAllocTrace
+{
+public:
+    static void OnHeapAlloc()
+    {
+        GetCounter()++;
+    }
+
+    static int32_t GetHeapAllocCount()
+    {
+        return GetCounter();
+    }
+
+private:
+    static std::atomic<int32_t> &GetCounter()
+    {
+        static std::atomic<int32_t> heapAllocCount(0);
+        return heapAllocCount;
+    }
+};
+
+//!
+//! \brief  Free list of vp objects of one kind. Objects released at the end of a frame are
+//!         handed out again by the next frame, so heap is only used while the pool warms up.
+//!         The owner creates the objects, so it also deletes the free ones by Clear.
+//!
+template<class Type>
+class VpObjPool
+{
+public:
+    //!
+    //! \brief  Take an object from the pool
+    //! \return Type *
+    //!         Pooled object, nullptr if the pool is empty, in which case the caller
+    //!         allocates the object from heap
+    //!
+    Type *Acquire()
+    {
+        if (m_Pool.empty())
+        {
+            ObjAllocTrace::OnHeapAlloc();
+            return nullptr;
+        }
+        Type *obj = m_Pool.back();
+        m_Pool.pop_back();
+        return obj;
+    }
+
+    //!
+    //! \brief  Take an object from the pool, or create it if the pool is empty
+    //! \param  [in] create
+    //!         Allocates a new object from heap
+    //!
+    template<class Create>
+    Type *Acquire(Create create)
+    {
+        Type *obj = Acquire();
+        return obj ? obj : create();
+    }
+
+    //!
+    //! \brief  Give an object back to the pool
+    //!
+    void Release(Type *&obj)
+    {
+        if (obj)
+        {
+            m_Pool.push_back(obj);
+            obj = nullptr;
+        }
+    }
+
+    //!
+    //! \brief  Delete all free objects
+    //! \param  [in] destroy
+    //!         Deletes an object created by the owner
+    //!
+    template<class Destroy>
+    void Clear(Destroy destroy)
+    {
+        while (!m_Pool.empty())
+        {
+            Type *obj = m_Pool.back();
+            m_Pool.pop_back();
+            destroy(obj);
+        }
+    }
+
+    size_t GetFreeCount() const
+    {
+        return m_Pool.size();
+    }
+
+private:
+    std::vector<Type *> m_Pool;
+};
+}
+
+#endif // !__VP_OBJ_POOL_H__
@@ -25,6 +25,7 @@
 #include <mutex>
 #include "mos_util_debug.h"
 #include "mos_os.h"
+#include "vp_obj_pool.h"
 
 #define VP_UNUSED(param) (void)(param)
 //------------------------------------------------------------------------------